@@ -165,6 +165,110 @@ dart_ret_t dart_allgatherv(
   const size_t    * recvdispls,
   dart_team_t       teamid) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI alltoall.
+ * Every unit sends a distinct block of \c nelem values to every unit in
+ * the team, block \c i in \c sendbuf is sent to unit \c i and the block
+ * received from unit \c i is stored at block \c i in \c recvbuf.
+ *
+ * \param sendbuf The buffer containing \c nelem values for every unit.
+ * \param recvbuf The buffer to hold \c nelem values from every unit.
+ * \param nelem   Number of values sent to and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the alltoall.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI alltoallv.
+ * All arrays of counts and displacements have one entry per unit in the
+ * team, displacements are specified in number of values.
+ *
+ * \param sendbuf     The buffer containing the data to be sent.
+ * \param nsendelem   Array containing the number of values to send to each
+ *                    unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param teamid      The team to participate in the alltoallv.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid) DART_NOTHROW;
+
+/**
+ * Sparse personalized exchange between neighboring units.
+ * Unlike \c dart_alltoallv, every unit only specifies the units it sends
+ * data to and the units it receives data from, so the cost of the
+ * exchange depends on the number of neighbors instead of the team size.
+ * Every unit listed in \c sendunits must list the calling unit in its
+ * \c recvunits with a matching number of values and vice versa.
+ * Exchanges with the calling unit itself are performed as local copies.
+ * Collective operation, must be called by all units in the team even if
+ * they do not exchange any data.
+ *
+ * \param sendbuf     The buffer containing the data to be sent.
+ * \param nsendunits  Number of units to send data to.
+ * \param sendunits   Array of \c nsendunits units to send data to.
+ * \param nsendelem   Array containing the number of values to send to
+ *                    each unit in \c sendunits.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendunits.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvunits  Number of units to receive data from.
+ * \param recvunits   Array of \c nrecvunits units to receive data from.
+ * \param nrecvelem   Array containing the number of values to receive
+ *                    from each unit in \c recvunits.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvunits.
+ * \param teamid      The team to participate in the exchange.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_neighbor_alltoallv(
+  const void             * sendbuf,
+  size_t                   nsendunits,
+  const dart_team_unit_t * sendunits,
+  const size_t           * nsendelem,
+  const size_t           * senddispls,
+  dart_datatype_t          dtype,
+  void                   * recvbuf,
+  size_t                   nrecvunits,
+  const dart_team_unit_t * recvunits,
+  const size_t           * nrecvelem,
+  const size_t           * recvdispls,
+  dart_team_t              teamid) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI allreduce.
  *
@@ -440,6 +544,123 @@ dart_ret_t dart_flush_local_all(
 
 /** \} */
 
+/**
+ * \name Active-target synchronization epochs
+ * By default, one-sided operations on team-aligned memory are completed
+ * by flush operations on individual targets (passive-target
+ * synchronization).
+ * Alternatively, units in a team may open an active-target epoch, in which
+ * the operations of all units are completed collectively at the end of
+ * the epoch (fence), or in groups of neighboring units (post, start,
+ * complete, wait).
+ *
+ * Within an active-target epoch on a team, only \c dart_get, \c dart_put
+ * and \c dart_accumulate may be used on memory allocated by the team.
+ * Flush operations on the team's memory return immediately as operations
+ * are completed when the epoch ends. Blocking and handle-based operations
+ * on the team's memory fail with \c DART_ERR_INVAL.
+ * Memory allocated by other teams and local allocations are not affected.
+ */
+
+/** \{ */
+
+/**
+ * Opens a fence epoch on the memory allocated by a team.
+ * Outstanding operations on the team's memory are completed before.
+ *
+ * Collective on the team.
+ *
+ * \param teamid The team to synchronize.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_epoch_fence_begin(
+  dart_team_t teamid) DART_NOTHROW;
+
+/**
+ * Completes all one-sided operations of all units on the memory of the
+ * team issued in the current fence epoch, and starts the next fence
+ * epoch.
+ * Similar to \c MPI_Win_fence().
+ *
+ * Collective on the team.
+ *
+ * \param teamid The team to synchronize.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_epoch_fence(
+  dart_team_t teamid) DART_NOTHROW;
+
+/**
+ * Completes all one-sided operations of all units on the memory of the
+ * team issued in the current fence epoch and returns to passive-target
+ * synchronization.
+ *
+ * Collective on the team.
+ *
+ * \param teamid The team to synchronize.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_epoch_fence_end(
+  dart_team_t teamid) DART_NOTHROW;
+
+/**
+ * Opens an active-target epoch on the memory allocated by a team, in
+ * which the calling unit exposes its memory to the units in \c origins and
+ * accesses memory of the units in \c targets.
+ * Similar to \c MPI_Win_post() followed by \c MPI_Win_start().
+ *
+ * Every unit in \c targets must specify the calling unit in its
+ * \c origins and vice versa.
+ * Outstanding operations on the team's memory are completed before.
+ *
+ * \param teamid    The team to synchronize.
+ * \param origins   The units accessing the calling unit's memory.
+ * \param norigins  The number of units in \c origins.
+ * \param targets   The units whose memory is accessed by the calling unit.
+ * \param ntargets  The number of units in \c targets.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_epoch_pscw_begin(
+  dart_team_t              teamid,
+  const dart_team_unit_t * origins,
+  size_t                   norigins,
+  const dart_team_unit_t * targets,
+  size_t                   ntargets) DART_NOTHROW;
+
+/**
+ * Completes the one-sided operations of the calling unit on the memory of
+ * the units in its targets, waits for completion of the operations of
+ * the units in its origins and returns to passive-target synchronization.
+ * Similar to \c MPI_Win_complete() followed by \c MPI_Win_wait().
+ *
+ * \param teamid The team to synchronize.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_epoch_pscw_end(
+  dart_team_t teamid) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Non-blocking single-sided communication operations using handles
  * The handle can be used to wait for a specific operation to complete using \c wait functions.
@@ -464,6 +685,9 @@ typedef struct dart_handle_struct * dart_handle_t;
  * \param nelem  The number of elements of \c dtype in buffer \c dest.
  * \param dtype  The data type of the values in buffer \c dest.
  * \param[out] handle Pointer to DART handle to instantiate for later use with \c dart_wait, \c dart_wait_all etc.
+ *                    Set to \c NULL if the transfer has already completed,
+ *                    e.g. if the target unit shares memory with the
+ *                    calling unit.
  *
  * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
  *
@@ -516,6 +740,8 @@ dart_ret_t dart_wait(
   dart_handle_t handle) DART_NOTHROW;
 /**
  * Wait for the local and remote completion of operations.
+ * Remote completion requires a single flush per target unit of the
+ * operations.
  *
  * \param handles Array of handles of operations to wait for.
  * \param n Number of \c handles to wait for.
@@ -591,6 +817,224 @@ dart_ret_t dart_testall_local(
 
 /** \} */
 
+/**
+ * \name Non-blocking collective operations
+ * Collective operations involving all units of a given team that return
+ * a handle to be completed with \c dart_wait, \c dart_waitall or
+ * \c dart_test_local.
+ * Every unit in the team must call the operation before any unit
+ * completes it, collectives on the same team must be issued in the same
+ * order at all units.
+ */
+
+/** \{ */
+
+/**
+ * Non-blocking variant of \c dart_barrier.
+ *
+ * \param team        The team to perform a barrier on.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibarrier(
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_bcast.
+ * The buffer \c buf must not be accessed before completion of the
+ * operation.
+ *
+ * \param buf         Buffer that is the source (on \c root) or the
+ *                    destination of the broadcast.
+ * \param nelem       The number of values to broadcast/receive.
+ * \param dtype       The data type of values in \c buf.
+ * \param root        The unit that broadcasts data to all other members in
+ *                    \c team
+ * \param team        The team to participate in the broadcast.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_allgather.
+ * The buffers \c sendbuf and \c recvbuf must not be accessed before
+ * completion of the operation.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each
+ *                    unit.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nelem       Number of values sent by each process and received
+ *                    from each unit.
+ * \param dtype       The data type of values in \c sendbuf and
+ *                    \c recvbuf.
+ * \param team        The team to participate in the allgather.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallgather(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_allgatherv.
+ * The buffers \c sendbuf and \c recvbuf must not be accessed before
+ * completion of the operation. The arrays \c nrecvelem and \c recvdispls
+ * may be released after the call.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each
+ *                    unit.
+ * \param nsendelem   Number of values to be sent by this unit.
+ * \param dtype       The data type of values in \c sendbuf and
+ *                    \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive
+ *                    from each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param teamid      The team to participate in the allgatherv.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallgatherv(
+  const void        * sendbuf,
+  size_t              nsendelem,
+  dart_datatype_t     dtype,
+  void              * recvbuf,
+  const size_t      * nrecvelem,
+  const size_t      * recvdispls,
+  dart_team_t         teamid,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_allreduce.
+ * The buffers \c sendbuf and \c recvbuf must not be accessed before
+ * completion of the operation.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each
+ *                    unit.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nelem       Number of elements sent by each process and received
+ *                    from each unit.
+ * \param dtype       The data type of values in \c sendbuf and
+ *                    \c recvbuf to use in \c op.
+ * \param op          The reduction operation to perform.
+ * \param team        The team to participate in the allreduce.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallreduce(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_alltoall.
+ * The buffers \c sendbuf and \c recvbuf must not be accessed before
+ * completion of the operation.
+ *
+ * \param sendbuf     The buffer containing \c nelem values for every unit.
+ * \param recvbuf     The buffer to hold \c nelem values from every unit.
+ * \param nelem       Number of values sent to and received from each unit.
+ * \param dtype       The data type of values in \c sendbuf and
+ *                    \c recvbuf.
+ * \param team        The team to participate in the alltoall.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ialltoall(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_alltoallv.
+ * The buffers \c sendbuf and \c recvbuf must not be accessed before
+ * completion of the operation. The arrays of counts and displacements
+ * may be released after the call.
+ *
+ * \param sendbuf     The buffer containing the data to be sent.
+ * \param nsendelem   Array containing the number of values to send to
+ *                    each unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and
+ *                    \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive
+ *                    from each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param teamid      The team to participate in the alltoallv.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ialltoallv(
+  const void        * sendbuf,
+  const size_t      * nsendelem,
+  const size_t      * senddispls,
+  dart_datatype_t     dtype,
+  void              * recvbuf,
+  const size_t      * nrecvelem,
+  const size_t      * recvdispls,
+  dart_team_t         teamid,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Blocking single-sided communication operations
  * These operations will block until completion of put and get is guaranteed.
@@ -640,6 +1084,412 @@ dart_ret_t dart_put_blocking(
 
 /** \} */
 
+/**
+ * \name Strided and indexed single-sided communication operations
+ * Transfers between a contiguous local buffer and a non-contiguous
+ * region in global memory that is described by a block length and a
+ * stride or by lists of block lengths and displacements.
+ * All lengths, strides and displacements are given in number of elements
+ * of type \c dtype. Completion semantics of the 'REGULAR', 'HANDLE' and
+ * 'BLOCKING' variants are the same as for their contiguous counterparts.
+ */
+
+/** \{ */
+
+/**
+ * 'REGULAR' variant of a strided get.
+ * Copy \c nblocks blocks of \c nelem_block contiguous elements each from
+ * global memory into the contiguous local buffer \c dest.
+ * The start of consecutive blocks in global memory is \c stride elements
+ * apart.
+ * A later flush operation is needed to guarantee local and remote
+ * completion.
+ *
+ * \param dest         The local destination buffer of at least
+ *                     \c nblocks * \c nelem_block elements.
+ * \param gptr         A global pointer to the first element of the first
+ *                     block to read.
+ * \param nblocks      The number of blocks to transfer.
+ * \param nelem_block  The number of contiguous elements in every block.
+ * \param stride       The distance in elements between the start of two
+ *                     consecutive blocks in global memory.
+ * \param dtype        The data type of the values in buffer \c dest.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_strided(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype) DART_NOTHROW;
+
+/**
+ * 'REGULAR' variant of a strided put.
+ * Copy \c nblocks blocks of \c nelem_block elements each from the
+ * contiguous local buffer \c src into global memory where the start of
+ * consecutive blocks is \c stride elements apart.
+ * A later flush operation is needed to guarantee local and remote
+ * completion.
+ *
+ * \param gptr         A global pointer to the first element of the first
+ *                     block to write.
+ * \param src          The local source buffer of at least
+ *                     \c nblocks * \c nelem_block elements.
+ * \param nblocks      The number of blocks to transfer.
+ * \param nelem_block  The number of contiguous elements in every block.
+ * \param stride       The distance in elements between the start of two
+ *                     consecutive blocks in global memory.
+ * \param dtype        The data type of the values in buffer \c src.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_strided(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of \ref dart_get_strided.
+ *
+ * \param dest         The local destination buffer.
+ * \param gptr         A global pointer to the first element to read.
+ * \param nblocks      The number of blocks to transfer.
+ * \param nelem_block  The number of contiguous elements in every block.
+ * \param stride       The distance in elements between two blocks.
+ * \param dtype        The data type of the values in buffer \c dest.
+ * \param[out] handle  Pointer to DART handle to instantiate for later use
+ *                     with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_strided_handle(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of \ref dart_put_strided.
+ *
+ * \param gptr         A global pointer to the first element to write.
+ * \param src          The local source buffer.
+ * \param nblocks      The number of blocks to transfer.
+ * \param nelem_block  The number of contiguous elements in every block.
+ * \param stride       The distance in elements between two blocks.
+ * \param dtype        The data type of the values in buffer \c src.
+ * \param[out] handle  Pointer to DART handle to instantiate for later use
+ *                     with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_strided_handle(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * 'BLOCKING' variant of \ref dart_get_strided.
+ * Both local and remote completion is guaranteed.
+ *
+ * \param dest         The local destination buffer.
+ * \param gptr         A global pointer to the first element to read.
+ * \param nblocks      The number of blocks to transfer.
+ * \param nelem_block  The number of contiguous elements in every block.
+ * \param stride       The distance in elements between two blocks.
+ * \param dtype        The data type of the values in buffer \c dest.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_strided_blocking(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype) DART_NOTHROW;
+
+/**
+ * 'BLOCKING' variant of \ref dart_put_strided.
+ * Both local and remote completion is guaranteed.
+ *
+ * \param gptr         A global pointer to the first element to write.
+ * \param src          The local source buffer.
+ * \param nblocks      The number of blocks to transfer.
+ * \param nelem_block  The number of contiguous elements in every block.
+ * \param stride       The distance in elements between two blocks.
+ * \param dtype        The data type of the values in buffer \c src.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_strided_blocking(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of an indexed get.
+ * Copy \c nblocks blocks from global memory into the contiguous local
+ * buffer \c dest. Block \c i consists of \c nelem_blocks[i] elements
+ * and starts \c displs[i] elements after the element referenced by
+ * \c gptr.
+ *
+ * \param dest          The local destination buffer of at least
+ *                      \c sum(nelem_blocks) elements.
+ * \param gptr          A global pointer used as base of the
+ *                      displacements.
+ * \param nblocks       The number of blocks to transfer.
+ * \param nelem_blocks  Array of \c nblocks block lengths.
+ * \param displs        Array of \c nblocks block displacements.
+ * \param dtype         The data type of the values in buffer \c dest.
+ * \param[out] handle   Pointer to DART handle to instantiate for later use
+ *                      with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_indexed_handle(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  const size_t    * nelem_blocks,
+  const size_t    * displs,
+  dart_datatype_t   dtype,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of an indexed put.
+ * Copy the contiguous local buffer \c src into \c nblocks blocks in
+ * global memory. Block \c i consists of \c nelem_blocks[i] elements
+ * and starts \c displs[i] elements after the element referenced by
+ * \c gptr.
+ *
+ * \param gptr          A global pointer used as base of the
+ *                      displacements.
+ * \param src           The local source buffer of at least
+ *                      \c sum(nelem_blocks) elements.
+ * \param nblocks       The number of blocks to transfer.
+ * \param nelem_blocks  Array of \c nblocks block lengths.
+ * \param displs        Array of \c nblocks block displacements.
+ * \param dtype         The data type of the values in buffer \c src.
+ * \param[out] handle   Pointer to DART handle to instantiate for later use
+ *                      with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_indexed_handle(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  const size_t    * nelem_blocks,
+  const size_t    * displs,
+  dart_datatype_t   dtype,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/** \} */
+
+/**
+ * \name Non-blocking single-sided communication operations in handle groups
+ * Operations added to a handle group are completed together in a single
+ * call of \c dart_handle_group_waitall. In contrast to operations using
+ * \c dart_handle_t, no resources are allocated per operation and remote
+ * completion requires a single flush per target unit.
+ */
+
+/** \{ */
+
+/**
+ * Handle group created by \c dart_handle_group_create collecting
+ * operations to be completed by \c dart_handle_group_waitall.
+ */
+typedef struct dart_handle_group_struct * dart_handle_group_t;
+
+/**
+ * Create an empty handle group.
+ *
+ * \param[out] group  Pointer to the handle group to instantiate.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_create(
+  dart_handle_group_t * group) DART_NOTHROW;
+
+/**
+ * Release a handle group. Operations in the group must have been
+ * completed by \c dart_handle_group_waitall.
+ *
+ * \param group  Pointer to the handle group to release, set to \c NULL.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_destroy(
+  dart_handle_group_t * group) DART_NOTHROW;
+
+/**
+ * Wait for the local and remote completion of all operations in a handle
+ * group. The group is empty afterwards and can be reused.
+ *
+ * \param group  The handle group to complete.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_waitall(
+  dart_handle_group_t group) DART_NOTHROW;
+
+/**
+ * Variant of \ref dart_get_handle adding the operation to a handle group.
+ *
+ * \param dest   Local target memory to store the data.
+ * \param gptr   Global pointer being the source of the data transfer.
+ * \param nelem  The number of elements of \c dtype in buffer \c dest.
+ * \param dtype  The data type of the values in buffer \c dest.
+ * \param group  The handle group to add the operation to.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_grouped(
+  void                * dest,
+  dart_gptr_t           gptr,
+  size_t                nelem,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group) DART_NOTHROW;
+
+/**
+ * Variant of \ref dart_put_handle adding the operation to a handle group.
+ *
+ * \param gptr   Global pointer being the target of the data transfer.
+ * \param src    Local source memory to transfer data from.
+ * \param nelem  The number of elements of type \c dtype to transfer.
+ * \param dtype  The data type of the values in buffer \c src.
+ * \param group  The handle group to add the operation to.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_grouped(
+  dart_gptr_t           gptr,
+  const void          * src,
+  size_t                nelem,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group) DART_NOTHROW;
+
+/**
+ * Variant of \ref dart_get_strided_handle adding the operation to a
+ * handle group.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_strided_grouped(
+  void                * dest,
+  dart_gptr_t           gptr,
+  size_t                nblocks,
+  size_t                nelem_block,
+  size_t                stride,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group) DART_NOTHROW;
+
+/**
+ * Variant of \ref dart_put_strided_handle adding the operation to a
+ * handle group.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_strided_grouped(
+  dart_gptr_t           gptr,
+  const void          * src,
+  size_t                nblocks,
+  size_t                nelem_block,
+  size_t                stride,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group) DART_NOTHROW;
+
+/**
+ * Variant of \ref dart_get_indexed_handle adding the operation to a
+ * handle group.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_indexed_grouped(
+  void                * dest,
+  dart_gptr_t           gptr,
+  size_t                nblocks,
+  const size_t        * nelem_blocks,
+  const size_t        * displs,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group) DART_NOTHROW;
+
+/**
+ * Variant of \ref dart_put_indexed_handle adding the operation to a
+ * handle group.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_indexed_grouped(
+  dart_gptr_t           gptr,
+  const void          * src,
+  size_t                nblocks,
+  const size_t        * nelem_blocks,
+  const size_t        * displs,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group) DART_NOTHROW;
+
+/** \} */
+
 
 /**
  * \name Blocking two-sided communication operations
@@ -159,6 +159,26 @@ dart_ret_t dart_gptr_getaddr(
   const dart_gptr_t    gptr,
         void        ** addr) DART_NOTHROW;
 
+/**
+ * Get the memory address for the specified global pointer gptr if the
+ * referenced memory is directly accessible by the calling unit, i.e. if
+ * it has affinity to the local unit or is located in a shared memory
+ * window of a unit on the same node.
+ *
+ * \param      gptr Global pointer
+ * \param[out] addr Pointer to a pointer that will hold the address of
+ *                  the memory element, or \c NULL if the memory element
+ *                  is not directly accessible.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_gptr_getaddr_shared(
+  const dart_gptr_t    gptr,
+        void        ** addr) DART_NOTHROW;
+
 /**
  * Set the local memory address for the specified global pointer such
  * the the specified address.
@@ -408,6 +428,77 @@ dart_ret_t dart_team_memregister(
  */
 dart_ret_t dart_team_memderegister(dart_gptr_t gptr) DART_NOTHROW;
 
+/**
+ * Collective function, creates a global memory segment without local
+ * memory to which every unit attaches externally allocated memory regions
+ * individually using \ref dart_memattach.
+ *
+ * Offsets of global pointers in the segment are absolute addresses in the
+ * local memory of the referenced unit. Units have to exchange the global
+ * pointers of attached regions themselves, but attaching and detaching
+ * regions does not require any communication.
+ *
+ * The segment is released using \ref dart_team_memderegister, memory
+ * regions still attached to the segment are not detached.
+ *
+ * \param teamid The team to participate in the collective operation.
+ * \param gptr   Pointer to a global pointer object referencing the segment
+ *               to set up.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \see dart_memattach
+ * \see dart_memdetach
+ *
+ * \threadsafe_none
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_team_memregister_dynamic(
+  dart_team_t       teamid,
+  dart_gptr_t     * gptr) DART_NOTHROW;
+
+/**
+ * Local function, attaches a memory region previously allocated by the
+ * user to a segment created in \ref dart_team_memregister_dynamic.
+ * Does not perform any memory allocation.
+ *
+ * \param segment Global pointer referencing the segment.
+ * \param nlelem  The number of local elements allocated in \c addr to
+ *                attach.
+ * \param dtype   The data type of elements in \c addr.
+ * \param addr    Pointer to pre-allocated memory to be attached.
+ * \param gptr    Pointer to a global pointer object to set up, references
+ *                \c addr at the calling unit. Set to \c DART_GPTR_NULL
+ *                if the region is empty, as empty regions are not
+ *                attached.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_memattach(
+  dart_gptr_t       segment,
+  size_t            nlelem,
+  dart_datatype_t   dtype,
+  void            * addr,
+  dart_gptr_t     * gptr) DART_NOTHROW;
+
+/**
+ * Local function, detaches a memory region attached in
+ * \ref dart_memattach. Does not de-allocate memory.
+ *
+ * Remote units must have completed their accesses to the memory region.
+ *
+ * \param gptr   Global pointer returned by \ref dart_memattach.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_memdetach(dart_gptr_t gptr) DART_NOTHROW;
+
 
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
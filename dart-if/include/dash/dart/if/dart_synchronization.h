@@ -45,9 +45,34 @@ dart_ret_t dart_team_lock_init(
   dart_team_t   teamid,
   dart_lock_t * lock)   DART_NOTHROW;
 
+/**
+ * Collective operation to initialize a hierarchical \c lock object.
+ *
+ * Units on the same node first arbitrate in a node-local ticket lock in
+ * shared memory and only the winner competes for the global lock. A unit
+ * releasing the lock hands the global lock over to a waiting unit on the
+ * same node, up to a bounded number of times in a row before releasing
+ * it to other nodes. All waiting is done by polling via RMA.
+ *
+ * The lock is used with \ref dart_lock_acquire,
+ * \ref dart_lock_try_acquire and \ref dart_lock_release like a lock
+ * initialized using \ref dart_team_lock_init.
+ *
+ * \param teamid Team this lock is used for.
+ * \param lock   The lock to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_lock_init_hierarchical(
+  dart_team_t   teamid,
+  dart_lock_t * lock)   DART_NOTHROW;
+
 /**
  * Collective operation to destroy a \c lock initialized using
- * \ref dart_team_lock_init.
+ * \ref dart_team_lock_init or \ref dart_team_lock_init_hierarchical.
  *
  * \param lock   The \c lock to free.
  * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
@@ -109,6 +134,99 @@ dart_ret_t dart_lock_release(
   dart_lock_t   lock)   DART_NOTHROW;
 
 
+/**
+ * Reader-writer lock type allowing shared access of any number of readers
+ * or exclusive access of a single writer among units in a team.
+ *
+ * Writers are queued in a lock as returned by \ref dart_team_lock_init and
+ * have precedence over arriving readers. Readers only perform a single
+ * atomic operation on the lock unless a writer holds or waits for it.
+ * \ingroup DartSync
+ */
+typedef struct dart_rwlock_struct *dart_rwlock_t;
+
+/**
+ * Collective operation to initialize the reader-writer \c lock object.
+ *
+ * \param teamid Team this lock is used for.
+ * \param lock   The lock to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_init(
+  dart_team_t     teamid,
+  dart_rwlock_t * lock)   DART_NOTHROW;
+
+/**
+ * Collective operation to destroy a \c lock initialized using
+ * \ref dart_team_rwlock_init.
+ *
+ * \param lock   The \c lock to free.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_destroy(
+  dart_rwlock_t * lock)   DART_NOTHROW;
+
+/**
+ * Block until the \c lock was acquired for shared (read) access.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire_read(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Release shared access to the lock acquired through
+ * \ref dart_rwlock_acquire_read.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_release_read(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Block until the \c lock was acquired for exclusive (write) access.
+ *
+ * Note that the lock is not recursive, trying to acquire the lock twice
+ * in the same thread is erroneous.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire_write(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Release exclusive access to the lock acquired through
+ * \ref dart_rwlock_acquire_write.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_release_write(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
 /** \endcond */
@@ -6,6 +6,7 @@
 #define DART_ADAPT_COMMUNICATION_PRIV_H_INCLUDED
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <mpi.h>
 
 #include <dash/dart/base/macro.h>
@@ -17,17 +18,86 @@
 DART_INTERNAL
 int dart__mpi__datatype_sizes[DART_TYPE_COUNT];
 
-/** DART handle type for non-blocking one-sided operations. */
+/**
+ * DART handle type for non-blocking one-sided and collective operations.
+ * Handles of collective operations do not refer to a window
+ * (\c win is \c MPI_WIN_NULL) and may own temporary buffers that are
+ * released together with the handle.
+ */
 struct dart_handle_struct
 {
   MPI_Request request;
   MPI_Win     win;
   dart_unit_t dest;
+  /** Temporary buffer owned by the handle, may be \c NULL */
+  void      * buf;
 };
 
+/**
+ * Releases a DART handle and the temporary buffer owned by it.
+ */
+static inline
+void dart__mpi__handle_free(dart_handle_t handle)
+{
+  if (handle != NULL) {
+    free(handle->buf);
+    free(handle);
+  }
+}
+
+/**
+ * Minimum number of distinct target units of a window at which remote
+ * completion of operations uses \c MPI_Win_flush_all instead of
+ * \c MPI_Win_flush per target.
+ */
+#define DART__MPI__FLUSH_ALL_MIN_TARGETS 16
+
+/**
+ * Target of one-sided operations that require a flush for remote
+ * completion.
+ */
+typedef struct
+{
+  MPI_Win win;
+  int     dest;
+} dart__mpi__flush_target_t;
+
+/**
+ * Handle group, records the targets of one-sided operations added to the
+ * group. Operations are issued without MPI requests and completed by a
+ * flush of every distinct target.
+ */
+struct dart_handle_group_struct
+{
+  dart__mpi__flush_target_t * targets;
+  size_t                      num_targets;
+  size_t                      capacity;
+};
+
+/**
+ * Layout of a non-contiguous region in global memory as accessed in
+ * strided and indexed transfers. All values are in number of elements.
+ * Strided layouts specify \c nelem_block and \c stride, indexed layouts
+ * specify the arrays \c nelem_blocks and \c displs instead.
+ */
+typedef struct
+{
+  size_t         nblocks;
+  size_t         nelem_block;
+  size_t         stride;
+  const size_t * nelem_blocks;
+  const size_t * displs;
+} dart__mpi__layout_t;
+
 dart_ret_t
 dart__mpi__datatype_init() DART_INTERNAL;
 
+/**
+ * Releases MPI datatypes cached for strided and indexed transfers.
+ */
+dart_ret_t
+dart__mpi__datatype_fini() DART_INTERNAL;
+
 static inline MPI_Op dart__mpi__op(dart_operation_t dart_op) {
   switch (dart_op) {
     case DART_OP_MIN     : return MPI_MIN;
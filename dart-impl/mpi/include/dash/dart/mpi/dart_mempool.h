@@ -0,0 +1,90 @@
+/**
+ * \file dart_mempool.h
+ *
+ * Memory pool for local allocations in \c dart_memalloc.
+ *
+ * Small requests are served from slabs of fixed-size blocks in size
+ * classes spaced 16 bytes apart up to 64 bytes and four per power of two
+ * above, so at most 20% of a block larger than 64 bytes is lost to
+ * rounding. Blocks of more than 8 bytes are aligned to 16 bytes. Freed blocks are kept in per-thread caches and exchanged
+ * with the shared slabs in batches, only refilling and draining a cache
+ * requires the pool mutex. Slabs and large requests are allocated from
+ * buddy allocators (see \c dart_mem.h).
+ *
+ * The pool initially consists of the memory of the window
+ * \c dart_win_local_alloc (segment \c DART_SEGMENT_LOCAL). When it is
+ * exhausted, the pool grows by extension arenas attached to the dynamic
+ * window of \c DART_TEAM_ALL in a registered segment in which offsets are
+ * absolute addresses.
+ *
+ * The size of the initial pool is read from the environment variable
+ * \c DART_LOCAL_ALLOC_SIZE (in bytes, suffixes \c K, \c M and \c G are
+ * accepted), extension arenas are disabled by setting
+ * \c DART_LOCAL_ALLOC_EXTEND to \c 0.
+ */
+#ifndef DART__MPI__DART_MEMPOOL_H__
+#define DART__MPI__DART_MEMPOOL_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/base/macro.h>
+
+#include <mpi.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/** Default size of the initial local memory pool in bytes */
+#define DART_LOCAL_ALLOC_SIZE           (1024*1024*16)
+/** Environment variable overriding the initial local memory pool size */
+#define DART_LOCAL_ALLOC_SIZE_ENVSTR    "DART_LOCAL_ALLOC_SIZE"
+/** Environment variable enabling (default) or disabling pool growth */
+#define DART_LOCAL_ALLOC_EXTEND_ENVSTR  "DART_LOCAL_ALLOC_EXTEND"
+
+/**
+ * Size of the initial local memory pool in bytes as configured in the
+ * environment, a power of two.
+ */
+size_t dart__mpi__mempool_size() DART_INTERNAL;
+
+/**
+ * Initializes the local memory pool managing \c size bytes of the window
+ * \c dart_win_local_alloc.
+ * Must be called by all units after the team \c DART_TEAM_ALL has been
+ * set up as the segment of extension arenas is registered collectively.
+ */
+dart_ret_t dart__mpi__mempool_init(size_t size) DART_INTERNAL;
+
+/**
+ * Detaches and frees all extension arenas and releases the pool.
+ */
+dart_ret_t dart__mpi__mempool_fini() DART_INTERNAL;
+
+/**
+ * Allocates \c nbytes from the local memory pool.
+ *
+ * \param nbytes  Number of bytes to allocate.
+ * \param segid   Segment of the allocated memory.
+ * \param offset  Offset of the allocated memory in the segment.
+ */
+dart_ret_t dart__mpi__mempool_alloc(
+  size_t     nbytes,
+  int16_t  * segid,
+  uint64_t * offset) DART_INTERNAL;
+
+/**
+ * Returns memory allocated in \c dart__mpi__mempool_alloc to the pool.
+ */
+dart_ret_t dart__mpi__mempool_free(
+  int16_t    segid,
+  uint64_t   offset) DART_INTERNAL;
+
+/**
+ * Window and displacement of the memory referenced by a global pointer
+ * returned from \c dart_memalloc.
+ */
+dart_ret_t dart__mpi__mempool_target(
+  dart_gptr_t   gptr,
+  MPI_Win     * win,
+  MPI_Aint    * disp) DART_INTERNAL;
+
+#endif /* DART__MPI__DART_MEMPOOL_H__ */
@@ -14,7 +14,8 @@
 
 typedef int16_t dart_segid_t;
 
-#define DART_SEGMENT_HASH_SIZE 256
+/** Initial number of entries in the segment tables, grown on demand */
+#define DART_SEGMENT_TABLE_INIT_SIZE 256
 
 typedef struct
 {
@@ -28,13 +29,21 @@ typedef struct
 } dart_segment_info_t;
 
 // forward declaration to make the compiler happy
-typedef struct dart_seghash_elem dart_seghash_elem_t;
+typedef struct dart_segment_elem dart_segment_elem_t;
 
 typedef struct {
-  dart_seghash_elem_t * hashtab[DART_SEGMENT_HASH_SIZE];
-  dart_team_t           team_id;
-  dart_seghash_elem_t * mem_freelist;
-  dart_seghash_elem_t * reg_freelist;
+  /**
+   * Segments directly indexed by segment ID: allocated segments
+   * (IDs >= 0) at index \c segid in \c mem_segs, registered segments
+   * (IDs < 0) at index \c -segid in \c reg_segs.
+   */
+  dart_segment_elem_t ** mem_segs;
+  dart_segment_elem_t ** reg_segs;
+  size_t                 mem_segs_size;
+  size_t                 reg_segs_size;
+  dart_team_t            team_id;
+  dart_segment_elem_t  * mem_freelist;
+  dart_segment_elem_t  * reg_freelist;
 
   /**
    * For DART collective allocation/free: offset in the returned gptr
@@ -56,7 +65,7 @@ typedef enum {
 
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment tables.
  */
 dart_ret_t dart_segment_init(
   dart_segmentdata_t *segdata,
@@ -155,7 +164,7 @@ dart_ret_t dart_segment_free(
 
 
 /**
- * Clear the segment data hash table.
+ * Clear the segment tables.
  */
 dart_ret_t dart_segment_fini(dart_segmentdata_t *segdata) DART_INTERNAL;
 
@@ -151,6 +151,18 @@ extern MPI_Comm dart_comm_world DART_INTERNAL;
 
 #define DART_MAX_TEAM_NUMBER (256)
 
+/**
+ * Synchronization mode of one-sided operations on a team's window.
+ */
+typedef enum {
+  /// Passive-target synchronization with lock_all and flush (default)
+  DART_MPI_EPOCH_PASSIVE = 0,
+  /// Active-target synchronization with fence
+  DART_MPI_EPOCH_FENCE,
+  /// Active-target synchronization with post, start, complete, wait
+  DART_MPI_EPOCH_PSCW
+} dart_mpi_epoch_t;
+
 typedef struct dart_team_data {
 
   struct dart_team_data *next;
@@ -160,6 +172,12 @@ typedef struct dart_team_data {
    */
   MPI_Comm comm;
 
+  /**
+   * @brief Duplicate of \c comm for point-to-point messages of collective
+   * operations, which must not be matched by user messages.
+   */
+  MPI_Comm coll_comm;
+
   /**
    * @brief MPI dynamic window object corresponding this team.
    */
@@ -167,6 +185,17 @@ typedef struct dart_team_data {
 
   dart_segmentdata_t segdata;
 
+  /**
+   * @brief Synchronization mode of the current epoch on \c window.
+   */
+  dart_mpi_epoch_t epoch;
+
+  /**
+   * @brief Groups of origin and target units of an open PSCW epoch.
+   */
+  MPI_Group pscw_origin_group;
+  MPI_Group pscw_target_group;
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   /**
    * @brief Store the sub-communicator with regard to certain node, where the units can
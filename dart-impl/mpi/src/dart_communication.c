@@ -22,6 +22,7 @@
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/math.h>
+#include <dash/dart/base/mutex.h>
 
 #include <stdio.h>
 #include <mpi.h>
@@ -46,6 +47,191 @@ dart__mpi__datatype_init()
   return DART_OK;
 }
 
+/*
+ * Cache of MPI derived datatypes describing non-contiguous target layouts
+ * of strided and indexed transfers. Halo exchanges and similar patterns
+ * repeatedly transfer the same layout, so types are created and committed
+ * once and reused until dart_exit.
+ */
+
+#define DART_MPI_DTCACHE_SIZE         64
+#define DART_MPI_DTCACHE_MAX_ENTRIES  1024
+
+typedef struct dart__mpi__dtcache_elem {
+  struct dart__mpi__dtcache_elem * next;
+  dart_datatype_t                  dtype;
+  size_t                           nblocks;
+  /* Strided layouts: */
+  size_t                           nelem_block;
+  size_t                           stride;
+  /* Indexed layouts, NULL for strided layouts: */
+  size_t                         * nelem_blocks;
+  size_t                         * displs;
+  MPI_Datatype                     mpi_type;
+} dart__mpi__dtcache_elem_t;
+
+static dart__mpi__dtcache_elem_t * _dtcache[DART_MPI_DTCACHE_SIZE];
+static int                         _dtcache_nentries = 0;
+static dart_mutex_t                _dtcache_mutex    = DART_MUTEX_INITIALIZER;
+
+static inline size_t dtcache_hash_combine(size_t seed, size_t value)
+{
+  return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+static int dtcache_slot(const dart__mpi__layout_t * layout,
+                        dart_datatype_t             dtype)
+{
+  size_t h = dtcache_hash_combine(dtype, layout->nblocks);
+  if (layout->displs == NULL) {
+    h = dtcache_hash_combine(h, layout->nelem_block);
+    h = dtcache_hash_combine(h, layout->stride);
+  } else {
+    for (size_t i = 0; i < layout->nblocks; ++i) {
+      h = dtcache_hash_combine(h, layout->nelem_blocks[i]);
+      h = dtcache_hash_combine(h, layout->displs[i]);
+    }
+  }
+  return (int)(h % DART_MPI_DTCACHE_SIZE);
+}
+
+static int dtcache_match(const dart__mpi__dtcache_elem_t * elem,
+                         const dart__mpi__layout_t       * layout,
+                         dart_datatype_t                   dtype)
+{
+  if (elem->dtype != dtype || elem->nblocks != layout->nblocks ||
+      (elem->displs == NULL) != (layout->displs == NULL)) {
+    return 0;
+  }
+  if (layout->displs == NULL) {
+    return (elem->nelem_block == layout->nelem_block &&
+            elem->stride      == layout->stride);
+  }
+  return (memcmp(elem->nelem_blocks, layout->nelem_blocks,
+                 layout->nblocks * sizeof(size_t)) == 0 &&
+          memcmp(elem->displs, layout->displs,
+                 layout->nblocks * sizeof(size_t)) == 0);
+}
+
+static dart_ret_t dtcache_create_type(
+  const dart__mpi__layout_t * layout,
+  dart_datatype_t             dtype,
+  MPI_Datatype              * mpi_type)
+{
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  int          ret;
+  if (layout->displs == NULL) {
+    if (layout->nblocks     > INT_MAX ||
+        layout->nelem_block > INT_MAX ||
+        layout->stride      > INT_MAX) {
+      DART_LOG_ERROR("dart__mpi__layout_type ! "
+                     "strided layout exceeds INT_MAX");
+      return DART_ERR_INVAL;
+    }
+    ret = MPI_Type_vector(layout->nblocks, layout->nelem_block,
+                          layout->stride, mpi_dtype, mpi_type);
+  } else {
+    int * blocklens = malloc(sizeof(int) * layout->nblocks);
+    int * displs    = malloc(sizeof(int) * layout->nblocks);
+    for (size_t i = 0; i < layout->nblocks; ++i) {
+      if (layout->nelem_blocks[i] > INT_MAX || layout->displs[i] > INT_MAX) {
+        DART_LOG_ERROR("dart__mpi__layout_type ! "
+                       "indexed layout exceeds INT_MAX in block %zu", i);
+        free(blocklens);
+        free(displs);
+        return DART_ERR_INVAL;
+      }
+      blocklens[i] = layout->nelem_blocks[i];
+      displs[i]    = layout->displs[i];
+    }
+    ret = MPI_Type_indexed(layout->nblocks, blocklens, displs,
+                           mpi_dtype, mpi_type);
+    free(blocklens);
+    free(displs);
+  }
+  if (ret != MPI_SUCCESS || MPI_Type_commit(mpi_type) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__layout_type ! "
+                   "failed to create derived datatype");
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+/**
+ * Returns an MPI datatype describing the given layout of elements of type
+ * \c dtype. If \c is_cached is false after the call, the caller owns the
+ * returned type and has to free it once the communication using it has
+ * been started.
+ */
+static dart_ret_t dart__mpi__layout_type(
+  const dart__mpi__layout_t * layout,
+  dart_datatype_t             dtype,
+  MPI_Datatype              * mpi_type,
+  int                       * is_cached)
+{
+  int slot   = dtcache_slot(layout, dtype);
+  *is_cached = 0;
+
+  dart__base__mutex_lock(&_dtcache_mutex);
+  for (dart__mpi__dtcache_elem_t * elem = _dtcache[slot];
+       elem != NULL; elem = elem->next) {
+    if (dtcache_match(elem, layout, dtype)) {
+      *mpi_type  = elem->mpi_type;
+      *is_cached = 1;
+      dart__base__mutex_unlock(&_dtcache_mutex);
+      return DART_OK;
+    }
+  }
+
+  dart_ret_t ret = dtcache_create_type(layout, dtype, mpi_type);
+  if (ret != DART_OK || _dtcache_nentries >= DART_MPI_DTCACHE_MAX_ENTRIES) {
+    dart__base__mutex_unlock(&_dtcache_mutex);
+    return ret;
+  }
+
+  dart__mpi__dtcache_elem_t * elem = calloc(1, sizeof(*elem));
+  elem->dtype    = dtype;
+  elem->nblocks  = layout->nblocks;
+  elem->mpi_type = *mpi_type;
+  if (layout->displs == NULL) {
+    elem->nelem_block = layout->nelem_block;
+    elem->stride      = layout->stride;
+  } else {
+    size_t nbytes      = layout->nblocks * sizeof(size_t);
+    elem->nelem_blocks = malloc(nbytes);
+    elem->displs       = malloc(nbytes);
+    memcpy(elem->nelem_blocks, layout->nelem_blocks, nbytes);
+    memcpy(elem->displs,       layout->displs,       nbytes);
+  }
+  elem->next    = _dtcache[slot];
+  _dtcache[slot] = elem;
+  _dtcache_nentries++;
+  *is_cached = 1;
+  dart__base__mutex_unlock(&_dtcache_mutex);
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__datatype_fini()
+{
+  dart__base__mutex_lock(&_dtcache_mutex);
+  for (int slot = 0; slot < DART_MPI_DTCACHE_SIZE; ++slot) {
+    dart__mpi__dtcache_elem_t * elem = _dtcache[slot];
+    while (elem != NULL) {
+      dart__mpi__dtcache_elem_t * next = elem->next;
+      MPI_Type_free(&elem->mpi_type);
+      free(elem->nelem_blocks);
+      free(elem->displs);
+      free(elem);
+      elem = next;
+    }
+    _dtcache[slot] = NULL;
+  }
+  _dtcache_nentries = 0;
+  dart__base__mutex_unlock(&_dtcache_mutex);
+  return DART_OK;
+}
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 static dart_ret_t get_shared_mem(
   dart_team_data_t * team_data,
@@ -82,6 +268,24 @@ static dart_ret_t get_shared_mem(
 }
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+/**
+ * Fails if the team-aligned memory referenced by \c gptr is synchronized
+ * in an active-target epoch, in which operations completed by requests or
+ * flushes are erroneous.
+ */
+static inline dart_ret_t dart__mpi__check_passive_epoch(
+  const char             * caller,
+  dart_gptr_t              gptr,
+  const dart_team_data_t * team_data)
+{
+  if (gptr.segid != 0 && team_data->epoch != DART_MPI_EPOCH_PASSIVE) {
+    DART_LOG_ERROR("%s ! failed: team %d in active-target epoch",
+                   caller, gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
 dart_ret_t dart_get(
   void            * dest,
   dart_gptr_t       gptr,
@@ -522,6 +726,10 @@ dart_ret_t dart_get_handle(
     DART_LOG_ERROR("dart_get_handle ! failed: Unknown team %i!", gptr.teamid);
     return DART_ERR_INVAL;
   }
+  if (dart__mpi__check_passive_epoch("dart_get_handle", gptr, team_data)
+        != DART_OK) {
+    return DART_ERR_INVAL;
+  }
 
   DART_LOG_DEBUG("dart_get_handle() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
                  team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
@@ -531,21 +739,11 @@ dart_ret_t dart_get_handle(
   DART_LOG_DEBUG("dart_get_handle: shared windows enabled");
 
   if (seg_id >= 0 && team_data->sharedmem_tab[gptr.unitid].id >= 0) {
-    dart_ret_t ret = get_shared_mem(team_data, dest, gptr, nelem, dtype);
-
     /*
-     * Mark request as completed:
+     * Target is in the same shared memory domain, the transfer is
+     * completed by memcpy and no handle is allocated:
      */
-    *handle            = malloc(sizeof(struct dart_handle_struct));
-    (*handle)->request = MPI_REQUEST_NULL;
-    if (seg_id != 0) {
-      (*handle)->dest = team_unit_id.id;
-      (*handle)->win = team_data->window;
-    } else {
-      (*handle)->dest = team_unit_id.id;
-      (*handle)->win  = dart_win_local_alloc;
-    }
-    return ret;
+    return get_shared_mem(team_data, dest, gptr, nelem, dtype);
   }
 #else
   DART_LOG_DEBUG("dart_get_handle: shared windows disabled");
@@ -601,7 +799,7 @@ dart_ret_t dart_get_handle(
     DART_LOG_ERROR("dart_get_handle ! MPI_Rget failed");
     return DART_ERR_INVAL;
   }
-  *handle            = malloc(sizeof(struct dart_handle_struct));
+  *handle            = calloc(1, sizeof(struct dart_handle_struct));
   (*handle)->dest    = team_unit_id.id;
   (*handle)->request = mpi_req;
   (*handle)->win     = win;
@@ -647,6 +845,10 @@ dart_ret_t dart_put_handle(
       DART_LOG_ERROR("dart_put_handle ! failed: Unknown team %i!", gptr.teamid);
       return DART_ERR_INVAL;
     }
+    if (dart__mpi__check_passive_epoch("dart_put_handle", gptr, team_data)
+          != DART_OK) {
+      return DART_ERR_INVAL;
+    }
 
     win = team_data->window;
 
@@ -688,7 +890,7 @@ dart_ret_t dart_put_handle(
     DART_LOG_ERROR("dart_put_handle ! MPI_Rput failed");
     return DART_ERR_INVAL;
   }
-  *handle = malloc(sizeof(struct dart_handle_struct));
+  *handle = calloc(1, sizeof(struct dart_handle_struct));
   (*handle) -> dest    = team_unit_id.id;
   (*handle) -> request = mpi_req;
   (*handle) -> win     = win;
@@ -730,6 +932,10 @@ dart_ret_t dart_put_blocking(
     DART_LOG_ERROR("dart_put_blocking ! failed: Unknown team %i!", gptr.teamid);
     return DART_ERR_INVAL;
   }
+  if (dart__mpi__check_passive_epoch("dart_put_blocking", gptr, team_data)
+        != DART_OK) {
+    return DART_ERR_INVAL;
+  }
 
   DART_LOG_DEBUG("dart_put_blocking() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
                  team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
@@ -882,6 +1088,10 @@ dart_ret_t dart_get_blocking(
     DART_LOG_ERROR("dart_get_blocking ! failed: Unknown team %i!", gptr.teamid);
     return DART_ERR_INVAL;
   }
+  if (dart__mpi__check_passive_epoch("dart_get_blocking", gptr, team_data)
+        != DART_OK) {
+    return DART_ERR_INVAL;
+  }
 
   DART_LOG_DEBUG("dart_get_blocking() uid:%d "
                  "o:%"PRIu64" s:%d t:%u, nelem:%zu",
@@ -978,618 +1188,1972 @@ dart_ret_t dart_get_blocking(
   return DART_OK;
 }
 
-/* -- Dart RMA Synchronization Operations -- */
-
-dart_ret_t dart_flush(
-  dart_gptr_t gptr)
-{
-  MPI_Win          win;
-  MPI_Comm         comm         = DART_COMM_WORLD;
-  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
-  int16_t          seg_id       = gptr.segid;
-  DART_LOG_DEBUG("dart_flush() gptr: "
-                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
-                 gptr.unitid, gptr.addr_or_offs.offset,
-                 gptr.segid,  gptr.teamid);
+/* -- Strided and indexed dart one-sided operations -- */
 
-  if (gptr.unitid < 0) {
-    DART_LOG_ERROR("dart_flush ! failed: gptr.unitid < 0");
-    return DART_ERR_INVAL;
-  }
+typedef enum {
+  DART_MPI_SYNC_REGULAR,
+  DART_MPI_SYNC_HANDLE,
+  DART_MPI_SYNC_BLOCKING,
+  DART_MPI_SYNC_GROUP
+} dart__mpi__sync_t;
 
-  if (seg_id) {
-    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
-    if (team_data == NULL) {
-      DART_LOG_ERROR("dart_flush ! failed: Unknown team %i!", gptr.teamid);
-      return DART_ERR_INVAL;
+/**
+ * Adds the target of an operation to a handle group unless it is the
+ * target of the previous operation in the group.
+ */
+static dart_ret_t dart__mpi__group_add_target(
+  dart_handle_group_t group,
+  MPI_Win             win,
+  int                 dest)
+{
+  if (group->num_targets > 0) {
+    dart__mpi__flush_target_t * last =
+      &group->targets[group->num_targets - 1];
+    if (last->dest == dest &&
+        memcmp(&last->win, &win, sizeof(MPI_Win)) == 0) {
+      return DART_OK;
     }
-    win = team_data->window;
-    comm = team_data->comm;
-  } else {
-    win = dart_win_local_alloc;
-  }
-
-  DART_LOG_TRACE("dart_flush: MPI_Win_flush");
-  if (MPI_Win_flush(team_unit_id.id, win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush ! MPI_Win_flush failed!");
-    return DART_ERR_OTHER;
   }
-  DART_LOG_TRACE("dart_flush: MPI_Win_sync");
-  if (MPI_Win_sync(win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush ! MPI_Win_sync failed!");
-    return DART_ERR_OTHER;
+  if (group->num_targets == group->capacity) {
+    size_t capacity = (group->capacity > 0) ? 2 * group->capacity : 16;
+    dart__mpi__flush_target_t * targets =
+      realloc(group->targets, capacity * sizeof(dart__mpi__flush_target_t));
+    if (targets == NULL) {
+      DART_LOG_ERROR("dart__mpi__group_add_target ! realloc failed");
+      return DART_ERR_OTHER;
+    }
+    group->targets  = targets;
+    group->capacity = capacity;
   }
-
-  // trigger progress
-  int flag;
-  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE);
-
-  DART_LOG_DEBUG("dart_flush > finished");
+  group->targets[group->num_targets].win  = win;
+  group->targets[group->num_targets].dest = dest;
+  group->num_targets++;
   return DART_OK;
 }
 
-dart_ret_t dart_flush_all(
-  dart_gptr_t gptr)
+static int dart__mpi__flush_target_cmp(const void * lhs, const void * rhs)
 {
-  MPI_Win  win;
-  MPI_Comm comm   = DART_COMM_WORLD;
-  int16_t  seg_id = gptr.segid;
-  DART_LOG_DEBUG("dart_flush_all() gptr: "
-                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
-                 gptr.unitid, gptr.addr_or_offs.offset,
-                 gptr.segid,  gptr.teamid);
-  if (gptr.unitid < 0) {
-    DART_LOG_ERROR("dart_flush_all ! failed: gptr.unitid < 0");
-    return DART_ERR_INVAL;
+  const dart__mpi__flush_target_t * a = lhs;
+  const dart__mpi__flush_target_t * b = rhs;
+  int cmp = memcmp(&a->win, &b->win, sizeof(MPI_Win));
+  if (cmp != 0) {
+    return cmp;
   }
+  return (a->dest > b->dest) - (a->dest < b->dest);
+}
 
-  if (seg_id) {
-    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
-    if (team_data == NULL) {
-      DART_LOG_ERROR("dart_flush_all ! failed: Unknown team %i!", gptr.teamid);
-      return DART_ERR_INVAL;
-    }
-
-    win  = team_data->window;
-    comm = team_data->comm;
-  } else {
-    win = dart_win_local_alloc;
-  }
-  DART_LOG_TRACE("dart_flush_all: MPI_Win_flush_all");
-  if (MPI_Win_flush_all(win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_all failed!");
-    return DART_ERR_OTHER;
+/**
+ * Waits for remote completion of operations on the given targets.
+ * Every distinct target is flushed once, windows with at least
+ * \c DART__MPI__FLUSH_ALL_MIN_TARGETS distinct targets are flushed with
+ * a single call of \c MPI_Win_flush_all.
+ * The target array is sorted in place.
+ */
+static dart_ret_t dart__mpi__flush_targets(
+  const char                * caller,
+  dart__mpi__flush_target_t * targets,
+  size_t                      num_targets)
+{
+  if (num_targets == 0) {
+    return DART_OK;
   }
-  DART_LOG_TRACE("dart_flush_all: MPI_Win_sync");
-  if (MPI_Win_sync(win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush_all ! MPI_Win_sync failed!");
-    return DART_ERR_OTHER;
+  qsort(targets, num_targets, sizeof(dart__mpi__flush_target_t),
+        dart__mpi__flush_target_cmp);
+  size_t first = 0;
+  while (first < num_targets) {
+    MPI_Win win         = targets[first].win;
+    size_t  last        = first;
+    size_t  num_distinct = 0;
+    while (last < num_targets &&
+           memcmp(&targets[last].win, &win, sizeof(MPI_Win)) == 0) {
+      if (last == first || targets[last].dest != targets[last - 1].dest) {
+        num_distinct++;
+      }
+      last++;
+    }
+    if (num_distinct >= DART__MPI__FLUSH_ALL_MIN_TARGETS) {
+      DART_LOG_DEBUG("%s: MPI_Win_flush_all, %zu targets",
+                     caller, num_distinct);
+      if (MPI_Win_flush_all(win) != MPI_SUCCESS) {
+        DART_LOG_ERROR("%s ! MPI_Win_flush_all failed", caller);
+        return DART_ERR_INVAL;
+      }
+    } else {
+      for (size_t t = first; t < last; ++t) {
+        if (t > first && targets[t].dest == targets[t - 1].dest) {
+          continue;
+        }
+        DART_LOG_TRACE("%s: MPI_Win_flush(%d)", caller, targets[t].dest);
+        if (MPI_Win_flush(targets[t].dest, win) != MPI_SUCCESS) {
+          DART_LOG_ERROR("%s ! MPI_Win_flush failed", caller);
+          return DART_ERR_INVAL;
+        }
+      }
+    }
+    first = last;
   }
-
-  // trigger progress
-  int flag;
-  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE);
-
-  DART_LOG_DEBUG("dart_flush_all > finished");
   return DART_OK;
 }
 
-dart_ret_t dart_flush_local(
-  dart_gptr_t gptr)
+/**
+ * Resolves the target of a global pointer.
+ * If the referenced memory is directly accessible by the calling unit
+ * (same unit or shared memory window on the same node), its address is
+ * returned in \c local_addr. Otherwise, \c local_addr is set to \c NULL
+ * and \c win and \c disp specify the target location for MPI RMA
+ * operations.
+ */
+static dart_ret_t dart__mpi__resolve_gptr(
+  const char   * caller,
+  dart_gptr_t    gptr,
+  MPI_Win      * win,
+  MPI_Aint     * disp,
+  char        ** local_addr)
 {
-  MPI_Win  win;
-  MPI_Comm comm   = DART_COMM_WORLD;
-  int16_t  seg_id = gptr.segid;
+  uint64_t         offset       = gptr.addr_or_offs.offset;
+  int16_t          seg_id       = gptr.segid;
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
 
-  DART_LOG_DEBUG("dart_flush_local() gptr: "
-                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
-                 gptr.unitid, gptr.addr_or_offs.offset,
-                 gptr.segid,  gptr.teamid);
+  *local_addr = NULL;
 
-  if (gptr.unitid < 0) {
-    DART_LOG_ERROR("dart_flush_local ! failed: gptr.unitid < 0");
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("%s ! failed: Unknown team %i!", caller, gptr.teamid);
     return DART_ERR_INVAL;
   }
 
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (seg_id >= 0 && team_data->sharedmem_tab[gptr.unitid].id >= 0) {
+    dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
+    char * baseptr;
+    if (seg_id) {
+      if (dart_segment_get_baseptr(
+            &team_data->segdata, seg_id, luid, &baseptr) != DART_OK) {
+        DART_LOG_ERROR("%s ! dart_segment_get_baseptr failed", caller);
+        return DART_ERR_INVAL;
+      }
+    } else {
+      baseptr = dart_sharedmem_local_baseptr_set[luid.id];
+    }
+    *local_addr = baseptr + offset;
+    return DART_OK;
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
   if (seg_id) {
-    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
-    if (team_data == NULL) {
-      DART_LOG_ERROR("dart_flush_local ! failed: Unknown team %i!", gptr.segid);
+    MPI_Aint disp_s;
+    if (dart_segment_get_disp(
+          &team_data->segdata,
+          seg_id,
+          team_unit_id,
+          &disp_s) != DART_OK) {
+      DART_LOG_ERROR("%s ! dart_segment_get_disp failed", caller);
       return DART_ERR_INVAL;
     }
-
-    win = team_data->window;
-    comm = team_data->comm;
-    DART_LOG_DEBUG("dart_flush_local() win:%"PRIu64" seg:%d unit:%d",
-                   (unsigned long)win, seg_id, team_unit_id.id);
+    if (team_data->unitid == team_unit_id.id) {
+      *local_addr = ((char *)disp_s) + offset;
+      return DART_OK;
+    }
+    *win  = team_data->window;
+    *disp = disp_s + offset;
   } else {
-    win = dart_win_local_alloc;
-    DART_LOG_DEBUG("dart_flush_local() lwin:%"PRIu64" seg:%d unit:%d",
-                   (unsigned long)win, seg_id, team_unit_id.id);
-  }
-  DART_LOG_TRACE("dart_flush_local: MPI_Win_flush_local");
-  if (MPI_Win_flush_local(team_unit_id.id, win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_local failed!");
-    return DART_ERR_OTHER;
+    if (team_data->unitid == team_unit_id.id) {
+      *local_addr = dart_mempool_localalloc + offset;
+      return DART_OK;
+    }
+    *win  = dart_win_local_alloc;
+    *disp = offset;
   }
-
-  // trigger progress
-  int flag;
-  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE);
-
-  DART_LOG_DEBUG("dart_flush_local > finished");
   return DART_OK;
 }
 
-dart_ret_t dart_flush_local_all(
-  dart_gptr_t gptr)
+static dart_ret_t dart__mpi__rma_layout(
+  const char                * caller,
+  int                         is_put,
+  void                      * dest,
+  const void                * src,
+  dart_gptr_t                 gptr,
+  const dart__mpi__layout_t * layout,
+  dart_datatype_t             dtype,
+  dart__mpi__sync_t           sync,
+  dart_handle_t             * handle,
+  dart_handle_group_t         group)
 {
-  MPI_Win  win;
-  MPI_Comm comm   = DART_COMM_WORLD;
-  int16_t  seg_id = gptr.segid;
-  DART_LOG_DEBUG("dart_flush_local_all() gptr: "
-                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
-                 gptr.unitid, gptr.addr_or_offs.offset,
-                 gptr.segid,  gptr.teamid);
+  MPI_Win          win          = MPI_WIN_NULL;
+  MPI_Aint         disp         = 0;
+  char           * local_addr   = NULL;
+  MPI_Datatype     mpi_dtype    = dart__mpi__datatype(dtype);
+  int              dtype_size   = dart__mpi__datatype_sizeof(dtype);
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  size_t           nelem        = 0;
+
+  if (handle != NULL) {
+    *handle = NULL;
+  }
+  if (sync == DART_MPI_SYNC_GROUP && group == NULL) {
+    DART_LOG_ERROR("%s ! failed: group must not be NULL", caller);
+    return DART_ERR_INVAL;
+  }
 
   if (gptr.unitid < 0) {
-    DART_LOG_ERROR("dart_flush_local_all ! failed: gptr.unitid < 0");
+    DART_LOG_ERROR("%s ! failed: gptr.unitid < 0", caller);
+    return DART_ERR_INVAL;
+  }
+  if (dtype_size < 0) {
+    DART_LOG_ERROR("%s ! failed: invalid data type %d", caller, dtype);
     return DART_ERR_INVAL;
   }
 
+  if (layout->displs == NULL) {
+    nelem = layout->nblocks * layout->nelem_block;
+  } else {
+    for (size_t b = 0; b < layout->nblocks; ++b) {
+      nelem += layout->nelem_blocks[b];
+    }
+  }
 
-  if (seg_id) {
-    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
-    if (team_data == NULL) {
-      DART_LOG_ERROR("dart_flush_local_all ! failed: Unknown team %i!",
-                          gptr.teamid);
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("%s ! failed: nelem > INT_MAX", caller);
+    return DART_ERR_INVAL;
+  }
+
+  DART_LOG_DEBUG("%s() uid:%d o:%"PRIu64" s:%d t:%d nblocks:%zu nelem:%zu",
+                 caller, team_unit_id.id, gptr.addr_or_offs.offset,
+                 gptr.segid, gptr.teamid, layout->nblocks, nelem);
+
+  if (sync != DART_MPI_SYNC_REGULAR && gptr.segid != 0) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+    if (team_data != NULL &&
+        dart__mpi__check_passive_epoch(caller, gptr, team_data) != DART_OK) {
       return DART_ERR_INVAL;
     }
-    win  = team_data->window;
-    comm = team_data->comm;
+  }
+
+  dart_ret_t ret = dart__mpi__resolve_gptr(
+                     caller, gptr, &win, &disp, &local_addr);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
+  if (local_addr != NULL) {
+    /*
+     * Target memory is accessible directly, copy blocks using memcpy:
+     */
+    char       * ldest = dest;
+    const char * lsrc  = src;
+    for (size_t b = 0; b < layout->nblocks; ++b) {
+      size_t nbytes_block;
+      char * gaddr;
+      if (layout->displs == NULL) {
+        nbytes_block = layout->nelem_block * dtype_size;
+        gaddr        = local_addr + b * layout->stride * dtype_size;
+      } else {
+        nbytes_block = layout->nelem_blocks[b] * dtype_size;
+        gaddr        = local_addr + layout->displs[b] * dtype_size;
+      }
+      if (is_put) {
+        memcpy(gaddr, lsrc, nbytes_block);
+        lsrc  += nbytes_block;
+      } else {
+        memcpy(ldest, gaddr, nbytes_block);
+        ldest += nbytes_block;
+      }
+    }
+    DART_LOG_TRACE("%s: memcpy nblocks:%zu nelem:%zu",
+                   caller, layout->nblocks, nelem);
+    if (handle != NULL) {
+      /*
+       * Mark request as completed:
+       */
+      *handle            = calloc(1, sizeof(struct dart_handle_struct));
+      (*handle)->request = MPI_REQUEST_NULL;
+      (*handle)->dest    = team_unit_id.id;
+      (*handle)->win     = MPI_WIN_NULL;
+    }
+    return DART_OK;
+  }
+
+  MPI_Datatype target_type;
+  int          target_count = 1;
+  int          is_cached;
+  if (layout->displs == NULL && layout->nblocks == 1) {
+    /* contiguous transfer, no derived datatype required */
+    target_type  = mpi_dtype;
+    target_count = nelem;
+    is_cached    = 1;
   } else {
-    win = dart_win_local_alloc;
+    ret = dart__mpi__layout_type(layout, dtype, &target_type, &is_cached);
+    if (ret != DART_OK) {
+      return ret;
+    }
   }
-  if (MPI_Win_flush_local_all(win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_local_all failed!");
-    return DART_ERR_OTHER;
+
+  MPI_Request mpi_req = MPI_REQUEST_NULL;
+  int         mpi_ret;
+  if (is_put) {
+    if (sync == DART_MPI_SYNC_HANDLE) {
+      mpi_ret = MPI_Rput(src, nelem, mpi_dtype, team_unit_id.id,
+                         disp, target_count, target_type, win, &mpi_req);
+    } else {
+      mpi_ret = MPI_Put(src, nelem, mpi_dtype, team_unit_id.id,
+                        disp, target_count, target_type, win);
+    }
+  } else {
+    if (sync == DART_MPI_SYNC_REGULAR || sync == DART_MPI_SYNC_GROUP) {
+      mpi_ret = MPI_Get(dest, nelem, mpi_dtype, team_unit_id.id,
+                        disp, target_count, target_type, win);
+    } else {
+      mpi_ret = MPI_Rget(dest, nelem, mpi_dtype, team_unit_id.id,
+                         disp, target_count, target_type, win, &mpi_req);
+    }
+  }
+  if (!is_cached) {
+    /* communication using the type has been started, safe to release */
+    MPI_Type_free(&target_type);
+  }
+  if (mpi_ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("%s ! MPI RMA operation failed", caller);
+    return DART_ERR_INVAL;
   }
 
-  // trigger progress
-  int flag;
-  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE);
+  if (sync == DART_MPI_SYNC_HANDLE) {
+    *handle            = calloc(1, sizeof(struct dart_handle_struct));
+    (*handle)->request = mpi_req;
+    (*handle)->dest    = team_unit_id.id;
+    (*handle)->win     = win;
+  } else if (sync == DART_MPI_SYNC_GROUP) {
+    ret = dart__mpi__group_add_target(group, win, team_unit_id.id);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  } else if (sync == DART_MPI_SYNC_BLOCKING) {
+    if (!is_put &&
+        MPI_Wait(&mpi_req, MPI_STATUS_IGNORE) != MPI_SUCCESS) {
+      DART_LOG_ERROR("%s ! MPI_Wait failed", caller);
+      return DART_ERR_INVAL;
+    }
+    if (is_put &&
+        MPI_Win_flush(team_unit_id.id, win) != MPI_SUCCESS) {
+      DART_LOG_ERROR("%s ! MPI_Win_flush failed", caller);
+      return DART_ERR_INVAL;
+    }
+  }
 
-  DART_LOG_DEBUG("dart_flush_local_all > finished");
+  DART_LOG_DEBUG("%s > finished", caller);
   return DART_OK;
 }
 
-dart_ret_t dart_wait_local(
-  dart_handle_t handle)
+dart_ret_t dart_get_strided(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype)
 {
-  int mpi_ret;
-  DART_LOG_DEBUG("dart_wait_local() handle:%p", (void*)(handle));
-  if (handle != NULL) {
-    DART_LOG_TRACE("dart_wait_local:     handle->dest: %d",
-                   handle->dest);
-    DART_LOG_TRACE("dart_wait_local:     handle->win:  %p",
-                   (void*)(unsigned long)(handle->win));
-    DART_LOG_TRACE("dart_wait_local:     handle->req:  %ld",
-                   (long)handle->request);
-    if (handle->request != MPI_REQUEST_NULL) {
-      MPI_Status mpi_sta;
-      mpi_ret = MPI_Wait(&(handle->request), &mpi_sta);
-      DART_LOG_TRACE("dart_wait_local:        -- mpi_sta.MPI_SOURCE = %d",
-                     mpi_sta.MPI_SOURCE);
-      DART_LOG_TRACE("dart_wait_local:        -- mpi_sta.MPI_ERROR  = %d (%s)",
-                     mpi_sta.MPI_ERROR,
-                     DART__MPI__ERROR_STR(mpi_sta.MPI_ERROR));
-      if (mpi_ret != MPI_SUCCESS) {
-        DART_LOG_DEBUG("dart_wait_local ! MPI_Wait failed");
-        return DART_ERR_INVAL;
-      }
-    } else {
-      DART_LOG_TRACE("dart_wait_local:     handle->req == MPI_REQUEST_NULL");
-    }
-    /*
-     * Do not free handle resource, it could be needed for a following
-     * dart_wait() or dart_wait_all() to ensure remote completion.
-     */
+  dart__mpi__layout_t layout = { nblocks, nelem_block, stride, NULL, NULL };
+  return dart__mpi__rma_layout("dart_get_strided", 0, dest, NULL,
+                               gptr, &layout, dtype, DART_MPI_SYNC_REGULAR,
+                               NULL, NULL);
+}
+
+dart_ret_t dart_put_strided(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype)
+{
+  dart__mpi__layout_t layout = { nblocks, nelem_block, stride, NULL, NULL };
+  return dart__mpi__rma_layout("dart_put_strided", 1, NULL, src,
+                               gptr, &layout, dtype, DART_MPI_SYNC_REGULAR,
+                               NULL, NULL);
+}
+
+dart_ret_t dart_get_strided_handle(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype,
+  dart_handle_t   * handle)
+{
+  dart__mpi__layout_t layout = { nblocks, nelem_block, stride, NULL, NULL };
+  return dart__mpi__rma_layout("dart_get_strided_handle", 0, dest, NULL,
+                               gptr, &layout, dtype, DART_MPI_SYNC_HANDLE,
+                               handle, NULL);
+}
+
+dart_ret_t dart_put_strided_handle(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype,
+  dart_handle_t   * handle)
+{
+  dart__mpi__layout_t layout = { nblocks, nelem_block, stride, NULL, NULL };
+  return dart__mpi__rma_layout("dart_put_strided_handle", 1, NULL, src,
+                               gptr, &layout, dtype, DART_MPI_SYNC_HANDLE,
+                               handle, NULL);
+}
+
+dart_ret_t dart_get_strided_blocking(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype)
+{
+  dart__mpi__layout_t layout = { nblocks, nelem_block, stride, NULL, NULL };
+  return dart__mpi__rma_layout("dart_get_strided_blocking", 0, dest, NULL,
+                               gptr, &layout, dtype, DART_MPI_SYNC_BLOCKING,
+                               NULL, NULL);
+}
+
+dart_ret_t dart_put_strided_blocking(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  dart_datatype_t   dtype)
+{
+  dart__mpi__layout_t layout = { nblocks, nelem_block, stride, NULL, NULL };
+  return dart__mpi__rma_layout("dart_put_strided_blocking", 1, NULL, src,
+                               gptr, &layout, dtype, DART_MPI_SYNC_BLOCKING,
+                               NULL, NULL);
+}
+
+dart_ret_t dart_get_indexed_handle(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  const size_t    * nelem_blocks,
+  const size_t    * displs,
+  dart_datatype_t   dtype,
+  dart_handle_t   * handle)
+{
+  dart__mpi__layout_t layout = { nblocks, 0, 0, nelem_blocks, displs };
+  if (nelem_blocks == NULL || displs == NULL) {
+    DART_LOG_ERROR("dart_get_indexed_handle ! invalid block arrays");
+    return DART_ERR_INVAL;
+  }
+  return dart__mpi__rma_layout("dart_get_indexed_handle", 0, dest, NULL,
+                               gptr, &layout, dtype, DART_MPI_SYNC_HANDLE,
+                               handle, NULL);
+}
+
+dart_ret_t dart_put_indexed_handle(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  const size_t    * nelem_blocks,
+  const size_t    * displs,
+  dart_datatype_t   dtype,
+  dart_handle_t   * handle)
+{
+  dart__mpi__layout_t layout = { nblocks, 0, 0, nelem_blocks, displs };
+  if (nelem_blocks == NULL || displs == NULL) {
+    DART_LOG_ERROR("dart_put_indexed_handle ! invalid block arrays");
+    return DART_ERR_INVAL;
+  }
+  return dart__mpi__rma_layout("dart_put_indexed_handle", 1, NULL, src,
+                               gptr, &layout, dtype, DART_MPI_SYNC_HANDLE,
+                               handle, NULL);
+}
+
+/* -- Handle groups -- */
+
+dart_ret_t dart_handle_group_create(
+  dart_handle_group_t * group)
+{
+  if (group == NULL) {
+    DART_LOG_ERROR("dart_handle_group_create ! group must not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *group = calloc(1, sizeof(struct dart_handle_group_struct));
+  if (*group == NULL) {
+    DART_LOG_ERROR("dart_handle_group_create ! calloc failed");
+    return DART_ERR_OTHER;
   }
-  DART_LOG_DEBUG("dart_wait_local > finished");
   return DART_OK;
 }
 
-dart_ret_t dart_wait(
-  dart_handle_t handle)
+dart_ret_t dart_handle_group_destroy(
+  dart_handle_group_t * group)
 {
-  int mpi_ret;
-  DART_LOG_DEBUG("dart_wait() handle:%p", (void*)(handle));
-  if (handle != NULL) {
-    DART_LOG_TRACE("dart_wait_local:     handle->dest: %d",
-                   handle->dest);
-    DART_LOG_TRACE("dart_wait_local:     handle->win:  %"PRIu64"",
-                   (unsigned long)handle->win);
-    DART_LOG_TRACE("dart_wait_local:     handle->req:  %ld",
-                   (unsigned long)handle->request);
-    if (handle->request != MPI_REQUEST_NULL) {
-      MPI_Status mpi_sta;
-      DART_LOG_DEBUG("dart_wait:     -- MPI_Wait");
-      mpi_ret = MPI_Wait(&(handle->request), &mpi_sta);
-      DART_LOG_TRACE("dart_wait:        -- mpi_sta.MPI_SOURCE: %d",
-                     mpi_sta.MPI_SOURCE);
-      DART_LOG_TRACE("dart_wait:        -- mpi_sta.MPI_ERROR:  %d:%s",
-                     mpi_sta.MPI_ERROR,
-                     DART__MPI__ERROR_STR(mpi_sta.MPI_ERROR));
-      if (mpi_ret != MPI_SUCCESS) {
-        DART_LOG_DEBUG("dart_wait ! MPI_Wait failed");
-        return DART_ERR_INVAL;
-      }
-      DART_LOG_DEBUG("dart_wait:     -- MPI_Win_flush");
-      mpi_ret = MPI_Win_flush(handle->dest, handle->win);
-      if (mpi_ret != MPI_SUCCESS) {
-        DART_LOG_DEBUG("dart_wait ! MPI_Win_flush failed");
-        return DART_ERR_INVAL;
-      }
-    } else {
-      DART_LOG_TRACE("dart_wait:     handle->request: MPI_REQUEST_NULL");
-    }
-    /* Free handle resource */
-    DART_LOG_DEBUG("dart_wait:   free handle %p", (void*)(handle));
-    free(handle);
-    handle = NULL;
+  if (group == NULL || *group == NULL) {
+    return DART_OK;
   }
-  DART_LOG_DEBUG("dart_wait > finished");
+  if ((*group)->num_targets > 0) {
+    DART_LOG_ERROR("dart_handle_group_destroy ! "
+                   "group has %zu incomplete targets",
+                   (*group)->num_targets);
+  }
+  free((*group)->targets);
+  free(*group);
+  *group = NULL;
   return DART_OK;
 }
 
-dart_ret_t dart_waitall_local(
-  dart_handle_t * handle,
-  size_t          num_handles)
+dart_ret_t dart_handle_group_waitall(
+  dart_handle_group_t group)
 {
-  dart_ret_t ret = DART_OK;
+  DART_LOG_DEBUG("dart_handle_group_waitall() group:%p", (void*)group);
+  if (group == NULL) {
+    DART_LOG_ERROR("dart_handle_group_waitall ! group must not be NULL");
+    return DART_ERR_INVAL;
+  }
+  dart_ret_t ret = dart__mpi__flush_targets(
+                     "dart_handle_group_waitall",
+                     group->targets, group->num_targets);
+  group->num_targets = 0;
+  DART_LOG_DEBUG("dart_handle_group_waitall > %d", ret);
+  return ret;
+}
 
-  DART_LOG_DEBUG("dart_waitall_local()");
-  if (num_handles == 0) {
-    DART_LOG_DEBUG("dart_waitall_local > number of handles = 0");
-    return DART_OK;
+dart_ret_t dart_get_grouped(
+  void                * dest,
+  dart_gptr_t           gptr,
+  size_t                nelem,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group)
+{
+  dart__mpi__layout_t layout = { 1, nelem, nelem, NULL, NULL };
+  return dart__mpi__rma_layout("dart_get_grouped", 0, dest, NULL,
+                               gptr, &layout, dtype, DART_MPI_SYNC_GROUP,
+                               NULL, group);
+}
+
+dart_ret_t dart_put_grouped(
+  dart_gptr_t           gptr,
+  const void          * src,
+  size_t                nelem,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group)
+{
+  dart__mpi__layout_t layout = { 1, nelem, nelem, NULL, NULL };
+  return dart__mpi__rma_layout("dart_put_grouped", 1, NULL, src,
+                               gptr, &layout, dtype, DART_MPI_SYNC_GROUP,
+                               NULL, group);
+}
+
+dart_ret_t dart_get_strided_grouped(
+  void                * dest,
+  dart_gptr_t           gptr,
+  size_t                nblocks,
+  size_t                nelem_block,
+  size_t                stride,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group)
+{
+  dart__mpi__layout_t layout = { nblocks, nelem_block, stride, NULL, NULL };
+  return dart__mpi__rma_layout("dart_get_strided_grouped", 0, dest, NULL,
+                               gptr, &layout, dtype, DART_MPI_SYNC_GROUP,
+                               NULL, group);
+}
+
+dart_ret_t dart_put_strided_grouped(
+  dart_gptr_t           gptr,
+  const void          * src,
+  size_t                nblocks,
+  size_t                nelem_block,
+  size_t                stride,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group)
+{
+  dart__mpi__layout_t layout = { nblocks, nelem_block, stride, NULL, NULL };
+  return dart__mpi__rma_layout("dart_put_strided_grouped", 1, NULL, src,
+                               gptr, &layout, dtype, DART_MPI_SYNC_GROUP,
+                               NULL, group);
+}
+
+dart_ret_t dart_get_indexed_grouped(
+  void                * dest,
+  dart_gptr_t           gptr,
+  size_t                nblocks,
+  const size_t        * nelem_blocks,
+  const size_t        * displs,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group)
+{
+  dart__mpi__layout_t layout = { nblocks, 0, 0, nelem_blocks, displs };
+  if (nelem_blocks == NULL || displs == NULL) {
+    DART_LOG_ERROR("dart_get_indexed_grouped ! invalid block arrays");
+    return DART_ERR_INVAL;
   }
-  if (num_handles > INT_MAX) {
-    DART_LOG_ERROR("dart_waitall_local ! number of handles > INT_MAX");
+  return dart__mpi__rma_layout("dart_get_indexed_grouped", 0, dest, NULL,
+                               gptr, &layout, dtype, DART_MPI_SYNC_GROUP,
+                               NULL, group);
+}
+
+dart_ret_t dart_put_indexed_grouped(
+  dart_gptr_t           gptr,
+  const void          * src,
+  size_t                nblocks,
+  const size_t        * nelem_blocks,
+  const size_t        * displs,
+  dart_datatype_t       dtype,
+  dart_handle_group_t   group)
+{
+  dart__mpi__layout_t layout = { nblocks, 0, 0, nelem_blocks, displs };
+  if (nelem_blocks == NULL || displs == NULL) {
+    DART_LOG_ERROR("dart_put_indexed_grouped ! invalid block arrays");
     return DART_ERR_INVAL;
   }
-  if (handle != NULL) {
-    size_t      i,
-                r_n = 0;
-    MPI_Status  *mpi_sta;
-    MPI_Request *mpi_req;
-    mpi_req = (MPI_Request *) malloc(num_handles * sizeof(MPI_Request));
-    mpi_sta = (MPI_Status  *) malloc(num_handles * sizeof(MPI_Status));
-    for (i = 0; i < num_handles; i++)  {
-      if (handle[i] != NULL && handle[i]->request != MPI_REQUEST_NULL) {
-        DART_LOG_TRACE("dart_waitall_local: -- handle[%"PRIu64"]: %p)",
-                       i, (void*)handle[i]);
-        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->dest: %d",
-                       i, handle[i]->dest);
-        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->win:  %p",
-                       i, (void*)((unsigned long)(handle[i]->win)));
-        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->req:  %p",
-                       i, (void*)((unsigned long)(handle[i]->request)));
-        mpi_req[r_n] = handle[i]->request;
-        r_n++;
-      }
-    }
-    /*
-     * Wait for local completion of MPI requests:
-     */
-    DART_LOG_DEBUG("dart_waitall_local: "
-                   "MPI_Waitall, %"PRIu64" requests from %"PRIu64" handles",
-                   r_n, num_handles);
-    if (r_n > 0) {
-      if (MPI_Waitall(r_n, mpi_req, mpi_sta) == MPI_SUCCESS) {
-        DART_LOG_DEBUG("dart_waitall_local: MPI_Waitall completed");
-      } else {
-        DART_LOG_ERROR("dart_waitall_local: MPI_Waitall failed");
-        DART_LOG_TRACE("dart_waitall_local: free MPI_Request temporaries");
-        free(mpi_req);
-        DART_LOG_TRACE("dart_waitall_local: free MPI_Status temporaries");
-        free(mpi_sta);
-        return DART_ERR_INVAL;
-      }
-    } else {
-      DART_LOG_DEBUG("dart_waitall_local > number of requests = 0");
-      free(mpi_req);
-      free(mpi_sta);
+  return dart__mpi__rma_layout("dart_put_indexed_grouped", 1, NULL, src,
+                               gptr, &layout, dtype, DART_MPI_SYNC_GROUP,
+                               NULL, group);
+}
+
+/* -- Dart RMA Synchronization Operations -- */
+
+dart_ret_t dart_flush(
+  dart_gptr_t gptr)
+{
+  MPI_Win          win;
+  MPI_Comm         comm         = DART_COMM_WORLD;
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  int16_t          seg_id       = gptr.segid;
+  DART_LOG_DEBUG("dart_flush() gptr: "
+                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
+                 gptr.unitid, gptr.addr_or_offs.offset,
+                 gptr.segid,  gptr.teamid);
+
+  if (gptr.unitid < 0) {
+    DART_LOG_ERROR("dart_flush ! failed: gptr.unitid < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (seg_id) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+    if (team_data == NULL) {
+      DART_LOG_ERROR("dart_flush ! failed: Unknown team %i!", gptr.teamid);
+      return DART_ERR_INVAL;
+    }
+    if (team_data->epoch != DART_MPI_EPOCH_PASSIVE) {
+      // Operations are completed at the end of the active-target epoch:
+      DART_LOG_DEBUG("dart_flush > active-target epoch");
       return DART_OK;
     }
-    /*
-     * copy MPI requests back to DART handles:
-     */
-    DART_LOG_TRACE("dart_waitall_local: "
-                   "releasing DART handles");
-    r_n = 0;
-    for (i = 0; i < num_handles; i++) {
-      if (handle[i]) {
-        if (handle[i]->request) {
-          DART_LOG_TRACE("dart_waitall_local: -- mpi_sta[%"PRIu64"].MPI_SOURCE:"
-                         " %d",
-                         r_n, mpi_sta[r_n].MPI_SOURCE);
-          DART_LOG_TRACE("dart_waitall_local: -- mpi_sta[%"PRIu64"].MPI_ERROR:"
-                         "  %d:%s",
-                         r_n,
-                         mpi_sta[r_n].MPI_ERROR,
-                         DART__MPI__ERROR_STR(mpi_sta[r_n].MPI_ERROR));
-          if (mpi_sta[r_n].MPI_ERROR != MPI_SUCCESS) {
-            DART_LOG_ERROR("dart_waitall_local: detected unsuccesful request "
-                           "%zu mpi_sta[%zu] = %d (%s)",
-                           i,
-                           r_n,
-                           mpi_sta[r_n].MPI_ERROR,
-                           DART__MPI__ERROR_STR(mpi_sta[r_n].MPI_ERROR));
-          }
-          r_n++;
-        }
-        DART_LOG_TRACE("dart_waitall_local: free handle[%zu] %p",
-                       i, (void*)(handle[i]));
-        free(handle[i]);
-        handle[i] = NULL;
-      }
+    win = team_data->window;
+    comm = team_data->comm;
+  } else {
+    win = dart_win_local_alloc;
+  }
+
+  DART_LOG_TRACE("dart_flush: MPI_Win_flush");
+  if (MPI_Win_flush(team_unit_id.id, win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush ! MPI_Win_flush failed!");
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_TRACE("dart_flush: MPI_Win_sync");
+  if (MPI_Win_sync(win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush ! MPI_Win_sync failed!");
+    return DART_ERR_OTHER;
+  }
+
+  // trigger progress
+  int flag;
+  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE);
+
+  DART_LOG_DEBUG("dart_flush > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_flush_all(
+  dart_gptr_t gptr)
+{
+  MPI_Win  win;
+  MPI_Comm comm   = DART_COMM_WORLD;
+  int16_t  seg_id = gptr.segid;
+  DART_LOG_DEBUG("dart_flush_all() gptr: "
+                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
+                 gptr.unitid, gptr.addr_or_offs.offset,
+                 gptr.segid,  gptr.teamid);
+  if (gptr.unitid < 0) {
+    DART_LOG_ERROR("dart_flush_all ! failed: gptr.unitid < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (seg_id) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+    if (team_data == NULL) {
+      DART_LOG_ERROR("dart_flush_all ! failed: Unknown team %i!", gptr.teamid);
+      return DART_ERR_INVAL;
     }
-    DART_LOG_TRACE("dart_waitall_local: free MPI_Request temporaries");
-    free(mpi_req);
-    DART_LOG_TRACE("dart_waitall_local: free MPI_Status temporaries");
-    free(mpi_sta);
+
+    if (team_data->epoch != DART_MPI_EPOCH_PASSIVE) {
+      // Operations are completed at the end of the active-target epoch:
+      DART_LOG_DEBUG("dart_flush_all > active-target epoch");
+      return DART_OK;
+    }
+    win  = team_data->window;
+    comm = team_data->comm;
+  } else {
+    win = dart_win_local_alloc;
+  }
+  DART_LOG_TRACE("dart_flush_all: MPI_Win_flush_all");
+  if (MPI_Win_flush_all(win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_all failed!");
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_TRACE("dart_flush_all: MPI_Win_sync");
+  if (MPI_Win_sync(win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush_all ! MPI_Win_sync failed!");
+    return DART_ERR_OTHER;
+  }
+
+  // trigger progress
+  int flag;
+  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE);
+
+  DART_LOG_DEBUG("dart_flush_all > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_flush_local(
+  dart_gptr_t gptr)
+{
+  MPI_Win  win;
+  MPI_Comm comm   = DART_COMM_WORLD;
+  int16_t  seg_id = gptr.segid;
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+
+  DART_LOG_DEBUG("dart_flush_local() gptr: "
+                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
+                 gptr.unitid, gptr.addr_or_offs.offset,
+                 gptr.segid,  gptr.teamid);
+
+  if (gptr.unitid < 0) {
+    DART_LOG_ERROR("dart_flush_local ! failed: gptr.unitid < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (seg_id) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+    if (team_data == NULL) {
+      DART_LOG_ERROR("dart_flush_local ! failed: Unknown team %i!", gptr.segid);
+      return DART_ERR_INVAL;
+    }
+
+    if (team_data->epoch != DART_MPI_EPOCH_PASSIVE) {
+      // Operations are completed at the end of the active-target epoch:
+      DART_LOG_DEBUG("dart_flush_local > active-target epoch");
+      return DART_OK;
+    }
+    win = team_data->window;
+    comm = team_data->comm;
+    DART_LOG_DEBUG("dart_flush_local() win:%"PRIu64" seg:%d unit:%d",
+                   (unsigned long)win, seg_id, team_unit_id.id);
+  } else {
+    win = dart_win_local_alloc;
+    DART_LOG_DEBUG("dart_flush_local() lwin:%"PRIu64" seg:%d unit:%d",
+                   (unsigned long)win, seg_id, team_unit_id.id);
+  }
+  DART_LOG_TRACE("dart_flush_local: MPI_Win_flush_local");
+  if (MPI_Win_flush_local(team_unit_id.id, win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_local failed!");
+    return DART_ERR_OTHER;
+  }
+
+  // trigger progress
+  int flag;
+  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE);
+
+  DART_LOG_DEBUG("dart_flush_local > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_flush_local_all(
+  dart_gptr_t gptr)
+{
+  MPI_Win  win;
+  MPI_Comm comm   = DART_COMM_WORLD;
+  int16_t  seg_id = gptr.segid;
+  DART_LOG_DEBUG("dart_flush_local_all() gptr: "
+                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
+                 gptr.unitid, gptr.addr_or_offs.offset,
+                 gptr.segid,  gptr.teamid);
+
+  if (gptr.unitid < 0) {
+    DART_LOG_ERROR("dart_flush_local_all ! failed: gptr.unitid < 0");
+    return DART_ERR_INVAL;
+  }
+
+
+  if (seg_id) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+    if (team_data == NULL) {
+      DART_LOG_ERROR("dart_flush_local_all ! failed: Unknown team %i!",
+                          gptr.teamid);
+      return DART_ERR_INVAL;
+    }
+    if (team_data->epoch != DART_MPI_EPOCH_PASSIVE) {
+      // Operations are completed at the end of the active-target epoch:
+      DART_LOG_DEBUG("dart_flush_local_all > active-target epoch");
+      return DART_OK;
+    }
+    win  = team_data->window;
+    comm = team_data->comm;
+  } else {
+    win = dart_win_local_alloc;
+  }
+  if (MPI_Win_flush_local_all(win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_local_all failed!");
+    return DART_ERR_OTHER;
+  }
+
+  // trigger progress
+  int flag;
+  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE);
+
+  DART_LOG_DEBUG("dart_flush_local_all > finished");
+  return DART_OK;
+}
+
+/* -- Active-target synchronization epochs -- */
+
+/**
+ * Resolves the data of a team and checks that its window is in the
+ * expected synchronization mode.
+ */
+static dart_team_data_t * dart__mpi__epoch_team_data(
+  const char       * caller,
+  dart_team_t        teamid,
+  dart_mpi_epoch_t   epoch)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("%s ! failed: Unknown team %i!", caller, teamid);
+    return NULL;
+  }
+  if (team_data->epoch != epoch) {
+    DART_LOG_ERROR("%s ! failed: team %i in epoch %d, expected %d",
+                   caller, teamid, team_data->epoch, epoch);
+    return NULL;
+  }
+  return team_data;
+}
+
+/**
+ * Creates the group of the given units in a team's communicator.
+ */
+static dart_ret_t dart__mpi__epoch_group(
+  const dart_team_data_t * team_data,
+  const dart_team_unit_t * units,
+  size_t                   nunits,
+  MPI_Group              * group)
+{
+  MPI_Group team_group;
+  if (nunits > INT_MAX) {
+    DART_LOG_ERROR("dart__mpi__epoch_group ! failed: nunits > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  int *ranks  = malloc(sizeof(int) * (nunits > 0 ? nunits : 1));
+  int  nranks = 0;
+  for (size_t i = 0; i < nunits; i++) {
+    // Skip duplicates, e.g. left and right neighbor in a team of 2 units:
+    int j = 0;
+    while (j < nranks && ranks[j] != units[i].id) {
+      j++;
+    }
+    if (j == nranks) {
+      ranks[nranks++] = units[i].id;
+    }
+  }
+  MPI_Comm_group(team_data->comm, &team_group);
+  int ret = MPI_Group_incl(team_group, nranks, ranks, group);
+  MPI_Group_free(&team_group);
+  free(ranks);
+  return (ret == MPI_SUCCESS) ? DART_OK : DART_ERR_INVAL;
+}
+
+dart_ret_t dart_epoch_fence_begin(
+  dart_team_t teamid)
+{
+  DART_LOG_DEBUG("dart_epoch_fence_begin() team:%d", teamid);
+  dart_team_data_t *team_data = dart__mpi__epoch_team_data(
+                                  "dart_epoch_fence_begin", teamid,
+                                  DART_MPI_EPOCH_PASSIVE);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  // Completes outstanding operations of the passive-target epoch:
+  if (MPI_Win_unlock_all(team_data->window) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_fence_begin ! MPI_Win_unlock_all failed");
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Win_fence(MPI_MODE_NOPRECEDE, team_data->window)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_fence_begin ! MPI_Win_fence failed");
+    return DART_ERR_OTHER;
+  }
+  team_data->epoch = DART_MPI_EPOCH_FENCE;
+  DART_LOG_DEBUG("dart_epoch_fence_begin > team:%d", teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_epoch_fence(
+  dart_team_t teamid)
+{
+  DART_LOG_DEBUG("dart_epoch_fence() team:%d", teamid);
+  dart_team_data_t *team_data = dart__mpi__epoch_team_data(
+                                  "dart_epoch_fence", teamid,
+                                  DART_MPI_EPOCH_FENCE);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  if (MPI_Win_fence(0, team_data->window) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_fence ! MPI_Win_fence failed");
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_DEBUG("dart_epoch_fence > team:%d", teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_epoch_fence_end(
+  dart_team_t teamid)
+{
+  DART_LOG_DEBUG("dart_epoch_fence_end() team:%d", teamid);
+  dart_team_data_t *team_data = dart__mpi__epoch_team_data(
+                                  "dart_epoch_fence_end", teamid,
+                                  DART_MPI_EPOCH_FENCE);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  if (MPI_Win_fence(MPI_MODE_NOSUCCEED, team_data->window)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_fence_end ! MPI_Win_fence failed");
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Win_lock_all(0, team_data->window) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_fence_end ! MPI_Win_lock_all failed");
+    return DART_ERR_OTHER;
+  }
+  team_data->epoch = DART_MPI_EPOCH_PASSIVE;
+  DART_LOG_DEBUG("dart_epoch_fence_end > team:%d", teamid);
+  return DART_OK;
+}
+
+/**
+ * Releases the groups of a PSCW epoch that could not be started and
+ * restores the passive-target epoch of the team's window if it has been
+ * unlocked already.
+ */
+static void dart__mpi__pscw_abort(
+  dart_team_data_t * team_data,
+  int                relock)
+{
+  if (team_data->pscw_origin_group != MPI_GROUP_NULL) {
+    MPI_Group_free(&team_data->pscw_origin_group);
+  }
+  if (team_data->pscw_target_group != MPI_GROUP_NULL) {
+    MPI_Group_free(&team_data->pscw_target_group);
+  }
+  if (relock &&
+      MPI_Win_lock_all(0, team_data->window) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_pscw_begin ! MPI_Win_lock_all failed");
+  }
+}
+
+dart_ret_t dart_epoch_pscw_begin(
+  dart_team_t              teamid,
+  const dart_team_unit_t * origins,
+  size_t                   norigins,
+  const dart_team_unit_t * targets,
+  size_t                   ntargets)
+{
+  DART_LOG_DEBUG("dart_epoch_pscw_begin() team:%d origins:%zu targets:%zu",
+                 teamid, norigins, ntargets);
+  dart_team_data_t *team_data = dart__mpi__epoch_team_data(
+                                  "dart_epoch_pscw_begin", teamid,
+                                  DART_MPI_EPOCH_PASSIVE);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  team_data->pscw_origin_group = MPI_GROUP_NULL;
+  team_data->pscw_target_group = MPI_GROUP_NULL;
+  if (dart__mpi__epoch_group(
+        team_data, origins, norigins, &team_data->pscw_origin_group)
+      != DART_OK ||
+      dart__mpi__epoch_group(
+        team_data, targets, ntargets, &team_data->pscw_target_group)
+      != DART_OK) {
+    DART_LOG_ERROR("dart_epoch_pscw_begin ! failed: invalid units");
+    dart__mpi__pscw_abort(team_data, 0);
+    return DART_ERR_INVAL;
+  }
+  // Completes outstanding operations of the passive-target epoch:
+  if (MPI_Win_unlock_all(team_data->window) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_pscw_begin ! MPI_Win_unlock_all failed");
+    dart__mpi__pscw_abort(team_data, 0);
+    return DART_ERR_OTHER;
+  }
+  // Expose memory before accessing targets to prevent deadlocks between
+  // units that are origin and target of each other:
+  if (MPI_Win_post(team_data->pscw_origin_group, 0, team_data->window)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_pscw_begin ! MPI_Win_post failed");
+    dart__mpi__pscw_abort(team_data, 1);
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Win_start(team_data->pscw_target_group, 0, team_data->window)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_pscw_begin ! MPI_Win_start failed");
+    // Close the exposure epoch, completes once the origins ended their
+    // access epochs:
+    if (MPI_Win_wait(team_data->window) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_epoch_pscw_begin ! MPI_Win_wait failed");
+    }
+    dart__mpi__pscw_abort(team_data, 1);
+    return DART_ERR_OTHER;
+  }
+  team_data->epoch = DART_MPI_EPOCH_PSCW;
+  DART_LOG_DEBUG("dart_epoch_pscw_begin > team:%d", teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_epoch_pscw_end(
+  dart_team_t teamid)
+{
+  DART_LOG_DEBUG("dart_epoch_pscw_end() team:%d", teamid);
+  dart_team_data_t *team_data = dart__mpi__epoch_team_data(
+                                  "dart_epoch_pscw_end", teamid,
+                                  DART_MPI_EPOCH_PSCW);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  if (MPI_Win_complete(team_data->window) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_pscw_end ! MPI_Win_complete failed");
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Win_wait(team_data->window) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_pscw_end ! MPI_Win_wait failed");
+    return DART_ERR_OTHER;
+  }
+  MPI_Group_free(&team_data->pscw_origin_group);
+  MPI_Group_free(&team_data->pscw_target_group);
+  if (MPI_Win_lock_all(0, team_data->window) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_epoch_pscw_end ! MPI_Win_lock_all failed");
+    return DART_ERR_OTHER;
+  }
+  team_data->epoch = DART_MPI_EPOCH_PASSIVE;
+  DART_LOG_DEBUG("dart_epoch_pscw_end > team:%d", teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_wait_local(
+  dart_handle_t handle)
+{
+  int mpi_ret;
+  DART_LOG_DEBUG("dart_wait_local() handle:%p", (void*)(handle));
+  if (handle != NULL) {
+    DART_LOG_TRACE("dart_wait_local:     handle->dest: %d",
+                   handle->dest);
+    DART_LOG_TRACE("dart_wait_local:     handle->win:  %p",
+                   (void*)(unsigned long)(handle->win));
+    DART_LOG_TRACE("dart_wait_local:     handle->req:  %ld",
+                   (long)handle->request);
+    if (handle->request != MPI_REQUEST_NULL) {
+      MPI_Status mpi_sta;
+      mpi_ret = MPI_Wait(&(handle->request), &mpi_sta);
+      DART_LOG_TRACE("dart_wait_local:        -- mpi_sta.MPI_SOURCE = %d",
+                     mpi_sta.MPI_SOURCE);
+      DART_LOG_TRACE("dart_wait_local:        -- mpi_sta.MPI_ERROR  = %d (%s)",
+                     mpi_sta.MPI_ERROR,
+                     DART__MPI__ERROR_STR(mpi_sta.MPI_ERROR));
+      if (mpi_ret != MPI_SUCCESS) {
+        DART_LOG_DEBUG("dart_wait_local ! MPI_Wait failed");
+        return DART_ERR_INVAL;
+      }
+    } else {
+      DART_LOG_TRACE("dart_wait_local:     handle->req == MPI_REQUEST_NULL");
+    }
+    /*
+     * Do not free handle resource, it could be needed for a following
+     * dart_wait() or dart_wait_all() to ensure remote completion.
+     */
+  }
+  DART_LOG_DEBUG("dart_wait_local > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_wait(
+  dart_handle_t handle)
+{
+  int mpi_ret;
+  DART_LOG_DEBUG("dart_wait() handle:%p", (void*)(handle));
+  if (handle != NULL) {
+    DART_LOG_TRACE("dart_wait_local:     handle->dest: %d",
+                   handle->dest);
+    DART_LOG_TRACE("dart_wait_local:     handle->win:  %"PRIu64"",
+                   (unsigned long)handle->win);
+    DART_LOG_TRACE("dart_wait_local:     handle->req:  %ld",
+                   (unsigned long)handle->request);
+    if (handle->request != MPI_REQUEST_NULL) {
+      MPI_Status mpi_sta;
+      DART_LOG_DEBUG("dart_wait:     -- MPI_Wait");
+      mpi_ret = MPI_Wait(&(handle->request), &mpi_sta);
+      DART_LOG_TRACE("dart_wait:        -- mpi_sta.MPI_SOURCE: %d",
+                     mpi_sta.MPI_SOURCE);
+      DART_LOG_TRACE("dart_wait:        -- mpi_sta.MPI_ERROR:  %d:%s",
+                     mpi_sta.MPI_ERROR,
+                     DART__MPI__ERROR_STR(mpi_sta.MPI_ERROR));
+      if (mpi_ret != MPI_SUCCESS) {
+        DART_LOG_DEBUG("dart_wait ! MPI_Wait failed");
+        return DART_ERR_INVAL;
+      }
+      if (handle->win != MPI_WIN_NULL) {
+        DART_LOG_DEBUG("dart_wait:     -- MPI_Win_flush");
+        mpi_ret = MPI_Win_flush(handle->dest, handle->win);
+        if (mpi_ret != MPI_SUCCESS) {
+          DART_LOG_DEBUG("dart_wait ! MPI_Win_flush failed");
+          return DART_ERR_INVAL;
+        }
+      }
+    } else {
+      DART_LOG_TRACE("dart_wait:     handle->request: MPI_REQUEST_NULL");
+    }
+    /* Free handle resource */
+    DART_LOG_DEBUG("dart_wait:   free handle %p", (void*)(handle));
+    dart__mpi__handle_free(handle);
+    handle = NULL;
+  }
+  DART_LOG_DEBUG("dart_wait > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_waitall_local(
+  dart_handle_t * handle,
+  size_t          num_handles)
+{
+  dart_ret_t ret = DART_OK;
+
+  DART_LOG_DEBUG("dart_waitall_local()");
+  if (num_handles == 0) {
+    DART_LOG_DEBUG("dart_waitall_local > number of handles = 0");
+    return DART_OK;
+  }
+  if (num_handles > INT_MAX) {
+    DART_LOG_ERROR("dart_waitall_local ! number of handles > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  if (handle != NULL) {
+    size_t      i,
+                r_n = 0;
+    MPI_Status  *mpi_sta;
+    MPI_Request *mpi_req;
+    mpi_req = (MPI_Request *) malloc(num_handles * sizeof(MPI_Request));
+    mpi_sta = (MPI_Status  *) malloc(num_handles * sizeof(MPI_Status));
+    for (i = 0; i < num_handles; i++)  {
+      if (handle[i] != NULL && handle[i]->request != MPI_REQUEST_NULL) {
+        DART_LOG_TRACE("dart_waitall_local: -- handle[%"PRIu64"]: %p)",
+                       i, (void*)handle[i]);
+        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->dest: %d",
+                       i, handle[i]->dest);
+        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->win:  %p",
+                       i, (void*)((unsigned long)(handle[i]->win)));
+        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->req:  %p",
+                       i, (void*)((unsigned long)(handle[i]->request)));
+        mpi_req[r_n] = handle[i]->request;
+        r_n++;
+      }
+    }
+    /*
+     * Wait for local completion of MPI requests:
+     */
+    DART_LOG_DEBUG("dart_waitall_local: "
+                   "MPI_Waitall, %"PRIu64" requests from %"PRIu64" handles",
+                   r_n, num_handles);
+    if (r_n > 0) {
+      if (MPI_Waitall(r_n, mpi_req, mpi_sta) == MPI_SUCCESS) {
+        DART_LOG_DEBUG("dart_waitall_local: MPI_Waitall completed");
+      } else {
+        DART_LOG_ERROR("dart_waitall_local: MPI_Waitall failed");
+        DART_LOG_TRACE("dart_waitall_local: free MPI_Request temporaries");
+        free(mpi_req);
+        DART_LOG_TRACE("dart_waitall_local: free MPI_Status temporaries");
+        free(mpi_sta);
+        return DART_ERR_INVAL;
+      }
+    } else {
+      /* requests completed in dart_test_local or served without MPI
+       * request, handles still have to be released */
+      DART_LOG_DEBUG("dart_waitall_local: number of requests = 0");
+    }
+    /*
+     * release DART handles, requests have not been copied back so
+     * handles with pending requests before MPI_Waitall are identified
+     * by their request:
+     */
+    DART_LOG_TRACE("dart_waitall_local: "
+                   "releasing DART handles");
+    r_n = 0;
+    for (i = 0; i < num_handles; i++) {
+      if (handle[i]) {
+        if (handle[i]->request != MPI_REQUEST_NULL) {
+          DART_LOG_TRACE("dart_waitall_local: -- mpi_sta[%"PRIu64"].MPI_SOURCE:"
+                         " %d",
+                         r_n, mpi_sta[r_n].MPI_SOURCE);
+          DART_LOG_TRACE("dart_waitall_local: -- mpi_sta[%"PRIu64"].MPI_ERROR:"
+                         "  %d:%s",
+                         r_n,
+                         mpi_sta[r_n].MPI_ERROR,
+                         DART__MPI__ERROR_STR(mpi_sta[r_n].MPI_ERROR));
+          if (mpi_sta[r_n].MPI_ERROR != MPI_SUCCESS) {
+            DART_LOG_ERROR("dart_waitall_local: detected unsuccesful request "
+                           "%zu mpi_sta[%zu] = %d (%s)",
+                           i,
+                           r_n,
+                           mpi_sta[r_n].MPI_ERROR,
+                           DART__MPI__ERROR_STR(mpi_sta[r_n].MPI_ERROR));
+          }
+          r_n++;
+        }
+        DART_LOG_TRACE("dart_waitall_local: free handle[%zu] %p",
+                       i, (void*)(handle[i]));
+        dart__mpi__handle_free(handle[i]);
+        handle[i] = NULL;
+      }
+    }
+    DART_LOG_TRACE("dart_waitall_local: free MPI_Request temporaries");
+    free(mpi_req);
+    DART_LOG_TRACE("dart_waitall_local: free MPI_Status temporaries");
+    free(mpi_sta);
+  }
+  DART_LOG_DEBUG("dart_waitall_local > %d", ret);
+  return ret;
+}
+
+dart_ret_t dart_waitall(
+  dart_handle_t * handle,
+  size_t          n)
+{
+  size_t i, r_n, t_n;
+  DART_LOG_DEBUG("dart_waitall()");
+  if (n == 0) {
+    DART_LOG_ERROR("dart_waitall > number of handles = 0");
+    return DART_OK;
+  }
+  if (n > INT_MAX) {
+    DART_LOG_ERROR("dart_waitall ! number of handles > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart_waitall: number of handles: %zu", n);
+  if (handle) {
+    MPI_Request               * mpi_req;
+    dart__mpi__flush_target_t * targets;
+    mpi_req = (MPI_Request *) malloc(n * sizeof(MPI_Request));
+    targets = (dart__mpi__flush_target_t *)
+                malloc(n * sizeof(dart__mpi__flush_target_t));
+    /*
+     * copy requests from DART handles to MPI request array and collect
+     * targets of one-sided operations that require remote completion:
+     */
+    DART_LOG_TRACE("dart_waitall: copying DART handles to MPI request array");
+    r_n = 0;
+    t_n = 0;
+    for (i = 0; i < n; i++) {
+      if (handle[i] != NULL) {
+        DART_LOG_DEBUG("dart_waitall: -- handle[%zu](%p): "
+                       "dest:%d win:%"PRIu64" req:%"PRIu64"",
+                       i, (void*)handle[i],
+                       handle[i]->dest,
+                       (unsigned long)handle[i]->win,
+                       (unsigned long)handle[i]->request);
+        if (handle[i]->request != MPI_REQUEST_NULL) {
+          mpi_req[r_n] = handle[i]->request;
+          r_n++;
+        }
+        /* requests may have been completed locally by dart_test_local */
+        if (handle[i]->win != MPI_WIN_NULL) {
+          targets[t_n].win  = handle[i]->win;
+          targets[t_n].dest = handle[i]->dest;
+          t_n++;
+        }
+      }
+    }
+    /*
+     * wait for local completion of all MPI requests in a single call:
+     */
+    DART_LOG_DEBUG("dart_waitall: MPI_Waitall, %zu requests from %zu handles",
+                   r_n, n);
+    if (r_n > 0 &&
+        MPI_Waitall(r_n, mpi_req, MPI_STATUSES_IGNORE) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_waitall: MPI_Waitall failed");
+      free(mpi_req);
+      free(targets);
+      return DART_ERR_INVAL;
+    }
+    /*
+     * wait for remote completion, flushing every target once:
+     */
+    DART_LOG_DEBUG("dart_waitall: waiting for remote completion, "
+                   "%zu one-sided requests", t_n);
+    dart_ret_t ret = dart__mpi__flush_targets("dart_waitall", targets, t_n);
+    free(mpi_req);
+    free(targets);
+    if (ret != DART_OK) {
+      return ret;
+    }
+    /*
+     * free memory:
+     */
+    DART_LOG_DEBUG("dart_waitall: free handles");
+    for (i = 0; i < n; i++) {
+      if (handle[i]) {
+        /* Free handle resource */
+        DART_LOG_TRACE("dart_waitall: -- free handle[%zu]: %p",
+                       i, (void*)(handle[i]));
+        dart__mpi__handle_free(handle[i]);
+        handle[i] = NULL;
+      }
+    }
+  }
+  DART_LOG_DEBUG("dart_waitall > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_test_local(
+  dart_handle_t handle,
+  int32_t* is_finished)
+{
+  DART_LOG_DEBUG("dart_test_local()");
+  if (!handle) {
+    *is_finished = 1;
+    return DART_OK;
+  }
+  MPI_Status mpi_sta;
+  MPI_Test (&(handle->request), is_finished, &mpi_sta);
+  DART_LOG_DEBUG("dart_test_local > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_testall_local(
+  dart_handle_t * handle,
+  size_t          n,
+  int32_t       * is_finished)
+{
+  size_t i, r_n;
+  DART_LOG_DEBUG("dart_testall_local()");
+  MPI_Status *mpi_sta;
+  MPI_Request *mpi_req;
+  mpi_req = (MPI_Request *)malloc(n * sizeof (MPI_Request));
+  mpi_sta = (MPI_Status *)malloc(n * sizeof (MPI_Status));
+  r_n = 0;
+  for (i = 0; i < n; i++) {
+    if (handle[i]){
+      mpi_req[r_n] = handle[i] -> request;
+      r_n++;
+    }
+  }
+  MPI_Testall(r_n, mpi_req, is_finished, mpi_sta);
+  r_n = 0;
+  for (i = 0; i < n; i++) {
+    if (handle[i]) {
+      handle[i] -> request = mpi_req[r_n];
+      r_n++;
+    }
+  }
+  free(mpi_req);
+  free(mpi_sta);
+  DART_LOG_DEBUG("dart_testall_local > finished");
+  return DART_OK;
+}
+
+/* -- Dart collective operations -- */
+
+static int _dart_barrier_count = 0;
+
+dart_ret_t dart_barrier(
+  dart_team_t teamid)
+{
+  MPI_Comm comm;
+
+  DART_LOG_DEBUG("dart_barrier() barrier count: %d", _dart_barrier_count);
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_barrier ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  _dart_barrier_count++;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  /* Fetch proper communicator from teams. */
+  comm = team_data->comm;
+  if (MPI_Barrier(comm) == MPI_SUCCESS) {
+    DART_LOG_DEBUG("dart_barrier > finished");
+    return DART_OK;
+  }
+  DART_LOG_DEBUG("dart_barrier ! MPI_Barrier failed");
+  return DART_ERR_INVAL;
+}
+
+dart_ret_t dart_bcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid)
+{
+  MPI_Comm comm;
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+
+  DART_LOG_TRACE("dart_bcast() root:%d team:%d nelem:%"PRIu64"",
+                 root.id, teamid, nelem);
+
+  if (root.id < 0) {
+    DART_LOG_ERROR("dart_bcast ! failed: root < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_bcast ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_bcast ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_bcast ! root:%d -> team:%d "
+                   "dart_adapt_teamlist_convert failed", root.id, teamid);
+    return DART_ERR_INVAL;
+  }
+  comm = team_data->comm;
+  if (MPI_Bcast(buf, nelem, mpi_dtype, root.id, comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_bcast ! root:%d -> team:%d "
+                   "MPI_Bcast failed", root.id, teamid);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_TRACE("dart_bcast > root:%d team:%d nelem:%zu finished",
+                 root.id, teamid, nelem);
+  return DART_OK;
+}
+
+dart_ret_t dart_scatter(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid)
+{
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  MPI_Comm     comm;
+
+  if (root.id < 0) {
+    DART_LOG_ERROR("dart_scatter ! failed: root < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_scatter ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_scatter ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  comm = team_data->comm;
+  if (MPI_Scatter(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           root.id,
+           comm) != MPI_SUCCESS) {
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_gather(
+  const void         * sendbuf,
+  void               * recvbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  dart_team_unit_t     root,
+  dart_team_t          teamid)
+{
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  MPI_Comm     comm;
+
+  if (root.id < 0) {
+    DART_LOG_ERROR("dart_gather ! failed: root < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_gather ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_gather ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  comm = team_data->comm;
+  if (MPI_Gather(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           root.id,
+           comm) != MPI_SUCCESS) {
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_allgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
+{
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  MPI_Comm     comm;
+  DART_LOG_TRACE("dart_allgather() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_accumulate ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_allgather ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_allgather ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  comm = team_data->comm;
+  if (MPI_Allgather(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_allgather ! team:%d nelem:%"PRIu64" failed",
+                   teamid, nelem);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_TRACE("dart_allgather > team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+  return DART_OK;
+}
+
+dart_ret_t dart_allgatherv(
+  const void      * sendbuf,
+  size_t            nsendelem,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
+{
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  MPI_Comm     comm;
+  int          comm_size;
+  DART_LOG_TRACE("dart_allgatherv() team:%d nsendelem:%"PRIu64"",
+                 teamid, nsendelem);
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_allgatherv ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nsendelem > INT_MAX) {
+    DART_LOG_ERROR("dart_allgather ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_allgatherv ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  comm = team_data->comm;
+
+  // convert nrecvcounts and recvdispls
+  MPI_Comm_size(comm, &comm_size);
+  int *inrecvcounts = malloc(sizeof(int) * comm_size);
+  int *irecvdispls  = malloc(sizeof(int) * comm_size);
+  for (int i = 0; i < comm_size; i++) {
+    if (nrecvcounts[i] > INT_MAX || recvdispls[i] > INT_MAX) {
+      DART_LOG_ERROR("dart_allgatherv ! failed: nrecvcounts[%i] > INT_MAX || recvdispls[%i] > INT_MAX", i, i);
+      free(inrecvcounts);
+      free(irecvdispls);
+      return DART_ERR_INVAL;
+    }
+    inrecvcounts[i] = nrecvcounts[i];
+    irecvdispls[i]  = recvdispls[i];
+  }
+
+  if (MPI_Allgatherv(
+           sendbuf,
+           nsendelem,
+           mpi_dtype,
+           recvbuf,
+           inrecvcounts,
+           irecvdispls,
+           mpi_dtype,
+           comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_allgatherv ! team:%d nsendelem:%"PRIu64" failed",
+                   teamid, nsendelem);
+    free(inrecvcounts);
+    free(irecvdispls);
+    return DART_ERR_INVAL;
   }
-  DART_LOG_DEBUG("dart_waitall_local > %d", ret);
-  return ret;
+  free(inrecvcounts);
+  free(irecvdispls);
+  DART_LOG_TRACE("dart_allgatherv > team:%d nsendelem:%"PRIu64"",
+                 teamid, nsendelem);
+  return DART_OK;
 }
 
-dart_ret_t dart_waitall(
-  dart_handle_t * handle,
-  size_t          n)
+/**
+ * Converts an array of counts or displacements to the int array expected
+ * by MPI, fails if any value exceeds INT_MAX.
+ */
+static dart_ret_t dart__mpi__int_array(
+  const size_t * values,
+  int          * ivalues,
+  int            n)
 {
-  size_t i, r_n;
-  DART_LOG_DEBUG("dart_waitall()");
-  if (n == 0) {
-    DART_LOG_ERROR("dart_waitall > number of handles = 0");
-    return DART_OK;
-  }
-  if (n > INT_MAX) {
-    DART_LOG_ERROR("dart_waitall ! number of handles > INT_MAX");
-    return DART_ERR_INVAL;
-  }
-  DART_LOG_DEBUG("dart_waitall: number of handles: %zu", n);
-  if (handle) {
-    MPI_Status  *mpi_sta;
-    MPI_Request *mpi_req;
-    mpi_req = (MPI_Request *) malloc(n * sizeof(MPI_Request));
-    mpi_sta = (MPI_Status *)  malloc(n * sizeof(MPI_Status));
-    /*
-     * copy requests from DART handles to MPI request array:
-     */
-    DART_LOG_TRACE("dart_waitall: copying DART handles to MPI request array");
-    r_n = 0;
-    for (i = 0; i < n; i++) {
-      if (handle[i] != NULL) {
-        DART_LOG_DEBUG("dart_waitall: -- handle[%zu](%p): "
-                       "dest:%d win:%"PRIu64" req:%"PRIu64"",
-                       i, (void*)handle[i],
-                       handle[i]->dest,
-                       (unsigned long)handle[i]->win,
-                       (unsigned long)handle[i]->request);
-        mpi_req[r_n] = handle[i]->request;
-        r_n++;
-      }
-    }
-    /*
-     * wait for communication of MPI requests:
-     */
-    DART_LOG_DEBUG("dart_waitall: MPI_Waitall, %zu requests from %zu handles",
-                   r_n, n);
-    /* From the MPI 3.1 standard:
-     *
-     * The i-th entry in array_of_statuses is set to the return
-     * status of the i-th operation. Active persistent requests
-     * are marked inactive.
-     * Requests of any other type are deallocated and the
-     * corresponding handles in the array are set to
-     * MPI_REQUEST_NULL.
-     * The list may contain null or inactive handles.
-     * The call sets to empty the status of each such entry.
-     */
-    if (r_n > 0) {
-      if (MPI_Waitall(r_n, mpi_req, mpi_sta) == MPI_SUCCESS) {
-        DART_LOG_DEBUG("dart_waitall: MPI_Waitall completed");
-      } else {
-        DART_LOG_ERROR("dart_waitall: MPI_Waitall failed");
-        DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
-        free(mpi_req);
-        DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
-        free(mpi_sta);
-        return DART_ERR_INVAL;
-      }
-    } else {
-      DART_LOG_DEBUG("dart_waitall > number of requests = 0");
-      free(mpi_req);
-      free(mpi_sta);
-      return DART_OK;
-    }
-    /*
-     * copy MPI requests back to DART handles:
-     */
-    DART_LOG_TRACE("dart_waitall: copying MPI requests back to DART handles");
-    r_n = 0;
-    for (i = 0; i < n; i++) {
-      if (handle[i]) {
-        if (mpi_req[r_n] == MPI_REQUEST_NULL) {
-          DART_LOG_TRACE("dart_waitall: -- mpi_req[%zu] = MPI_REQUEST_NULL",
-                         r_n);
-        } else {
-          DART_LOG_TRACE("dart_waitall: -- mpi_req[%zu]", r_n);
-        }
-        DART_LOG_TRACE("dart_waitall: -- mpi_sta[%zu].MPI_SOURCE: %d",
-                       r_n, mpi_sta[r_n].MPI_SOURCE);
-        DART_LOG_TRACE("dart_waitall: -- mpi_sta[%zu].MPI_ERROR:  %d:%s",
-                       r_n,
-                       mpi_sta[r_n].MPI_ERROR,
-                       DART__MPI__ERROR_STR(mpi_sta[r_n].MPI_ERROR));
-        handle[i]->request = mpi_req[r_n];
-        r_n++;
-      }
-    }
-    /*
-     * wait for completion of MPI requests at origins and targets:
-     */
-    DART_LOG_DEBUG("dart_waitall: waiting for remote completion");
-    for (i = 0; i < n; i++) {
-      if (handle[i]) {
-        if (handle[i]->request == MPI_REQUEST_NULL) {
-          DART_LOG_TRACE("dart_waitall: -- handle[%zu] done (MPI_REQUEST_NULL)",
-                         i);
-        } else {
-          DART_LOG_DEBUG("dart_waitall: -- MPI_Win_flush(handle[%zu]: %p))",
-                         i, (void*)handle[i]);
-          DART_LOG_TRACE("dart_waitall:      handle[%zu]->dest: %d",
-                         i, handle[i]->dest);
-          DART_LOG_TRACE("dart_waitall:      handle[%zu]->win:  %"PRIu64"",
-                         i, (unsigned long)handle[i]->win);
-          DART_LOG_TRACE("dart_waitall:      handle[%zu]->req:  %"PRIu64"",
-                         i, (unsigned long)handle[i]->request);
-          /*
-           * MPI_Win_flush to wait for remote completion:
-           */
-          if (MPI_Win_flush(handle[i]->dest, handle[i]->win) != MPI_SUCCESS) {
-            DART_LOG_ERROR("dart_waitall: MPI_Win_flush failed");
-            DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
-            free(mpi_req);
-            DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
-            free(mpi_sta);
-            return DART_ERR_INVAL;
-          }
-        }
-      }
-    }
-    /*
-     * free memory:
-     */
-    DART_LOG_DEBUG("dart_waitall: free handles");
-    for (i = 0; i < n; i++) {
-      if (handle[i]) {
-        /* Free handle resource */
-        DART_LOG_TRACE("dart_waitall: -- free handle[%zu]: %p",
-                       i, (void*)(handle[i]));
-        free(handle[i]);
-        handle[i] = NULL;
-      }
+  for (int i = 0; i < n; i++) {
+    if (values[i] > INT_MAX) {
+      DART_LOG_ERROR("dart__mpi__int_array ! values[%i] > INT_MAX", i);
+      return DART_ERR_INVAL;
     }
-    DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
-    free(mpi_req);
-    DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
-    free(mpi_sta);
+    ivalues[i] = values[i];
   }
-  DART_LOG_DEBUG("dart_waitall > finished");
   return DART_OK;
 }
 
-dart_ret_t dart_test_local(
-  dart_handle_t handle,
-  int32_t* is_finished)
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
 {
-  DART_LOG_DEBUG("dart_test_local()");
-  if (!handle) {
-    *is_finished = 1;
-    return DART_OK;
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  DART_LOG_TRACE("dart_alltoall() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_alltoall ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
   }
-  MPI_Status mpi_sta;
-  MPI_Test (&(handle->request), is_finished, &mpi_sta);
-  DART_LOG_DEBUG("dart_test_local > finished");
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_alltoall ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_alltoall ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  if (MPI_Alltoall(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           team_data->comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoall ! team:%d nelem:%"PRIu64" failed",
+                   teamid, nelem);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_TRACE("dart_alltoall > team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
   return DART_OK;
 }
 
-dart_ret_t dart_testall_local(
-  dart_handle_t * handle,
-  size_t          n,
-  int32_t       * is_finished)
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
 {
-  size_t i, r_n;
-  DART_LOG_DEBUG("dart_testall_local()");
-  MPI_Status *mpi_sta;
-  MPI_Request *mpi_req;
-  mpi_req = (MPI_Request *)malloc(n * sizeof (MPI_Request));
-  mpi_sta = (MPI_Status *)malloc(n * sizeof (MPI_Status));
-  r_n = 0;
-  for (i = 0; i < n; i++) {
-    if (handle[i]){
-      mpi_req[r_n] = handle[i] -> request;
-      r_n++;
-    }
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  MPI_Comm     comm;
+  int          comm_size;
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_alltoallv ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
   }
-  MPI_Testall(r_n, mpi_req, is_finished, mpi_sta);
-  r_n = 0;
-  for (i = 0; i < n; i++) {
-    if (handle[i]) {
-      handle[i] -> request = mpi_req[r_n];
-      r_n++;
-    }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
+    return DART_ERR_INVAL;
   }
-  free(mpi_req);
-  free(mpi_sta);
-  DART_LOG_DEBUG("dart_testall_local > finished");
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  comm = team_data->comm;
+
+  // convert counts and displacements
+  MPI_Comm_size(comm, &comm_size);
+  int *iargs        = malloc(sizeof(int) * 4 * comm_size);
+  int *isendcounts  = iargs;
+  int *isenddispls  = iargs + comm_size;
+  int *irecvcounts  = iargs + 2 * comm_size;
+  int *irecvdispls  = iargs + 3 * comm_size;
+  if ((sendbuf != MPI_IN_PLACE &&
+       (dart__mpi__int_array(nsendcounts, isendcounts, comm_size)
+          != DART_OK ||
+        dart__mpi__int_array(senddispls,  isenddispls, comm_size)
+          != DART_OK)) ||
+      dart__mpi__int_array(nrecvcounts, irecvcounts, comm_size) != DART_OK ||
+      dart__mpi__int_array(recvdispls,  irecvdispls, comm_size) != DART_OK) {
+    DART_LOG_ERROR("dart_alltoallv ! failed: counts or displacements "
+                   "> INT_MAX");
+    free(iargs);
+    return DART_ERR_INVAL;
+  }
+
+  if (MPI_Alltoallv(
+           sendbuf,
+           isendcounts,
+           isenddispls,
+           mpi_dtype,
+           recvbuf,
+           irecvcounts,
+           irecvdispls,
+           mpi_dtype,
+           comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d failed", teamid);
+    free(iargs);
+    return DART_ERR_INVAL;
+  }
+  free(iargs);
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
   return DART_OK;
 }
 
-/* -- Dart collective operations -- */
-
-static int _dart_barrier_count = 0;
-
-dart_ret_t dart_barrier(
-  dart_team_t teamid)
+/*
+ * Tag of point-to-point messages in dart_neighbor_alltoallv, exchanged on
+ * the team's communicator for collective operations.
+ */
+#define DART_MPI_NEIGHBOR_ALLTOALL_TAG 0
+
+dart_ret_t dart_neighbor_alltoallv(
+  const void             * sendbuf,
+  size_t                   nsendunits,
+  const dart_team_unit_t * sendunits,
+  const size_t           * nsendcounts,
+  const size_t           * senddispls,
+  dart_datatype_t          dtype,
+  void                   * recvbuf,
+  size_t                   nrecvunits,
+  const dart_team_unit_t * recvunits,
+  const size_t           * nrecvcounts,
+  const size_t           * recvdispls,
+  dart_team_t              teamid)
 {
-  MPI_Comm comm;
-
-  DART_LOG_DEBUG("dart_barrier() barrier count: %d", _dart_barrier_count);
+  MPI_Datatype mpi_dtype  = dart__mpi__datatype(dtype);
+  size_t       dtype_size = dart__mpi__datatype_sizeof(dtype);
+  MPI_Comm     comm;
+  int          comm_size;
+  int          myid;
+  int          nreq       = 0;
+  dart_ret_t   ret        = DART_OK;
+  DART_LOG_TRACE("dart_neighbor_alltoallv() team:%d nsendunits:%zu "
+                 "nrecvunits:%zu", teamid, nsendunits, nrecvunits);
 
   if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_barrier ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    DART_LOG_ERROR("dart_neighbor_alltoallv ! failed: team may not be DART_UNDEFINED_TEAM_ID");
     return DART_ERR_INVAL;
   }
 
-  _dart_barrier_count++;
-
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (team_data == NULL) {
+    DART_LOG_ERROR("dart_neighbor_alltoallv ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
     return DART_ERR_INVAL;
   }
-  /* Fetch proper communicator from teams. */
-  comm = team_data->comm;
-  if (MPI_Barrier(comm) == MPI_SUCCESS) {
-    DART_LOG_DEBUG("dart_barrier > finished");
-    return DART_OK;
+  comm = team_data->coll_comm;
+  MPI_Comm_size(comm, &comm_size);
+  MPI_Comm_rank(comm, &myid);
+  if (nsendunits > (size_t)comm_size || nrecvunits > (size_t)comm_size) {
+    DART_LOG_ERROR("dart_neighbor_alltoallv ! failed: number of neighbors "
+                   "exceeds team size");
+    return DART_ERR_INVAL;
   }
-  DART_LOG_DEBUG("dart_barrier ! MPI_Barrier failed");
-  return DART_ERR_INVAL;
+
+  MPI_Request *reqs = malloc(sizeof(MPI_Request) *
+                             (nsendunits + nrecvunits + 1));
+  int          nrecvreq = 0;
+  /*
+   * Post receives before sends so messages can be delivered directly to
+   * the receive buffer:
+   */
+  for (size_t i = 0; i < nrecvunits && ret == DART_OK; i++) {
+    if (recvunits[i].id < 0 || recvunits[i].id >= comm_size ||
+        nrecvcounts[i] > INT_MAX) {
+      DART_LOG_ERROR("dart_neighbor_alltoallv ! invalid receive from "
+                     "unit %d", recvunits[i].id);
+      ret = DART_ERR_INVAL;
+    } else if (recvunits[i].id != myid) {
+      if (MPI_Irecv((char *)recvbuf + recvdispls[i] * dtype_size,
+                    nrecvcounts[i], mpi_dtype, recvunits[i].id,
+                    DART_MPI_NEIGHBOR_ALLTOALL_TAG, comm,
+                    &reqs[nreq]) != MPI_SUCCESS) {
+        DART_LOG_ERROR("dart_neighbor_alltoallv ! MPI_Irecv failed");
+        ret = DART_ERR_INVAL;
+      } else {
+        nreq++;
+      }
+      nrecvreq = nreq;
+    }
+  }
+  for (size_t i = 0; i < nsendunits && ret == DART_OK; i++) {
+    if (sendunits[i].id < 0 || sendunits[i].id >= comm_size ||
+        nsendcounts[i] > INT_MAX) {
+      DART_LOG_ERROR("dart_neighbor_alltoallv ! invalid send to unit %d",
+                     sendunits[i].id);
+      ret = DART_ERR_INVAL;
+    } else if (sendunits[i].id == myid) {
+      /*
+       * Exchange with the calling unit itself as local copy:
+       */
+      size_t r = 0;
+      while (r < nrecvunits && recvunits[r].id != myid) { r++; }
+      if (r == nrecvunits || nrecvcounts[r] != nsendcounts[i]) {
+        DART_LOG_ERROR("dart_neighbor_alltoallv ! unmatched local exchange");
+        ret = DART_ERR_INVAL;
+      } else {
+        memcpy((char *)recvbuf + recvdispls[r] * dtype_size,
+               (const char *)sendbuf + senddispls[i] * dtype_size,
+               nsendcounts[i] * dtype_size);
+      }
+    } else if (MPI_Isend((const char *)sendbuf + senddispls[i] * dtype_size,
+                         nsendcounts[i], mpi_dtype, sendunits[i].id,
+                         DART_MPI_NEIGHBOR_ALLTOALL_TAG, comm,
+                         &reqs[nreq]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_neighbor_alltoallv ! MPI_Isend failed");
+      ret = DART_ERR_INVAL;
+    } else {
+      nreq++;
+    }
+  }
+  if (ret != DART_OK) {
+    /*
+     * Messages of the exchange might never arrive, cancel posted receives
+     * to not leave pending operations on the communicator. Sends are
+     * completed, waiting for cancelled receives completes them either as
+     * cancelled or matched:
+     */
+    for (int r = 0; r < nrecvreq; r++) {
+      MPI_Cancel(&reqs[r]);
+    }
+  }
+  if (nreq > 0 &&
+      MPI_Waitall(nreq, reqs, MPI_STATUSES_IGNORE) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_neighbor_alltoallv ! MPI_Waitall failed");
+    ret = DART_ERR_INVAL;
+  }
+  free(reqs);
+  DART_LOG_TRACE("dart_neighbor_alltoallv > team:%d ret:%d", teamid, ret);
+  return ret;
 }
 
-dart_ret_t dart_bcast(
-  void              * buf,
-  size_t              nelem,
-  dart_datatype_t     dtype,
-  dart_team_unit_t    root,
-  dart_team_t         teamid)
+dart_ret_t dart_allreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team)
 {
-  MPI_Comm comm;
+  MPI_Comm     comm;
+  MPI_Op       mpi_op    = dart__mpi__op(op);
   MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
 
-  DART_LOG_TRACE("dart_bcast() root:%d team:%d nelem:%"PRIu64"",
-                 root.id, teamid, nelem);
-
-  if (root.id < 0) {
-    DART_LOG_ERROR("dart_bcast ! failed: root < 0");
-    return DART_ERR_INVAL;
-  }
-
-  if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_bcast ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+  if (team == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_allreduce ! failed: team may not be DART_UNDEFINED_TEAM_ID");
     return DART_ERR_INVAL;
   }
 
@@ -1597,45 +3161,47 @@ dart_ret_t dart_bcast(
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_bcast ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_allreduce ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
   if (team_data == NULL) {
-    DART_LOG_ERROR("dart_bcast ! root:%d -> team:%d "
-                   "dart_adapt_teamlist_convert failed", root.id, teamid);
     return DART_ERR_INVAL;
   }
   comm = team_data->comm;
-  if (MPI_Bcast(buf, nelem, mpi_dtype, root.id, comm) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_bcast ! root:%d -> team:%d "
-                   "MPI_Bcast failed", root.id, teamid);
+  if (MPI_Allreduce(
+           sendbuf,   // send buffer
+           recvbuf,   // receive buffer
+           nelem,     // buffer size
+           mpi_dtype, // datatype
+           mpi_op,    // reduce operation
+           comm) != MPI_SUCCESS) {
     return DART_ERR_INVAL;
   }
-  DART_LOG_TRACE("dart_bcast > root:%d team:%d nelem:%zu finished",
-                 root.id, teamid, nelem);
   return DART_OK;
 }
 
-dart_ret_t dart_scatter(
+dart_ret_t dart_reduce(
   const void        * sendbuf,
   void              * recvbuf,
   size_t              nelem,
   dart_datatype_t     dtype,
+  dart_operation_t    op,
   dart_team_unit_t    root,
-  dart_team_t         teamid)
+  dart_team_t         team)
 {
-  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
   MPI_Comm     comm;
+  MPI_Op       mpi_op    = dart__mpi__op(op);
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
 
   if (root.id < 0) {
-    DART_LOG_ERROR("dart_scatter ! failed: root < 0");
+    DART_LOG_ERROR("dart_reduce ! failed: root < 0");
     return DART_ERR_INVAL;
   }
 
-  if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_scatter ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+  if (team == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_reduce ! failed: team may not be DART_UNDEFINED_TEAM_ID");
     return DART_ERR_INVAL;
   }
 
@@ -1643,22 +3209,21 @@ dart_ret_t dart_scatter(
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_scatter ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_allreduce ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
   if (team_data == NULL) {
     return DART_ERR_INVAL;
   }
   comm = team_data->comm;
-  if (MPI_Scatter(
+  if (MPI_Reduce(
            sendbuf,
-           nelem,
-           mpi_dtype,
            recvbuf,
            nelem,
            mpi_dtype,
+           mpi_op,
            root.id,
            comm) != MPI_SUCCESS) {
     return DART_ERR_INVAL;
@@ -1666,137 +3231,198 @@ dart_ret_t dart_scatter(
   return DART_OK;
 }
 
-dart_ret_t dart_gather(
-  const void         * sendbuf,
-  void               * recvbuf,
-  size_t               nelem,
-  dart_datatype_t      dtype,
-  dart_team_unit_t     root,
-  dart_team_t          teamid)
+/* -- Non-blocking collective operations -- */
+
+/**
+ * Creates a DART handle for a pending collective operation. Collective
+ * handles do not refer to a window so waiting for them does not flush.
+ */
+static dart_handle_t dart__mpi__coll_handle(void)
+{
+  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  handle->request      = MPI_REQUEST_NULL;
+  handle->win          = MPI_WIN_NULL;
+  handle->dest         = -1;
+  handle->buf          = NULL;
+  return handle;
+}
+
+dart_ret_t dart_ibarrier(
+  dart_team_t     teamid,
+  dart_handle_t * handle)
+{
+  DART_LOG_DEBUG("dart_ibarrier() team:%d", teamid);
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+  if (handle == NULL) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: handle may not be NULL");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  *handle = dart__mpi__coll_handle();
+  if (MPI_Ibarrier(team_data->comm, &((*handle)->request)) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ibarrier ! MPI_Ibarrier failed");
+    dart__mpi__handle_free(*handle);
+    *handle = NULL;
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart_ibarrier > handle:%p", (void*)(*handle));
+  return DART_OK;
+}
+
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid,
+  dart_handle_t     * handle)
 {
   MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
-  MPI_Comm     comm;
+
+  DART_LOG_TRACE("dart_ibcast() root:%d team:%d nelem:%"PRIu64"",
+                 root.id, teamid, nelem);
 
   if (root.id < 0) {
-    DART_LOG_ERROR("dart_gather ! failed: root < 0");
+    DART_LOG_ERROR("dart_ibcast ! failed: root < 0");
     return DART_ERR_INVAL;
   }
-
   if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_gather ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    DART_LOG_ERROR("dart_ibcast ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+  if (handle == NULL) {
+    DART_LOG_ERROR("dart_ibcast ! failed: handle may not be NULL");
     return DART_ERR_INVAL;
   }
-
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_gather ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_ibcast ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (team_data == NULL) {
+    DART_LOG_ERROR("dart_ibcast ! root:%d -> team:%d "
+                   "dart_adapt_teamlist_convert failed", root.id, teamid);
     return DART_ERR_INVAL;
   }
-  comm = team_data->comm;
-  if (MPI_Gather(
-           sendbuf,
-           nelem,
-           mpi_dtype,
-           recvbuf,
-           nelem,
-           mpi_dtype,
-           root.id,
-           comm) != MPI_SUCCESS) {
+  *handle = dart__mpi__coll_handle();
+  if (MPI_Ibcast(buf, nelem, mpi_dtype, root.id, team_data->comm,
+                 &((*handle)->request)) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ibcast ! root:%d -> team:%d "
+                   "MPI_Ibcast failed", root.id, teamid);
+    dart__mpi__handle_free(*handle);
+    *handle = NULL;
     return DART_ERR_INVAL;
   }
+  DART_LOG_TRACE("dart_ibcast > root:%d team:%d nelem:%zu handle:%p",
+                 root.id, teamid, nelem, (void*)(*handle));
   return DART_OK;
 }
 
-dart_ret_t dart_allgather(
+dart_ret_t dart_iallgather(
   const void      * sendbuf,
   void            * recvbuf,
   size_t            nelem,
   dart_datatype_t   dtype,
-  dart_team_t       teamid)
+  dart_team_t       teamid,
+  dart_handle_t   * handle)
 {
   MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
-  MPI_Comm     comm;
-  DART_LOG_TRACE("dart_allgather() team:%d nelem:%"PRIu64"",
+  DART_LOG_TRACE("dart_iallgather() team:%d nelem:%"PRIu64"",
                  teamid, nelem);
 
   if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_accumulate ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    DART_LOG_ERROR("dart_iallgather ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+  if (handle == NULL) {
+    DART_LOG_ERROR("dart_iallgather ! failed: handle may not be NULL");
     return DART_ERR_INVAL;
   }
-
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_allgather ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_iallgather ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (team_data == NULL) {
-    DART_LOG_ERROR("dart_allgather ! team:%d "
+    DART_LOG_ERROR("dart_iallgather ! team:%d "
                    "dart_adapt_teamlist_convert failed", teamid);
     return DART_ERR_INVAL;
   }
   if (sendbuf == recvbuf || NULL == sendbuf) {
     sendbuf = MPI_IN_PLACE;
   }
-  comm = team_data->comm;
-  if (MPI_Allgather(
+  *handle = dart__mpi__coll_handle();
+  if (MPI_Iallgather(
            sendbuf,
            nelem,
            mpi_dtype,
            recvbuf,
            nelem,
            mpi_dtype,
-           comm) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_allgather ! team:%d nelem:%"PRIu64" failed",
+           team_data->comm,
+           &((*handle)->request)) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallgather ! team:%d nelem:%"PRIu64" failed",
                    teamid, nelem);
+    dart__mpi__handle_free(*handle);
+    *handle = NULL;
     return DART_ERR_INVAL;
   }
-  DART_LOG_TRACE("dart_allgather > team:%d nelem:%"PRIu64"",
-                 teamid, nelem);
+  DART_LOG_TRACE("dart_iallgather > team:%d nelem:%"PRIu64" handle:%p",
+                 teamid, nelem, (void*)(*handle));
   return DART_OK;
 }
 
-dart_ret_t dart_allgatherv(
+dart_ret_t dart_iallgatherv(
   const void      * sendbuf,
   size_t            nsendelem,
   dart_datatype_t   dtype,
   void            * recvbuf,
   const size_t    * nrecvcounts,
   const size_t    * recvdispls,
-  dart_team_t       teamid)
+  dart_team_t       teamid,
+  dart_handle_t   * handle)
 {
   MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
   MPI_Comm     comm;
   int          comm_size;
-  DART_LOG_TRACE("dart_allgatherv() team:%d nsendelem:%"PRIu64"",
+  DART_LOG_TRACE("dart_iallgatherv() team:%d nsendelem:%"PRIu64"",
                  teamid, nsendelem);
 
   if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_allgatherv ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    DART_LOG_ERROR("dart_iallgatherv ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+  if (handle == NULL) {
+    DART_LOG_ERROR("dart_iallgatherv ! failed: handle may not be NULL");
     return DART_ERR_INVAL;
   }
-
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nsendelem > INT_MAX) {
-    DART_LOG_ERROR("dart_allgather ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_iallgatherv ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (team_data == NULL) {
-    DART_LOG_ERROR("dart_allgatherv ! team:%d "
+    DART_LOG_ERROR("dart_iallgatherv ! team:%d "
                    "dart_adapt_teamlist_convert failed", teamid);
     return DART_ERR_INVAL;
   }
@@ -1805,65 +3431,71 @@ dart_ret_t dart_allgatherv(
   }
   comm = team_data->comm;
 
-  // convert nrecvcounts and recvdispls
+  /*
+   * Counts and displacements must remain valid until completion of the
+   * operation and are therefore owned by the handle:
+   */
   MPI_Comm_size(comm, &comm_size);
-  int *inrecvcounts = malloc(sizeof(int) * comm_size);
-  int *irecvdispls  = malloc(sizeof(int) * comm_size);
+  int *icounts = malloc(sizeof(int) * 2 * comm_size);
+  int *idispls = icounts + comm_size;
   for (int i = 0; i < comm_size; i++) {
     if (nrecvcounts[i] > INT_MAX || recvdispls[i] > INT_MAX) {
-      DART_LOG_ERROR("dart_allgatherv ! failed: nrecvcounts[%i] > INT_MAX || recvdispls[%i] > INT_MAX", i, i);
-      free(inrecvcounts);
-      free(irecvdispls);
+      DART_LOG_ERROR("dart_iallgatherv ! failed: nrecvcounts[%i] > INT_MAX || recvdispls[%i] > INT_MAX", i, i);
+      free(icounts);
       return DART_ERR_INVAL;
     }
-    inrecvcounts[i] = nrecvcounts[i];
-    irecvdispls[i]  = recvdispls[i];
+    icounts[i] = nrecvcounts[i];
+    idispls[i] = recvdispls[i];
   }
 
-  if (MPI_Allgatherv(
+  *handle = dart__mpi__coll_handle();
+  (*handle)->buf = icounts;
+  if (MPI_Iallgatherv(
            sendbuf,
            nsendelem,
            mpi_dtype,
            recvbuf,
-           inrecvcounts,
-           irecvdispls,
+           icounts,
+           idispls,
            mpi_dtype,
-           comm) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_allgatherv ! team:%d nsendelem:%"PRIu64" failed",
+           comm,
+           &((*handle)->request)) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallgatherv ! team:%d nsendelem:%"PRIu64" failed",
                    teamid, nsendelem);
-    free(inrecvcounts);
-    free(irecvdispls);
+    dart__mpi__handle_free(*handle);
+    *handle = NULL;
     return DART_ERR_INVAL;
   }
-  free(inrecvcounts);
-  free(irecvdispls);
-  DART_LOG_TRACE("dart_allgatherv > team:%d nsendelem:%"PRIu64"",
-                 teamid, nsendelem);
+  DART_LOG_TRACE("dart_iallgatherv > team:%d nsendelem:%"PRIu64" handle:%p",
+                 teamid, nsendelem, (void*)(*handle));
   return DART_OK;
 }
 
-dart_ret_t dart_allreduce(
+dart_ret_t dart_iallreduce(
   const void       * sendbuf,
   void             * recvbuf,
   size_t             nelem,
   dart_datatype_t    dtype,
   dart_operation_t   op,
-  dart_team_t        team)
+  dart_team_t        team,
+  dart_handle_t    * handle)
 {
-  MPI_Comm     comm;
   MPI_Op       mpi_op    = dart__mpi__op(op);
   MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
 
   if (team == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_allreduce ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    DART_LOG_ERROR("dart_iallreduce ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+  if (handle == NULL) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: handle may not be NULL");
     return DART_ERR_INVAL;
   }
-
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_allreduce ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_iallreduce ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
 
@@ -1871,65 +3503,163 @@ dart_ret_t dart_allreduce(
   if (team_data == NULL) {
     return DART_ERR_INVAL;
   }
-  comm = team_data->comm;
-  if (MPI_Allreduce(
+  if (sendbuf == recvbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  *handle = dart__mpi__coll_handle();
+  if (MPI_Iallreduce(
            sendbuf,   // send buffer
            recvbuf,   // receive buffer
            nelem,     // buffer size
            mpi_dtype, // datatype
            mpi_op,    // reduce operation
-           comm) != MPI_SUCCESS) {
+           team_data->comm,
+           &((*handle)->request)) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallreduce ! MPI_Iallreduce failed");
+    dart__mpi__handle_free(*handle);
+    *handle = NULL;
     return DART_ERR_INVAL;
   }
   return DART_OK;
 }
 
-dart_ret_t dart_reduce(
-  const void        * sendbuf,
-  void              * recvbuf,
-  size_t              nelem,
-  dart_datatype_t     dtype,
-  dart_operation_t    op,
-  dart_team_unit_t    root,
-  dart_team_t         team)
+dart_ret_t dart_ialltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid,
+  dart_handle_t   * handle)
 {
-  MPI_Comm     comm;
-  MPI_Op       mpi_op    = dart__mpi__op(op);
   MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  DART_LOG_TRACE("dart_ialltoall() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
 
-  if (root.id < 0) {
-    DART_LOG_ERROR("dart_reduce ! failed: root < 0");
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_ialltoall ! failed: team may not be DART_UNDEFINED_TEAM_ID");
     return DART_ERR_INVAL;
   }
-
-  if (team == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_reduce ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+  if (handle == NULL) {
+    DART_LOG_ERROR("dart_ialltoall ! failed: handle may not be NULL");
     return DART_ERR_INVAL;
   }
-
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_allreduce ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_ialltoall ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (team_data == NULL) {
+    DART_LOG_ERROR("dart_ialltoall ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
     return DART_ERR_INVAL;
   }
-  comm = team_data->comm;
-  if (MPI_Reduce(
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  *handle = dart__mpi__coll_handle();
+  if (MPI_Ialltoall(
            sendbuf,
+           nelem,
+           mpi_dtype,
            recvbuf,
            nelem,
            mpi_dtype,
-           mpi_op,
-           root.id,
-           comm) != MPI_SUCCESS) {
+           team_data->comm,
+           &((*handle)->request)) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ialltoall ! team:%d nelem:%"PRIu64" failed",
+                   teamid, nelem);
+    dart__mpi__handle_free(*handle);
+    *handle = NULL;
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_TRACE("dart_ialltoall > team:%d nelem:%"PRIu64" handle:%p",
+                 teamid, nelem, (void*)(*handle));
+  return DART_OK;
+}
+
+dart_ret_t dart_ialltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid,
+  dart_handle_t   * handle)
+{
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  MPI_Comm     comm;
+  int          comm_size;
+  DART_LOG_TRACE("dart_ialltoallv() team:%d", teamid);
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_ialltoallv ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+  if (handle == NULL) {
+    DART_LOG_ERROR("dart_ialltoallv ! failed: handle may not be NULL");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_ialltoallv ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  comm = team_data->comm;
+
+  /*
+   * Counts and displacements must remain valid until completion of the
+   * operation and are therefore owned by the handle:
+   */
+  MPI_Comm_size(comm, &comm_size);
+  int *iargs        = malloc(sizeof(int) * 4 * comm_size);
+  int *isendcounts  = iargs;
+  int *isenddispls  = iargs + comm_size;
+  int *irecvcounts  = iargs + 2 * comm_size;
+  int *irecvdispls  = iargs + 3 * comm_size;
+  if ((sendbuf != MPI_IN_PLACE &&
+       (dart__mpi__int_array(nsendcounts, isendcounts, comm_size)
+          != DART_OK ||
+        dart__mpi__int_array(senddispls,  isenddispls, comm_size)
+          != DART_OK)) ||
+      dart__mpi__int_array(nrecvcounts, irecvcounts, comm_size) != DART_OK ||
+      dart__mpi__int_array(recvdispls,  irecvdispls, comm_size) != DART_OK) {
+    DART_LOG_ERROR("dart_ialltoallv ! failed: counts or displacements "
+                   "> INT_MAX");
+    free(iargs);
+    return DART_ERR_INVAL;
+  }
+
+  *handle = dart__mpi__coll_handle();
+  (*handle)->buf = iargs;
+  if (MPI_Ialltoallv(
+           sendbuf,
+           isendcounts,
+           isenddispls,
+           mpi_dtype,
+           recvbuf,
+           irecvcounts,
+           irecvdispls,
+           mpi_dtype,
+           comm,
+           &((*handle)->request)) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ialltoallv ! team:%d failed", teamid);
+    dart__mpi__handle_free(*handle);
+    *handle = NULL;
     return DART_ERR_INVAL;
   }
+  DART_LOG_TRACE("dart_ialltoallv > team:%d handle:%p",
+                 teamid, (void*)(*handle));
   return DART_OK;
 }
 
@@ -17,11 +17,14 @@
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_mempool.h>
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
 
 #include <stdio.h>
+#include <stdint.h>
+#include <string.h>
 #include <mpi.h>
 
 /* For PRIu64, uint64_t in printf */
@@ -67,6 +70,50 @@ dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
   return DART_OK;
 }
 
+dart_ret_t dart_gptr_getaddr_shared(const dart_gptr_t gptr, void **addr)
+{
+  dart_team_unit_t myid;
+
+  *addr = NULL;
+  if (dart_team_myid(gptr.teamid, &myid) != DART_OK) {
+    DART_LOG_ERROR("dart_gptr_getaddr_shared ! Unknown team %i",
+                   gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+  if (myid.id == gptr.unitid) {
+    return dart_gptr_getaddr(gptr, addr);
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  int16_t  segid  = gptr.segid;
+  uint64_t offset = gptr.addr_or_offs.offset;
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_gptr_getaddr_shared ! Unknown team %i",
+                   gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+  dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
+  if (segid < 0 || luid.id < 0) {
+    /* registered memory or unit on a different node */
+    return DART_OK;
+  }
+  char * baseptr;
+  if (segid != DART_SEGMENT_LOCAL) {
+    if (dart_segment_get_baseptr(
+          &team_data->segdata, segid, luid, &baseptr) != DART_OK) {
+      DART_LOG_ERROR("dart_gptr_getaddr_shared ! Unknown segment %i", segid);
+      return DART_ERR_INVAL;
+    }
+  } else {
+    baseptr = dart_sharedmem_local_baseptr_set[luid.id];
+  }
+  if (baseptr != NULL) {
+    *addr = baseptr + offset;
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return DART_OK;
+}
+
 dart_ret_t dart_gptr_setaddr(dart_gptr_t* gptr, void* addr)
 {
   int16_t segid = gptr->segid;
@@ -135,37 +182,40 @@ dart_ret_t dart_memalloc(
   dart_myid(&unitid);
   gptr->unitid  = unitid.id;
   gptr->flags   = 0;
-  gptr->segid   = DART_SEGMENT_LOCAL; /* For local allocation, the segid is marked as '0'. */
   gptr->teamid  = DART_TEAM_ALL;      /* Locally allocated gptr belong to the global team. */
-  gptr->addr_or_offs.offset = dart_buddy_alloc(dart_localpool, nbytes);
-  if (gptr->addr_or_offs.offset == (uint64_t)(-1)) {
+  /* The segid is DART_SEGMENT_LOCAL unless the pool has been extended. */
+  if (dart__mpi__mempool_alloc(
+        nbytes, &gptr->segid, &gptr->addr_or_offs.offset) != DART_OK) {
     DART_LOG_ERROR("dart_memalloc: Out of bounds "
-                   "(dart_buddy_alloc %zu bytes): global memory exhausted",
+                   "(dart__mpi__mempool_alloc %zu bytes): "
+                   "global memory exhausted",
                    nbytes);
     *gptr = DART_GPTR_NULL;
     return DART_ERR_OTHER;
   }
-  DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu offset:%"PRIu64"",
-                 nbytes, gptr->addr_or_offs.offset);
+  DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu segid:%d "
+                 "offset:%"PRIu64"",
+                 nbytes, gptr->segid, gptr->addr_or_offs.offset);
   return DART_OK;
 }
 
 dart_ret_t dart_memfree (dart_gptr_t gptr)
 {
-  if (gptr.segid != DART_SEGMENT_LOCAL || gptr.teamid != DART_TEAM_ALL) {
-    DART_LOG_ERROR("dart_memfree: invalid segment id:%d or team id:%d",
-                   gptr.segid, gptr.teamid);
+  if (gptr.teamid != DART_TEAM_ALL) {
+    DART_LOG_ERROR("dart_memfree: invalid team id:%d", gptr.teamid);
     return DART_ERR_INVAL;
   }
 
-  if (dart_buddy_free(dart_localpool, gptr.addr_or_offs.offset) == -1) {
+  if (dart__mpi__mempool_free(gptr.segid, gptr.addr_or_offs.offset)
+      != DART_OK) {
     DART_LOG_ERROR("dart_memfree: invalid local global pointer: "
-                   "invalid offset: %"PRIu64"",
-                   gptr.addr_or_offs.offset);
+                   "invalid segment id:%d or offset: %"PRIu64"",
+                   gptr.segid, gptr.addr_or_offs.offset);
     return DART_ERR_INVAL;
   }
-  DART_LOG_DEBUG("dart_memfree: local free, gptr.unitid:%2d offset:%"PRIu64"",
-                 gptr.unitid, gptr.addr_or_offs.offset);
+  DART_LOG_DEBUG("dart_memfree: local free, gptr.unitid:%2d segid:%d "
+                 "offset:%"PRIu64"",
+                 gptr.unitid, gptr.segid, gptr.addr_or_offs.offset);
   return DART_OK;
 }
 
@@ -594,7 +644,11 @@ dart_team_memderegister(
     return DART_ERR_INVAL;
   }
 
-  MPI_Win_detach(win, sub_mem);
+  if (sub_mem != NULL) {
+    // Segments created in dart_team_memregister_dynamic have no memory
+    // region attached on their own:
+    MPI_Win_detach(win, sub_mem);
+  }
   if (dart_segment_free(&team_data->segdata, segid) != DART_OK) {
     return DART_ERR_INVAL;
   }
@@ -610,4 +664,116 @@ dart_team_memderegister(
   return DART_OK;
 }
 
+dart_ret_t
+dart_team_memregister_dynamic(
+   dart_team_t       teamid,
+   dart_gptr_t     * gptr)
+{
+  size_t size;
+  dart_team_size(teamid, &size);
+
+  *gptr = DART_GPTR_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_team_memregister_dynamic ! failed: Unknown team %i!",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_segment_info_t *segment = dart_segment_alloc(
+                                &team_data->segdata, DART_SEGMENT_REGISTER);
+  if (segment == NULL) {
+    DART_LOG_ERROR(
+        "dart_team_memregister_dynamic: Allocation of segment data failed");
+    return DART_ERR_OTHER;
+  }
+
+  // Offsets in the segment are absolute addresses at every unit:
+  if (segment->disp == NULL) {
+    segment->disp = malloc(size * sizeof(MPI_Aint));
+  }
+  memset(segment->disp, 0, size * sizeof(MPI_Aint));
 
+  segment->size        = 0;
+  segment->win         = MPI_WIN_NULL;
+  segment->selfbaseptr = NULL;
+  segment->flags       = 0;
+
+  gptr->unitid = 0;
+  gptr->segid  = segment->segid;
+  gptr->teamid = teamid;
+  gptr->flags  = 0;
+  gptr->addr_or_offs.offset = 0;
+
+  DART_LOG_DEBUG(
+    "dart_team_memregister_dynamic: segment:%d across team %d",
+    segment->segid, teamid);
+  return DART_OK;
+}
+
+dart_ret_t
+dart_memattach(
+   dart_gptr_t       segment,
+   size_t            nlelem,
+   dart_datatype_t   dtype,
+   void            * addr,
+   dart_gptr_t     * gptr)
+{
+  size_t nbytes = nlelem * dart__mpi__datatype_sizeof(dtype);
+
+  *gptr = DART_GPTR_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(segment.teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_memattach ! failed: Unknown team %i!",
+                   segment.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (nbytes == 0) {
+    /* Nothing to attach, detaching the null pointer is a no-op */
+    DART_LOG_DEBUG("dart_memattach: empty region at %p", addr);
+    return DART_OK;
+  }
+  if (MPI_Win_attach(team_data->window, addr, nbytes) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_memattach ! MPI_Win_attach failed, "
+                   "addr:%p nbytes:%zu", addr, nbytes);
+    return DART_ERR_OTHER;
+  }
+
+  *gptr        = segment;
+  gptr->unitid = team_data->unitid;
+  gptr->addr_or_offs.offset = (uint64_t)(uintptr_t)addr;
+
+  DART_LOG_DEBUG(
+    "dart_memattach: unit:%d nbytes:%zu addr:%p segment:%d team:%d",
+    team_data->unitid, nbytes, addr, segment.segid, segment.teamid);
+  return DART_OK;
+}
+
+dart_ret_t
+dart_memdetach(
+   dart_gptr_t gptr)
+{
+  if (DART_GPTR_ISNULL(gptr)) {
+    return DART_OK;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_memdetach ! failed: Unknown team %i!", gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  void * addr = (void *)(uintptr_t)gptr.addr_or_offs.offset;
+  if (MPI_Win_detach(team_data->window, addr) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_memdetach ! MPI_Win_detach failed, addr:%p",
+                   addr);
+    return DART_ERR_OTHER;
+  }
+
+  DART_LOG_DEBUG("dart_memdetach: addr:%p segment:%d team:%d",
+                 addr, gptr.segid, gptr.teamid);
+  return DART_OK;
+}
@@ -14,13 +14,13 @@
 
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_mempool.h>
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
 
-#define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
 
 /* Point to the base address of memory region for local allocation. */
 static int _init_by_dart = 0;
@@ -54,11 +54,12 @@ dart_ret_t do_init()
   dart_next_availteamid++;
 
   team_data->comm = DART_COMM_WORLD;
+  MPI_Comm_dup(team_data->comm, &team_data->coll_comm);
 
   MPI_Comm_rank(team_data->comm, &team_data->unitid);
   MPI_Comm_size(team_data->comm, &team_data->size);
 
-  dart_localpool = dart_buddy_new(DART_LOCAL_ALLOC_SIZE);
+  size_t local_alloc_size = dart__mpi__mempool_size();
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
@@ -67,15 +68,15 @@ dart_ret_t do_init()
   MPI_Comm sharedmem_comm = team_data->sharedmem_comm;
 
   if (sharedmem_comm != MPI_COMM_NULL) {
-    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%d)",
-                   DART_LOCAL_ALLOC_SIZE);
+    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%zu)",
+                   local_alloc_size);
     MPI_Info win_info;
     MPI_Info_create(&win_info);
     MPI_Info_set(win_info, "alloc_shared_noncontig", "true");
     /* Reserve a free shared memory block for non-collective
      * global memory allocation. */
     int ret = MPI_Win_allocate_shared(
-                DART_LOCAL_ALLOC_SIZE,
+                local_alloc_size,
                 sizeof(char),
                 win_info,
                 sharedmem_comm,
@@ -119,7 +120,7 @@ dart_ret_t do_init()
   }
 #else
   MPI_Alloc_mem(
-    DART_LOCAL_ALLOC_SIZE,
+    local_alloc_size,
     MPI_INFO_NULL,
     &dart_mempool_localalloc);
 #endif
@@ -129,7 +130,7 @@ dart_ret_t do_init()
    * Return in dart_win_local_alloc. */
   MPI_Win_create(
     dart_mempool_localalloc,
-    DART_LOCAL_ALLOC_SIZE,
+    local_alloc_size,
     sizeof(char),
     MPI_INFO_NULL,
     DART_COMM_WORLD,
@@ -153,6 +154,12 @@ dart_ret_t do_init()
    * collective allocation function through win. */
   MPI_Win_lock_all(0, win);
 
+  /* Extension arenas of the local memory pool are attached to win. */
+  if (dart__mpi__mempool_init(local_alloc_size) != DART_OK) {
+    DART_LOG_ERROR("dart_init: failed to initialize local memory pool");
+    return DART_ERR_OTHER;
+  }
+
   DART_LOG_DEBUG("dart_init: communication backend initialization finished");
 
   _dart_initialized = 1;
@@ -256,6 +263,8 @@ dart_ret_t dart_exit()
     return DART_ERR_OTHER;
   }
 
+  dart__mpi__mempool_fini();
+
   dart_segment_fini(&team_data->segdata);
 
   if (MPI_Win_unlock_all(team_data->window) != MPI_SUCCESS) {
@@ -281,8 +290,8 @@ dart_ret_t dart_exit()
   }
 #endif
   MPI_Win_free(&team_data->window);
+  MPI_Comm_free(&team_data->coll_comm);
 
-  dart_buddy_delete(dart_localpool);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   free(team_data->sharedmem_tab);
   free(dart_sharedmem_local_baseptr_set);
@@ -290,6 +299,8 @@ dart_ret_t dart_exit()
 
   dart_adapt_teamlist_destroy();
 
+  dart__mpi__datatype_fini();
+
   MPI_Comm_free(&dart_comm_world);
 
   if (_init_by_dart) {
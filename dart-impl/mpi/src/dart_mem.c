@@ -37,7 +37,6 @@ struct dart_buddy {
 
 /* Help to do memory management work for local allocation/free */
 char* dart_mempool_localalloc;
-struct dart_buddy  *  dart_localpool;
 
 static inline int
 num_level(size_t size)
@@ -119,8 +118,8 @@ _mark_parent(struct dart_buddy * self, int index) {
 size_t
 dart_buddy_alloc(struct dart_buddy * self, size_t s) {
   int size;
-  // honor the alignment
-  s >>= DART_MEM_ALIGN_BITS;
+  // honor the alignment, round up to whole blocks
+  s = (s + DART_MEM_ALIGN_BYTES - 1) >> DART_MEM_ALIGN_BITS;
 	if (s == 0) {
 		size = 1;
 	}
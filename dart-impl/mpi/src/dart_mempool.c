@@ -0,0 +1,561 @@
+/**
+ * \file dart_mempool.c
+ *
+ * Size-class slab allocator with per-thread caches for local allocations
+ * in \c dart_memalloc, see \c dart_mempool.h.
+ */
+
+#include <dash/dart/mpi/dart_mempool.h>
+#include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_globmem_priv.h>
+
+#include <dash/dart/base/mutex.h>
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/assert.h>
+
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/if/dart_team_group.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/* Size of a slab, slabs are allocated from the buddy allocator of an
+ * arena and are therefore aligned to their size */
+#define DART__MEMPOOL__SLAB_BITS        16
+#define DART__MEMPOOL__SLAB_SIZE        (((size_t)1) << DART__MEMPOOL__SLAB_BITS)
+/* Number of size classes, multiples of 16 bytes up to 64 bytes and four
+ * per power of two up to 1 KB */
+#define DART__MEMPOOL__NUM_CLASSES      21
+#define DART__MEMPOOL__MAX_CLASS_SIZE   1024
+/* Capacity of a per-thread cache for a single size class and number of
+ * blocks exchanged between cache and slabs at once */
+#define DART__MEMPOOL__CACHE_SIZE       16
+#define DART__MEMPOOL__CACHE_BATCH      8
+/* Maximum number of arenas and size of a single arena, limited by the
+ * buddy allocator */
+#define DART__MEMPOOL__MAX_ARENAS       16
+#define DART__MEMPOOL__MAX_ARENA_SIZE   (((size_t)1) << 30)
+/* Blocks are identified by arena index and offset in the arena */
+#define DART__MEMPOOL__ARENA_SHIFT      56
+#define DART__MEMPOOL__OFFSET_MASK      ((((uint64_t)1) << DART__MEMPOOL__ARENA_SHIFT) - 1)
+
+#if defined(DART_HAVE_PTHREADS)
+#define DART__MEMPOOL__THREAD_LOCAL __thread
+#else
+#define DART__MEMPOOL__THREAD_LOCAL
+#endif
+
+typedef struct dart__mempool_slab dart__mempool_slab_t;
+
+struct dart__mempool_slab {
+  /* Neighbors in the list of slabs of the size class with free blocks */
+  dart__mempool_slab_t * next;
+  dart__mempool_slab_t * prev;
+  /* First block of the slab */
+  uint64_t               block;
+  int                    sclass;
+  uint32_t               nblocks;
+  uint32_t               nfree;
+  /* Stack of indices of free blocks */
+  uint16_t               free_idx[];
+};
+
+typedef struct {
+  /* Base address of an extension arena, NULL for the initial arena */
+  char                  * base;
+  size_t                  size;
+  struct dart_buddy     * buddy;
+  /* Slab occupying every slab-sized page of the arena, or NULL */
+  dart__mempool_slab_t ** slabs;
+} dart__mempool_arena_t;
+
+typedef struct {
+  uint32_t epoch;
+  uint32_t count[DART__MEMPOOL__NUM_CLASSES];
+  uint64_t blocks[DART__MEMPOOL__NUM_CLASSES][DART__MEMPOOL__CACHE_SIZE];
+} dart__mempool_cache_t;
+
+/* All classes except the smallest are multiples of 16 bytes, so blocks
+ * larger than 8 bytes are aligned to 16 bytes like memory returned from
+ * malloc */
+static const uint32_t _class_sizes[DART__MEMPOOL__NUM_CLASSES] = {
+     8,   16,   32,   48,   64,
+    80,   96,  112,  128,  160,  192,  224,  256,
+   320,  384,  448,  512,  640,  768,  896, 1024
+};
+
+static struct {
+  dart_mutex_t            mutex;
+  dart__mempool_arena_t   arenas[DART__MEMPOOL__MAX_ARENAS];
+  int                     num_arenas;
+  int                     extend;
+  /* Registered segment of extension arenas */
+  dart_gptr_t             ext_segment;
+  /* Slabs with free blocks of every size class */
+  dart__mempool_slab_t  * partial[DART__MEMPOOL__NUM_CLASSES];
+  /* Incremented in every initialization to invalidate thread caches */
+  uint32_t                epoch;
+} _pool;
+
+/* Blocks cached by the calling thread. Blocks cached by a thread that
+ * terminates are not returned to the pool. */
+static DART__MEMPOOL__THREAD_LOCAL dart__mempool_cache_t _cache;
+
+static inline size_t
+next_pow_of_2(size_t x)
+{
+  size_t pow = 1;
+  while (pow < x) {
+    pow <<= 1;
+  }
+  return pow;
+}
+
+static inline int
+size_class(size_t nbytes)
+{
+  if (nbytes <= 8) {
+    return 0;
+  }
+  if (nbytes <= 64) {
+    return (int)((nbytes + 15) >> 4);
+  }
+  size_t n = nbytes - 1;
+  int    b = 6;
+  while ((n >> (b + 1)) != 0) {
+    b++;
+  }
+  return 5 + (b - 6) * 4 + (int)(n >> (b - 2)) - 4;
+}
+
+static inline uint64_t
+make_block(int arena, uint64_t offset)
+{
+  return (((uint64_t)arena) << DART__MEMPOOL__ARENA_SHIFT) | offset;
+}
+
+static inline int
+block_arena(uint64_t block)
+{
+  return (int)(block >> DART__MEMPOOL__ARENA_SHIFT);
+}
+
+static inline uint64_t
+block_offset(uint64_t block)
+{
+  return block & DART__MEMPOOL__OFFSET_MASK;
+}
+
+static inline dart__mempool_slab_t *
+block_slab(uint64_t block)
+{
+  dart__mempool_arena_t * arena = &_pool.arenas[block_arena(block)];
+  return arena->slabs[block_offset(block) >> DART__MEMPOOL__SLAB_BITS];
+}
+
+static dart_ret_t
+arena_init(dart__mempool_arena_t * arena, char * base, size_t size)
+{
+  arena->base  = base;
+  arena->size  = size;
+  arena->buddy = dart_buddy_new(size);
+  arena->slabs = calloc(size / DART__MEMPOOL__SLAB_SIZE,
+                        sizeof(dart__mempool_slab_t *));
+  if (arena->buddy == NULL || arena->slabs == NULL) {
+    DART_LOG_ERROR("dart__mpi__mempool: failed to create arena of %zu bytes",
+                   size);
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+static void
+arena_fini(dart__mempool_arena_t * arena)
+{
+  size_t npages = arena->size / DART__MEMPOOL__SLAB_SIZE;
+  for (size_t p = 0; p < npages; ++p) {
+    free(arena->slabs[p]);
+  }
+  free(arena->slabs);
+  dart_buddy_delete(arena->buddy);
+  arena->slabs = NULL;
+  arena->buddy = NULL;
+}
+
+/**
+ * Attaches an extension arena for a request of \c nbytes.
+ * Must be called with the pool mutex held.
+ */
+static dart_ret_t
+arena_extend(size_t nbytes)
+{
+  if (!_pool.extend || _pool.num_arenas == DART__MEMPOOL__MAX_ARENAS) {
+    return DART_ERR_OTHER;
+  }
+  dart__mempool_arena_t * last = &_pool.arenas[_pool.num_arenas - 1];
+  size_t size = 2 * last->size;
+  if (size < next_pow_of_2(nbytes)) {
+    size = next_pow_of_2(nbytes);
+  }
+  if (size > DART__MEMPOOL__MAX_ARENA_SIZE) {
+    size = DART__MEMPOOL__MAX_ARENA_SIZE;
+  }
+  if (nbytes > size) {
+    return DART_ERR_OTHER;
+  }
+  char * base;
+  if (MPI_Alloc_mem(size, MPI_INFO_NULL, &base) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__mempool: MPI_Alloc_mem(%zu) failed", size);
+    return DART_ERR_OTHER;
+  }
+  dart_team_data_t * team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  if (MPI_Win_attach(team_data->window, base, size) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__mempool: MPI_Win_attach(%zu) failed", size);
+    MPI_Free_mem(base);
+    return DART_ERR_OTHER;
+  }
+
+  dart__mempool_arena_t * arena = &_pool.arenas[_pool.num_arenas];
+  if (arena_init(arena, base, size) != DART_OK) {
+    MPI_Win_detach(team_data->window, base);
+    MPI_Free_mem(base);
+    return DART_ERR_OTHER;
+  }
+  _pool.num_arenas++;
+  DART_LOG_DEBUG("dart__mpi__mempool: attached arena %d, %zu bytes at %p",
+                 _pool.num_arenas - 1, size, base);
+  return DART_OK;
+}
+
+/**
+ * Allocates a block of \c nbytes from the buddy allocators of the arenas,
+ * extending the pool if necessary.
+ * Must be called with the pool mutex held.
+ */
+static dart_ret_t
+arena_alloc(size_t nbytes, uint64_t * block)
+{
+  for (int a = 0; ; ++a) {
+    if (a == _pool.num_arenas) {
+      dart_ret_t ret = arena_extend(nbytes);
+      if (ret != DART_OK) {
+        return ret;
+      }
+    }
+    size_t offset = dart_buddy_alloc(_pool.arenas[a].buddy, nbytes);
+    if (offset != (size_t)(-1)) {
+      *block = make_block(a, offset);
+      return DART_OK;
+    }
+  }
+}
+
+static void
+slab_list_insert(dart__mempool_slab_t * slab)
+{
+  dart__mempool_slab_t ** head = &_pool.partial[slab->sclass];
+  slab->prev = NULL;
+  slab->next = *head;
+  if (*head != NULL) {
+    (*head)->prev = slab;
+  }
+  *head = slab;
+}
+
+static void
+slab_list_remove(dart__mempool_slab_t * slab)
+{
+  if (slab->prev != NULL) {
+    slab->prev->next = slab->next;
+  } else {
+    _pool.partial[slab->sclass] = slab->next;
+  }
+  if (slab->next != NULL) {
+    slab->next->prev = slab->prev;
+  }
+  slab->next = NULL;
+  slab->prev = NULL;
+}
+
+/**
+ * Creates a slab of the given size class.
+ * Must be called with the pool mutex held.
+ */
+static dart__mempool_slab_t *
+slab_new(int sclass)
+{
+  uint64_t block;
+  if (arena_alloc(DART__MEMPOOL__SLAB_SIZE, &block) != DART_OK) {
+    return NULL;
+  }
+  uint32_t nblocks = DART__MEMPOOL__SLAB_SIZE / _class_sizes[sclass];
+  dart__mempool_slab_t * slab = malloc(sizeof(dart__mempool_slab_t) +
+                                       nblocks * sizeof(uint16_t));
+  slab->block   = block;
+  slab->sclass  = sclass;
+  slab->nblocks = nblocks;
+  slab->nfree   = nblocks;
+  for (uint32_t i = 0; i < nblocks; ++i) {
+    // Hand out blocks in ascending order:
+    slab->free_idx[i] = (uint16_t)(nblocks - 1 - i);
+  }
+  dart__mempool_arena_t * arena = &_pool.arenas[block_arena(block)];
+  arena->slabs[block_offset(block) >> DART__MEMPOOL__SLAB_BITS] = slab;
+  slab_list_insert(slab);
+  return slab;
+}
+
+/**
+ * Takes up to \c nblocks free blocks of a size class from the slabs.
+ * Must be called with the pool mutex held.
+ */
+static uint32_t
+slab_take(int sclass, uint64_t * blocks, uint32_t nblocks)
+{
+  uint32_t ntaken = 0;
+  while (ntaken < nblocks) {
+    dart__mempool_slab_t * slab = _pool.partial[sclass];
+    if (slab == NULL && (slab = slab_new(sclass)) == NULL) {
+      break;
+    }
+    while (ntaken < nblocks && slab->nfree > 0) {
+      uint16_t idx = slab->free_idx[--slab->nfree];
+      blocks[ntaken++] = slab->block + (uint64_t)idx * _class_sizes[sclass];
+    }
+    if (slab->nfree == 0) {
+      slab_list_remove(slab);
+    }
+  }
+  return ntaken;
+}
+
+/**
+ * Returns a block to its slab, releases the slab if it is unused and
+ * another slab of its size class has free blocks.
+ * Must be called with the pool mutex held.
+ */
+static void
+slab_put(uint64_t block)
+{
+  dart__mempool_slab_t * slab = block_slab(block);
+  uint32_t idx = (uint32_t)((block - slab->block) /
+                            _class_sizes[slab->sclass]);
+  if (slab->nfree == 0) {
+    slab_list_insert(slab);
+  }
+  slab->free_idx[slab->nfree++] = (uint16_t)idx;
+  if (slab->nfree == slab->nblocks &&
+      (slab->next != NULL || slab->prev != NULL)) {
+    dart__mempool_arena_t * arena = &_pool.arenas[block_arena(slab->block)];
+    uint64_t offset = block_offset(slab->block);
+    slab_list_remove(slab);
+    arena->slabs[offset >> DART__MEMPOOL__SLAB_BITS] = NULL;
+    dart_buddy_free(arena->buddy, offset);
+    free(slab);
+  }
+}
+
+static inline void
+cache_validate()
+{
+  if (_cache.epoch != _pool.epoch) {
+    memset(_cache.count, 0, sizeof(_cache.count));
+    _cache.epoch = _pool.epoch;
+  }
+}
+
+size_t dart__mpi__mempool_size()
+{
+  size_t size = DART_LOCAL_ALLOC_SIZE;
+  const char * envstr = getenv(DART_LOCAL_ALLOC_SIZE_ENVSTR);
+  if (envstr != NULL) {
+    char * end;
+    unsigned long long value = strtoull(envstr, &end, 10);
+    switch (toupper((unsigned char)*end)) {
+      case 'G': value <<= 10; /* fall-through */
+      case 'M': value <<= 10; /* fall-through */
+      case 'K': value <<= 10; /* fall-through */
+      default : break;
+    }
+    if (value == 0) {
+      DART_LOG_WARN("dart__mpi__mempool_size: invalid value of %s: %s",
+                    DART_LOCAL_ALLOC_SIZE_ENVSTR, envstr);
+    } else {
+      size = (size_t)value;
+    }
+  }
+  if (size < DART__MEMPOOL__SLAB_SIZE) {
+    size = DART__MEMPOOL__SLAB_SIZE;
+  }
+  if (size > DART__MEMPOOL__MAX_ARENA_SIZE) {
+    size = DART__MEMPOOL__MAX_ARENA_SIZE;
+  }
+  return next_pow_of_2(size);
+}
+
+dart_ret_t dart__mpi__mempool_init(size_t size)
+{
+  memset(_pool.arenas,  0, sizeof(_pool.arenas));
+  memset(_pool.partial, 0, sizeof(_pool.partial));
+  dart__base__mutex_init(&_pool.mutex);
+  _pool.epoch++;
+
+  if (arena_init(&_pool.arenas[0], NULL, size) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+  _pool.num_arenas = 1;
+
+  const char * envstr = getenv(DART_LOCAL_ALLOC_EXTEND_ENVSTR);
+  _pool.extend = (envstr == NULL || strcmp(envstr, "0") != 0);
+
+  // Registered collectively on all units to keep segment IDs consistent,
+  // even if extension arenas are disabled:
+  dart_ret_t ret = dart_team_memregister_dynamic(DART_TEAM_ALL,
+                                                 &_pool.ext_segment);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart__mpi__mempool_init: "
+                   "failed to register segment of extension arenas");
+    return ret;
+  }
+  DART_LOG_DEBUG("dart__mpi__mempool_init: size:%zu extend:%d segment:%d",
+                 size, _pool.extend, _pool.ext_segment.segid);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__mempool_fini()
+{
+  dart_team_data_t * team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  for (int a = 0; a < _pool.num_arenas; ++a) {
+    dart__mempool_arena_t * arena = &_pool.arenas[a];
+    arena_fini(arena);
+    if (arena->base != NULL) {
+      MPI_Win_detach(team_data->window, arena->base);
+      MPI_Free_mem(arena->base);
+    }
+  }
+  _pool.num_arenas = 0;
+  memset(_pool.partial, 0, sizeof(_pool.partial));
+  dart__base__mutex_destroy(&_pool.mutex);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__mempool_alloc(
+  size_t     nbytes,
+  int16_t  * segid,
+  uint64_t * offset)
+{
+  uint64_t   block;
+  dart_ret_t ret = DART_OK;
+
+  if (nbytes <= DART__MEMPOOL__MAX_CLASS_SIZE) {
+    int sclass = size_class(nbytes);
+    cache_validate();
+    if (_cache.count[sclass] == 0) {
+      dart__base__mutex_lock(&_pool.mutex);
+      _cache.count[sclass] = slab_take(sclass, _cache.blocks[sclass],
+                                       DART__MEMPOOL__CACHE_BATCH);
+      dart__base__mutex_unlock(&_pool.mutex);
+      if (_cache.count[sclass] == 0) {
+        return DART_ERR_OTHER;
+      }
+    }
+    block = _cache.blocks[sclass][--_cache.count[sclass]];
+  } else {
+    dart__base__mutex_lock(&_pool.mutex);
+    ret = arena_alloc(nbytes, &block);
+    dart__base__mutex_unlock(&_pool.mutex);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+
+  int arena = block_arena(block);
+  if (arena == 0) {
+    *segid  = DART_SEGMENT_LOCAL;
+    *offset = block_offset(block);
+  } else {
+    *segid  = _pool.ext_segment.segid;
+    *offset = (uint64_t)(uintptr_t)(_pool.arenas[arena].base +
+                                    block_offset(block));
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__mempool_free(
+  int16_t    segid,
+  uint64_t   offset)
+{
+  uint64_t block;
+  // Arenas and slabs are added and released by other threads, resolve the
+  // block's slab with the pool mutex held:
+  dart__base__mutex_lock(&_pool.mutex);
+  if (segid == DART_SEGMENT_LOCAL) {
+    if (offset >= _pool.arenas[0].size) {
+      dart__base__mutex_unlock(&_pool.mutex);
+      return DART_ERR_INVAL;
+    }
+    block = make_block(0, offset);
+  } else if (segid == _pool.ext_segment.segid) {
+    char * addr = (char *)(uintptr_t)offset;
+    int    a;
+    for (a = 1; a < _pool.num_arenas; ++a) {
+      dart__mempool_arena_t * arena = &_pool.arenas[a];
+      if (addr >= arena->base && addr < arena->base + arena->size) {
+        break;
+      }
+    }
+    if (a == _pool.num_arenas) {
+      dart__base__mutex_unlock(&_pool.mutex);
+      return DART_ERR_INVAL;
+    }
+    block = make_block(a, (uint64_t)(addr - _pool.arenas[a].base));
+  } else {
+    dart__base__mutex_unlock(&_pool.mutex);
+    return DART_ERR_INVAL;
+  }
+
+  dart__mempool_slab_t * slab = block_slab(block);
+  if (slab == NULL) {
+    // Large block allocated from the buddy allocator:
+    int ret = dart_buddy_free(_pool.arenas[block_arena(block)].buddy,
+                              block_offset(block));
+    dart__base__mutex_unlock(&_pool.mutex);
+    return (ret == 0) ? DART_OK : DART_ERR_INVAL;
+  }
+  // The slab is not released while the block is allocated:
+  int sclass = slab->sclass;
+  int valid  = ((block - slab->block) % _class_sizes[sclass] == 0);
+  dart__base__mutex_unlock(&_pool.mutex);
+  if (!valid) {
+    return DART_ERR_INVAL;
+  }
+
+  cache_validate();
+  if (_cache.count[sclass] == DART__MEMPOOL__CACHE_SIZE) {
+    dart__base__mutex_lock(&_pool.mutex);
+    for (int i = 0; i < DART__MEMPOOL__CACHE_BATCH; ++i) {
+      slab_put(_cache.blocks[sclass][--_cache.count[sclass]]);
+    }
+    dart__base__mutex_unlock(&_pool.mutex);
+  }
+  _cache.blocks[sclass][_cache.count[sclass]++] = block;
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__mempool_target(
+  dart_gptr_t   gptr,
+  MPI_Win     * win,
+  MPI_Aint    * disp)
+{
+  if (gptr.segid == DART_SEGMENT_LOCAL) {
+    *win  = dart_win_local_alloc;
+  } else if (gptr.segid == _pool.ext_segment.segid) {
+    *win  = dart_adapt_teamlist_get(DART_TEAM_ALL)->window;
+  } else {
+    return DART_ERR_INVAL;
+  }
+  *disp = (MPI_Aint)gptr.addr_or_offs.offset;
+  return DART_OK;
+}
@@ -10,38 +10,99 @@
 
 #define DART_SEGMENT_INVALID   (INT32_MAX)
 
-struct dart_seghash_elem {
-  dart_seghash_elem_t *next;
+struct dart_segment_elem {
+  dart_segment_elem_t *next;
   dart_segment_info_t  data;
 };
 
 
-static inline int hash_segid(dart_segid_t segid)
+/**
+ * Slot of the segment with the given ID in the segment tables, or NULL
+ * if the ID exceeds the tables' size.
+ */
+static inline dart_segment_elem_t ** segment_slot(
+  dart_segmentdata_t * segdata,
+  dart_segid_t         segid)
 {
-  /* Simply use the lower bits of the segment ID.
-   * Since segment IDs are allocated continuously, this is likely to cause
-   * collisions starting at (segment number == DART_SEGMENT_HASH_SIZE)
-   * TODO: come up with a random distribution to account for random free'd
-   * segments?
-   * */
-  return (abs(segid) % DART_SEGMENT_HASH_SIZE);
+  if (segid >= 0) {
+    return ((size_t)segid < segdata->mem_segs_size)
+           ? &segdata->mem_segs[segid]
+           : NULL;
+  }
+  return ((size_t)(-segid) < segdata->reg_segs_size)
+         ? &segdata->reg_segs[-segid]
+         : NULL;
 }
 
-static inline void
-register_segment(dart_segmentdata_t *segdata, dart_seghash_elem_t *elem)
+/**
+ * Grows the table of segments with IDs of the sign of \c segid so it
+ * contains a slot for \c segid.
+ */
+static dart_ret_t grow_segment_table(
+  dart_segmentdata_t * segdata,
+  dart_segid_t         segid)
 {
-  int slot = hash_segid(elem->data.segid);
-  elem->next = segdata->hashtab[slot];
-  segdata->hashtab[slot] = elem;
+  dart_segment_elem_t *** table;
+  size_t                * size;
+  size_t                  index;
+  if (segid >= 0) {
+    table = &segdata->mem_segs;
+    size  = &segdata->mem_segs_size;
+    index = segid;
+  } else {
+    table = &segdata->reg_segs;
+    size  = &segdata->reg_segs_size;
+    index = -segid;
+  }
+  size_t new_size = (*size > 0) ? *size : DART_SEGMENT_TABLE_INIT_SIZE;
+  while (new_size <= index) {
+    new_size *= 2;
+  }
+  if (new_size == *size) {
+    return DART_OK;
+  }
+  dart_segment_elem_t ** new_table =
+    realloc(*table, new_size * sizeof(dart_segment_elem_t *));
+  if (new_table == NULL) {
+    DART_LOG_ERROR("dart_segment: failed to grow segment table to %zu",
+                   new_size);
+    return DART_ERR_OTHER;
+  }
+  memset(new_table + *size, 0,
+         (new_size - *size) * sizeof(dart_segment_elem_t *));
+  *table = new_table;
+  *size  = new_size;
+  return DART_OK;
+}
+
+static inline dart_ret_t
+register_segment(dart_segmentdata_t *segdata, dart_segment_elem_t *elem)
+{
+  dart_segment_elem_t ** slot = segment_slot(segdata, elem->data.segid);
+  if (slot == NULL) {
+    if (grow_segment_table(segdata, elem->data.segid) != DART_OK) {
+      return DART_ERR_OTHER;
+    }
+    slot = segment_slot(segdata, elem->data.segid);
+  }
+  elem->next = NULL;
+  *slot      = elem;
+  return DART_OK;
 }
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment tables.
  */
 dart_ret_t dart_segment_init(dart_segmentdata_t *segdata, dart_team_t teamid)
 {
-  memset(segdata->hashtab, 0,
-    sizeof(dart_seghash_elem_t*) * DART_SEGMENT_HASH_SIZE);
+  segdata->mem_segs      = NULL;
+  segdata->reg_segs      = NULL;
+  segdata->mem_segs_size = 0;
+  segdata->reg_segs_size = 0;
+  if (grow_segment_table(segdata, 0)  != DART_OK ||
+      grow_segment_table(segdata, -1) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
 
   segdata->team_id = teamid;
   segdata->mem_freelist = NULL;
@@ -51,34 +112,26 @@ dart_ret_t dart_segment_init(dart_segmentdata_t *segdata, dart_team_t teamid)
 
   // register the segment for non-global allocations on DART_TEAM_ALL
   if (teamid == DART_TEAM_ALL) {
-    dart_seghash_elem_t *elem = calloc(1, sizeof(dart_seghash_elem_t));
+    dart_segment_elem_t *elem = calloc(1, sizeof(dart_segment_elem_t));
     register_segment(segdata, elem);
   }
   return DART_OK;
 }
 
-static dart_segment_info_t * get_segment(
+static inline dart_segment_info_t * get_segment(
     dart_segmentdata_t *segdata,
     dart_segid_t        segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  while (elem != NULL) {
-    if (elem->data.segid == segid) {
-      break;
-    }
-    elem = elem->next;
-  }
+  dart_segment_elem_t ** slot = segment_slot(segdata, segid);
 
-  if (elem == NULL) {
+  if (slot == NULL || *slot == NULL) {
     DART_LOG_ERROR("dart_segment__get_segment : "
                    "Invalid segment ID %i on team %i",
                    segid, segdata->team_id);
     return NULL;
   }
 
-  return &(elem->data);
+  return &((*slot)->data);
 }
 
 /**
@@ -93,7 +146,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
                  segdata->team_id);
 
   int16_t segid;
-  dart_seghash_elem_t *elem = NULL;
+  dart_segment_elem_t *elem = NULL;
   if (type == DART_SEGMENT_ALLOC) {
     if (segdata->mem_freelist != NULL) {
       elem  = segdata->mem_freelist;
@@ -107,7 +160,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->memid++;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else if (type == DART_SEGMENT_REGISTER) {
@@ -124,7 +177,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->registermemid--;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else {
@@ -132,7 +185,10 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
     DART_ASSERT(type != DART_SEGMENT_REGISTER && type != DART_SEGMENT_ALLOC);
   }
 
-  register_segment(segdata, elem);
+  if (register_segment(segdata, elem) != DART_OK) {
+    free(elem);
+    return NULL;
+  }
 
   DART_LOG_DEBUG("dart_segment_alloc > segid:%d team_id:%d",
                  segid, segdata->team_id);
@@ -292,50 +348,35 @@ dart_ret_t dart_segment_free(
   dart_segmentdata_t  * segdata,
   dart_segid_t          segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *pred = NULL;
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  // find the correct entry in this bucket
-  pred = NULL;
-  while (elem != NULL) {
-
-    if (elem->data.segid == segid) {
-      if (pred != NULL) {
-        pred->next = elem->next;
-      } else {
-        segdata->hashtab[slot] = elem->next;
-      }
-      // no need for locking since operations on the same segmentdata
-      // are not thread-safe
-      if (segid > 0) {
-        elem->next            = segdata->mem_freelist;
-        segdata->mem_freelist = elem;
-      } else if (segid < 0){
-        elem->next            = segdata->reg_freelist;
-        segdata->reg_freelist = elem;
-      } else {
-        // This should not happen!
-        DART_ASSERT(segid != 0);
-      }
-      // set the segment ID again
-      elem->data.segid = segid;
-      return DART_OK;
-    }
-
-    pred = elem;
-    elem = elem->next;
+  dart_segment_elem_t ** slot = segment_slot(segdata, segid);
+  if (slot == NULL || *slot == NULL) {
+    // element not found
+    return DART_ERR_INVAL;
   }
-
-  // element not found
-  return DART_ERR_INVAL;
+  dart_segment_elem_t * elem = *slot;
+  *slot = NULL;
+  // no need for locking since operations on the same segmentdata
+  // are not thread-safe
+  if (segid > 0) {
+    elem->next            = segdata->mem_freelist;
+    segdata->mem_freelist = elem;
+  } else if (segid < 0){
+    elem->next            = segdata->reg_freelist;
+    segdata->reg_freelist = elem;
+  } else {
+    // This should not happen!
+    DART_ASSERT(segid != 0);
+  }
+  // set the segment ID again
+  elem->data.segid = segid;
+  return DART_OK;
 }
 
-static void clear_segdata_list(dart_seghash_elem_t *listhead)
+static void clear_segdata_list(dart_segment_elem_t *listhead)
 {
-  dart_seghash_elem_t *elem = listhead;
+  dart_segment_elem_t *elem = listhead;
   while (elem != NULL) {
-    dart_seghash_elem_t *tmp = elem;
+    dart_segment_elem_t *tmp = elem;
     elem = tmp->next;
     tmp->next = NULL;
     free_segment_info(&tmp->data);
@@ -343,17 +384,30 @@ static void clear_segdata_list(dart_seghash_elem_t *listhead)
   }
 }
 
+static void clear_segment_table(
+  dart_segment_elem_t ** table,
+  size_t                 size)
+{
+  for (size_t i = 0; i < size; i++) {
+    clear_segdata_list(table[i]);
+  }
+  free(table);
+}
+
 /**
- * @brief Clear the segment data hash table.
+ * @brief Clear the segment tables.
  */
 dart_ret_t dart_segment_fini(
   dart_segmentdata_t  * segdata)
 {
-  // clear the hash table
-  for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
-    clear_segdata_list(segdata->hashtab[i]);
-    segdata->hashtab[i] = NULL;
-  }
+  // clear the segment tables
+  clear_segment_table(segdata->mem_segs, segdata->mem_segs_size);
+  segdata->mem_segs      = NULL;
+  segdata->mem_segs_size = 0;
+  clear_segment_table(segdata->reg_segs, segdata->reg_segs_size);
+  segdata->reg_segs      = NULL;
+  segdata->reg_segs_size = 0;
+
   clear_segdata_list(segdata->mem_freelist);
   segdata->mem_freelist = NULL;
 
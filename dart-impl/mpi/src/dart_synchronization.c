@@ -16,15 +16,56 @@
 
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_mempool.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <malloc.h>
 
 
+/* Maximum number of consecutive handovers of the global lock between units
+ * on the same node in a hierarchical lock */
+#define DART_LOCK_COHORT_MAX_HANDOFFS  64
+
+/* Words of the node-local ticket lock of a hierarchical lock */
+#define DART_LOCK_NODE_NEXT            0
+#define DART_LOCK_NODE_SERVING         1
+#define DART_LOCK_NODE_GLOBAL_HELD     2
+#define DART_LOCK_NODE_HANDOFFS        3
+#define DART_LOCK_NODE_NWORDS          4
+
+/* Maximum number of progress calls between two polls of a remote lock
+ * word */
+#define DART_LOCK_MAX_BACKOFF          1024
+
+/* Words of the global ticket lock of a hierarchical lock */
+#define DART_LOCK_TICKET_NEXT          0
+#define DART_LOCK_TICKET_SERVING       1
+
+/* Added to the state of a reader-writer lock by a writer */
+#define DART_RWLOCK_WRITER             (((int64_t)1) << 32)
+
+struct dart_lock_cohort
+{
+  /**
+   * Global ticket lock (next ticket and ticket served) competed for by
+   * the nodes. Stored in team-unit 0.
+   */
+  dart_gptr_t  gptr_ticket;
+  /**
+   * Units of the team on this node and the window of the node-local ticket
+   * lock, stored at node-unit 0.
+   */
+  MPI_Comm     node_comm;
+  MPI_Win      node_win;
+  /** Ticket of the current unit in the node-local lock. */
+  int64_t      ticket;
+};
+
 struct dart_lock_struct
 {
   /**
@@ -33,8 +74,8 @@ struct dart_lock_struct
    */
   dart_gptr_t  gptr_tail;
   /**
-   * Pointer to the current unit's successor in the waiting list,
-   * to which we send a release message.
+   * The current unit's successor in the waiting list and the flag set by
+   * its predecessor when handing over the lock.
    */
   dart_gptr_t  gptr_list;
   /**
@@ -44,8 +85,97 @@ struct dart_lock_struct
   dart_team_t teamid;
   /** Whether this unit has acquired the lock. */
   int32_t is_acquired;
+  /** Node-local part of a hierarchical lock, NULL for a queue lock. */
+  struct dart_lock_cohort * cohort;
+};
+
+struct dart_rwlock_struct
+{
+  /** Queue lock serializing writers. */
+  dart_lock_t  wlock;
+  /**
+   * Number of readers holding the lock, plus \c DART_RWLOCK_WRITER while
+   * a writer holds or waits for the lock. Stored in team-unit 0.
+   */
+  dart_gptr_t  gptr_state;
+  dart_team_t  teamid;
 };
 
+/* Offsets in a unit's element of lock->gptr_list */
+#define DART_LOCK_LIST_NEXT            0
+#define DART_LOCK_LIST_FLAG            sizeof(int32_t)
+
+static inline void
+dart__mpi__lock_progress(MPI_Comm comm)
+{
+  // trigger progress
+  int flag;
+  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE);
+}
+
+/**
+ * Triggers progress an increasing number of times between two polls of a
+ * lock word to reduce the load on the unit storing it.
+ */
+static inline void
+dart__mpi__lock_backoff(MPI_Comm comm, int * delay)
+{
+  for (int i = 0; i < *delay; ++i) {
+    dart__mpi__lock_progress(comm);
+  }
+  if (*delay < DART_LOCK_MAX_BACKOFF) {
+    *delay *= 2;
+  }
+}
+
+static inline int64_t
+dart__mpi__lock_fetch_and_op(
+  MPI_Win   win,
+  int       target,
+  MPI_Aint  disp,
+  int64_t   value,
+  MPI_Op    op)
+{
+  int64_t result;
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &value, &result, MPI_INT64_T, target, disp, op, win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(MPI_Win_flush(target, win), MPI_SUCCESS);
+  return result;
+}
+
+static inline int64_t
+dart__mpi__lock_compare_and_swap(
+  MPI_Win   win,
+  int       target,
+  MPI_Aint  disp,
+  int64_t   compare,
+  int64_t   value)
+{
+  int64_t result;
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &value, &compare, &result, MPI_INT64_T, target, disp, win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(MPI_Win_flush(target, win), MPI_SUCCESS);
+  return result;
+}
+
+/**
+ * Displacement of the element of team-unit 0 in a team allocation.
+ */
+static inline MPI_Aint
+dart__mpi__lock_disp0(dart_team_data_t * team_data, dart_gptr_t gptr)
+{
+  MPI_Aint disp;
+  DART_ASSERT_RETURNS(
+    dart_segment_get_disp(
+      &team_data->segdata, gptr.segid, DART_TEAM_UNIT_ID(0), &disp),
+    DART_OK);
+  return disp + gptr.addr_or_offs.offset;
+}
+
 dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 {
   int ret;
@@ -77,14 +207,19 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
       DART_OK);
 
     /* Local store is safe and effective followed by the sync call. */
+    MPI_Win  tail_win;
+    MPI_Aint tail_disp;
+    DART_ASSERT_RETURNS(
+      dart__mpi__mempool_target(gptr_tail, &tail_win, &tail_disp),
+      DART_OK);
     *tail_ptr = -1;
-    MPI_Win_sync (dart_win_local_alloc);
+    MPI_Win_sync (tail_win);
   }
 
   /* Create a global memory region across the team.
    * Every local memory segment holds the next unit
-   * waiting on the lock. */
-  ret = dart_team_memalloc_aligned(teamid, 1, DART_TYPE_INT, &gptr_list);
+   * waiting on the lock and the handover flag. */
+  ret = dart_team_memalloc_aligned(teamid, 2, DART_TYPE_INT, &gptr_list);
   if (ret != DART_OK) {
     DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
     return ret;
@@ -95,7 +230,8 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 
   dart_gptr_setunit(&gptr_list, unitid);
   dart_gptr_getaddr(gptr_list, (void*)&list_ptr);
-  *list_ptr = -1;
+  list_ptr[0] = -1;
+  list_ptr[1] = 0;
   MPI_Win_sync(win);
 
   // communicate tail pointer
@@ -116,6 +252,7 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   (*lock)->gptr_list   = gptr_list;
   (*lock)->teamid      = teamid;
   (*lock)->is_acquired = 0;
+  (*lock)->cohort      = NULL;
   DART_ASSERT_RETURNS(
     dart__base__mutex_init_recursive(&(*lock)->mutex),
     DART_OK);
@@ -125,6 +262,220 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   return DART_OK;
 }
 
+dart_ret_t dart_team_lock_init_hierarchical(
+  dart_team_t   teamid,
+  dart_lock_t * lock)
+{
+  dart_ret_t ret;
+  dart_gptr_t gptr_ticket;
+  dart_team_unit_t unitid;
+
+  *lock = NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_myid(teamid, &unitid);
+
+  /* The global ticket lock is stored in team-unit 0, the elements of other
+   * units are unused. */
+  ret = dart_team_memalloc_aligned(teamid, 2, DART_TYPE_LONGLONG,
+                                   &gptr_ticket);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
+    return ret;
+  }
+  int64_t *ticket_ptr;
+  dart_gptr_setunit(&gptr_ticket, unitid);
+  dart_gptr_getaddr(gptr_ticket, (void*)&ticket_ptr);
+  ticket_ptr[DART_LOCK_TICKET_NEXT]    = 0;
+  ticket_ptr[DART_LOCK_TICKET_SERVING] = 0;
+  MPI_Win_sync(team_data->window);
+
+  struct dart_lock_cohort * cohort = malloc(sizeof(struct dart_lock_cohort));
+  cohort->gptr_ticket = gptr_ticket;
+  cohort->ticket      = -1;
+
+  /* The node-local ticket lock is stored in node-unit 0. */
+  int node_unitid;
+  MPI_Comm_split_type(
+    team_data->comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+    &cohort->node_comm);
+  MPI_Comm_rank(cohort->node_comm, &node_unitid);
+  MPI_Aint  node_size = (node_unitid == 0)
+                        ? DART_LOCK_NODE_NWORDS * sizeof(int64_t)
+                        : 0;
+  int64_t * node_ptr;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  ret = MPI_Win_allocate_shared(
+          node_size, sizeof(int64_t), MPI_INFO_NULL, cohort->node_comm,
+          &node_ptr, &cohort->node_win);
+#else
+  ret = MPI_Win_allocate(
+          node_size, sizeof(int64_t), MPI_INFO_NULL, cohort->node_comm,
+          &node_ptr, &cohort->node_win);
+#endif
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("%s: Failed to allocate node-local lock!", __FUNCTION__);
+    MPI_Comm_free(&cohort->node_comm);
+    free(cohort);
+    dart_team_memfree(gptr_ticket);
+    return DART_ERR_OTHER;
+  }
+  if (node_unitid == 0) {
+    memset(node_ptr, 0, node_size);
+  }
+  MPI_Win_lock_all(0, cohort->node_win);
+  MPI_Win_sync(cohort->node_win);
+
+  /* The lock must not be used before it is initialized at all units. */
+  ret = dart_barrier(teamid);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to synchronize lock initialization!",
+                   __FUNCTION__);
+    MPI_Win_unlock_all(cohort->node_win);
+    MPI_Win_free(&cohort->node_win);
+    MPI_Comm_free(&cohort->node_comm);
+    free(cohort);
+    dart_team_memfree(gptr_ticket);
+    return ret;
+  }
+
+  *lock = malloc(sizeof(struct dart_lock_struct));
+  (*lock)->gptr_tail   = DART_GPTR_NULL;
+  (*lock)->gptr_list   = DART_GPTR_NULL;
+  (*lock)->teamid      = teamid;
+  (*lock)->is_acquired = 0;
+  (*lock)->cohort      = cohort;
+  DART_ASSERT_RETURNS(
+    dart__base__mutex_init_recursive(&(*lock)->mutex),
+    DART_OK);
+
+  DART_LOG_DEBUG("dart_team_lock_init_hierarchical: INIT - done");
+
+  return DART_OK;
+}
+
+static void
+dart__mpi__cohort_acquire_global(
+  struct dart_lock_cohort * cohort,
+  dart_team_data_t        * team_data)
+{
+  MPI_Win  win  = team_data->window;
+  MPI_Aint disp = dart__mpi__lock_disp0(team_data, cohort->gptr_ticket);
+
+  int64_t ticket = dart__mpi__lock_fetch_and_op(
+                     win, 0, disp + DART_LOCK_TICKET_NEXT * sizeof(int64_t),
+                     1, MPI_SUM);
+  int delay = 1;
+  while (dart__mpi__lock_fetch_and_op(
+           win, 0, disp + DART_LOCK_TICKET_SERVING * sizeof(int64_t),
+           0, MPI_NO_OP) != ticket) {
+    dart__mpi__lock_backoff(team_data->comm, &delay);
+  }
+}
+
+static void
+dart__mpi__cohort_acquire(
+  dart_lock_t        lock,
+  dart_team_data_t * team_data)
+{
+  struct dart_lock_cohort * cohort = lock->cohort;
+  MPI_Win win = cohort->node_win;
+
+  /* Arbitrate among the units on this node first */
+  int64_t ticket = dart__mpi__lock_fetch_and_op(
+                     win, 0, DART_LOCK_NODE_NEXT, 1, MPI_SUM);
+  int delay = 1;
+  while (dart__mpi__lock_fetch_and_op(
+           win, 0, DART_LOCK_NODE_SERVING, 0, MPI_NO_OP) != ticket) {
+    dart__mpi__lock_backoff(team_data->comm, &delay);
+  }
+  cohort->ticket = ticket;
+
+  /* The global lock might have been handed over by the predecessor */
+  if (!dart__mpi__lock_fetch_and_op(
+         win, 0, DART_LOCK_NODE_GLOBAL_HELD, 0, MPI_NO_OP)) {
+    dart__mpi__cohort_acquire_global(cohort, team_data);
+    dart__mpi__lock_fetch_and_op(
+      win, 0, DART_LOCK_NODE_GLOBAL_HELD, 1, MPI_REPLACE);
+  }
+}
+
+static int32_t
+dart__mpi__cohort_try_acquire(
+  dart_lock_t        lock,
+  dart_team_data_t * team_data)
+{
+  struct dart_lock_cohort * cohort = lock->cohort;
+  MPI_Win win = cohort->node_win;
+
+  /* Take a ticket only if it is served immediately */
+  int64_t ticket = dart__mpi__lock_fetch_and_op(
+                     win, 0, DART_LOCK_NODE_SERVING, 0, MPI_NO_OP);
+  if (dart__mpi__lock_compare_and_swap(
+        win, 0, DART_LOCK_NODE_NEXT, ticket, ticket + 1) != ticket) {
+    return 0;
+  }
+  cohort->ticket = ticket;
+
+  if (!dart__mpi__lock_fetch_and_op(
+         win, 0, DART_LOCK_NODE_GLOBAL_HELD, 0, MPI_NO_OP)) {
+    MPI_Win  team_win = team_data->window;
+    MPI_Aint disp     = dart__mpi__lock_disp0(team_data, cohort->gptr_ticket);
+    int64_t  global   = dart__mpi__lock_fetch_and_op(
+                          team_win, 0,
+                          disp + DART_LOCK_TICKET_SERVING * sizeof(int64_t),
+                          0, MPI_NO_OP);
+    if (dart__mpi__lock_compare_and_swap(
+          team_win, 0, disp + DART_LOCK_TICKET_NEXT * sizeof(int64_t),
+          global, global + 1) != global) {
+      /* Global lock is held by another node, give up the local lock */
+      dart__mpi__lock_fetch_and_op(
+        win, 0, DART_LOCK_NODE_SERVING, 1, MPI_SUM);
+      return 0;
+    }
+    dart__mpi__lock_fetch_and_op(
+      win, 0, DART_LOCK_NODE_GLOBAL_HELD, 1, MPI_REPLACE);
+  }
+  return 1;
+}
+
+static void
+dart__mpi__cohort_release(
+  dart_lock_t        lock,
+  dart_team_data_t * team_data)
+{
+  struct dart_lock_cohort * cohort = lock->cohort;
+  MPI_Win win = cohort->node_win;
+
+  int64_t next     = dart__mpi__lock_fetch_and_op(
+                       win, 0, DART_LOCK_NODE_NEXT, 0, MPI_NO_OP);
+  int64_t handoffs = dart__mpi__lock_fetch_and_op(
+                       win, 0, DART_LOCK_NODE_HANDOFFS, 0, MPI_NO_OP);
+  if (next > cohort->ticket + 1 &&
+      handoffs < DART_LOCK_COHORT_MAX_HANDOFFS) {
+    /* Hand over the global lock to the next unit on this node */
+    dart__mpi__lock_fetch_and_op(
+      win, 0, DART_LOCK_NODE_HANDOFFS, handoffs + 1, MPI_REPLACE);
+  } else {
+    MPI_Aint disp = dart__mpi__lock_disp0(team_data, cohort->gptr_ticket);
+    dart__mpi__lock_fetch_and_op(
+      win, 0, DART_LOCK_NODE_HANDOFFS, 0, MPI_REPLACE);
+    dart__mpi__lock_fetch_and_op(
+      win, 0, DART_LOCK_NODE_GLOBAL_HELD, 0, MPI_REPLACE);
+    dart__mpi__lock_fetch_and_op(
+      team_data->window, 0,
+      disp + DART_LOCK_TICKET_SERVING * sizeof(int64_t),
+      1, MPI_SUM);
+  }
+  dart__mpi__lock_fetch_and_op(
+    win, 0, DART_LOCK_NODE_SERVING, 1, MPI_SUM);
+  cohort->ticket = -1;
+}
+
 dart_ret_t dart_lock_acquire(dart_lock_t lock)
 {
   /* lock the local mutex and keep it until the global lock is released */
@@ -145,34 +496,55 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
     return DART_ERR_INVAL;
   }
 
+  if (lock->cohort != NULL) {
+    dart__mpi__cohort_acquire(lock, team_data);
+    DART_LOG_DEBUG("dart_lock_acquire: hierarchical lock acquired in team %d",
+                   lock->teamid);
+    lock->is_acquired = 1;
+    return DART_OK;
+  }
+
   dart_gptr_t gptr_tail = lock->gptr_tail;
   dart_gptr_t gptr_list = lock->gptr_list;
 
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
   dart_unit_t tail_unit   = gptr_tail.unitid;
+  MPI_Win     tail_win;
+  MPI_Aint    tail_disp;
+  DART_ASSERT_RETURNS(
+    dart__mpi__mempool_target(gptr_tail, &tail_win, &tail_disp),
+    DART_OK);
 
   dart_team_unit_t unitid;
   dart_team_myid(lock->teamid, &unitid);
 
+  /* Reset the handover flag before enqueueing, it is only set by the
+   * predecessor after this unit became the tail. */
+  int32_t * list_ptr;
+  DART_ASSERT_RETURNS(
+    dart_gptr_getaddr(gptr_list, (void *)&list_ptr),
+    DART_OK);
+  list_ptr[1] = 0;
+  MPI_Win_sync(team_data->window);
+
   int32_t predecessor;
 
   /* Fetch the current unit's tail and make this unit the new tail */
   DART_LOG_TRACE(
     "dart_lock_acquire: MPI_Fetch_and_op to set tail to unit %i on "
-    "tail_unit %i with offset %lu",
-    unitid.id, tail_unit, tail_offset);
+    "tail_unit %i with displacement %ld",
+    unitid.id, tail_unit, (long)tail_disp);
   DART_ASSERT_RETURNS(
     MPI_Fetch_and_op(
       &unitid.id,
       &predecessor,
       MPI_INT32_T,
       tail_unit,
-      tail_offset,
+      tail_disp,
       MPI_REPLACE,
-      dart_win_local_alloc),
+      tail_win),
     MPI_SUCCESS);
   DART_ASSERT_RETURNS(
-      MPI_Win_flush(tail_unit, dart_win_local_alloc),
+      MPI_Win_flush(tail_unit, tail_win),
       MPI_SUCCESS);
 
   DART_LOG_TRACE("dart_lock_acquire: predecessor: %i unitid.id: %i",
@@ -183,10 +555,11 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
    */
   if (predecessor != -1) {
     int32_t    result;
+    int32_t    flag;
     MPI_Win    win;
-    MPI_Status status;
     int16_t    seg_id = gptr_list.segid;
     MPI_Aint   disp_list;
+    MPI_Aint   disp_flag;
 
     DART_ASSERT_RETURNS(
       dart_segment_get_disp(
@@ -195,6 +568,14 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
         DART_TEAM_UNIT_ID(predecessor),
         &disp_list),
       DART_OK);
+    DART_ASSERT_RETURNS(
+      dart_segment_get_disp(
+        &team_data->segdata,
+        seg_id,
+        unitid,
+        &disp_flag),
+      DART_OK);
+    disp_flag += DART_LOCK_LIST_FLAG;
     win = team_data->window;
 
     /* Atomicity: Update its predecessor's next pointer */
@@ -204,7 +585,7 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
         &result,
         MPI_INT32_T,
         predecessor,
-        disp_list,
+        disp_list + DART_LOCK_LIST_NEXT,
         MPI_REPLACE,
         win),
       MPI_SUCCESS);
@@ -218,8 +599,22 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
                    "%d in team %d",
                    predecessor, lock->teamid);
 
-    MPI_Recv(NULL, 0, MPI_INT, predecessor, 0, team_data->comm,
-        &status);
+    do {
+      dart__mpi__lock_progress(team_data->comm);
+      DART_ASSERT_RETURNS(
+        MPI_Fetch_and_op(
+          NULL,
+          &flag,
+          MPI_INT32_T,
+          unitid.id,
+          disp_flag,
+          MPI_NO_OP,
+          win),
+        MPI_SUCCESS);
+      DART_ASSERT_RETURNS(
+        MPI_Win_flush(unitid.id, win),
+        MPI_SUCCESS);
+    } while (flag == 0);
   }
 
   DART_LOG_DEBUG("dart_lock_acquire: lock acquired in team %d", lock->teamid);
@@ -244,6 +639,21 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
     return DART_ERR_INVAL;
   }
 
+  if (lock->cohort != NULL) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+    DART_ASSERT(team_data != NULL);
+    *is_acquired = dart__mpi__cohort_try_acquire(lock, team_data);
+    if (*is_acquired) {
+      lock->is_acquired = 1;
+    } else {
+      DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    }
+    DART_LOG_DEBUG("dart_lock_try_acquire: hierarchical trylock %s in team %d",
+                   (*is_acquired) ? "succeeded" : "failed",
+                   lock->teamid);
+    return DART_OK;
+  }
+
   dart_team_unit_t unitid;
   dart_team_myid(lock->teamid, &unitid);
 
@@ -253,7 +663,11 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
 
   dart_gptr_t gptr_tail   = lock->gptr_tail;
   dart_unit_t tail_unit   = gptr_tail.unitid;
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
+  MPI_Win     tail_win;
+  MPI_Aint    tail_disp;
+  DART_ASSERT_RETURNS(
+    dart__mpi__mempool_target(gptr_tail, &tail_win, &tail_disp),
+    DART_OK);
 
   /* Atomicity: Check if the lock is available and claim it if it is. */
   DART_ASSERT_RETURNS(
@@ -263,11 +677,11 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
       &result,
       MPI_INT32_T,
       tail_unit,
-      tail_offset,
-      dart_win_local_alloc),
+      tail_disp,
+      tail_win),
     MPI_SUCCESS);
   DART_ASSERT_RETURNS(
-    MPI_Win_flush (tail_unit, dart_win_local_alloc),
+    MPI_Win_flush (tail_unit, tail_win),
     MPI_SUCCESS);
 
   /* If the old predecessor was -1, we have claimed the lock,
@@ -295,14 +709,27 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
     return DART_ERR_INVAL;
   }
 
-  dart_gptr_t gptr_tail = lock->gptr_tail;
-  dart_gptr_t gptr_list = lock->gptr_list;
-
   dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
   DART_ASSERT(team_data != NULL);
 
-  uint64_t      offset_tail = gptr_tail.addr_or_offs.offset;
+  if (lock->cohort != NULL) {
+    dart__mpi__cohort_release(lock, team_data);
+    lock->is_acquired = 0;
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    DART_LOG_DEBUG("dart_lock_release: release hierarchical lock in team %d",
+                   lock->teamid);
+    return DART_OK;
+  }
+
+  dart_gptr_t gptr_tail = lock->gptr_tail;
+  dart_gptr_t gptr_list = lock->gptr_list;
+
   dart_unit_t   tail        = gptr_tail.unitid;
+  MPI_Win       tail_win;
+  MPI_Aint      tail_disp;
+  DART_ASSERT_RETURNS(
+    dart__mpi__mempool_target(gptr_tail, &tail_win, &tail_disp),
+    DART_OK);
   int32_t     * addr;
   DART_ASSERT_RETURNS(dart_gptr_getaddr(gptr_list, (void *)&addr), DART_OK);
 
@@ -323,11 +750,11 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
       &result,
       MPI_INT32_T,
       tail,
-      offset_tail,
-      dart_win_local_alloc),
+      tail_disp,
+      tail_win),
     MPI_SUCCESS);
   DART_ASSERT_RETURNS(
-    MPI_Win_flush(tail, dart_win_local_alloc),
+    MPI_Win_flush(tail, tail_win),
     MPI_SUCCESS);
 
   if (result != unitid.id) {
@@ -346,11 +773,7 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
 
     /* Wait for the update of our next pointer. */
     do {
-      // trigger progress
-      int flag;
-      MPI_Iprobe(
-        MPI_ANY_SOURCE, MPI_ANY_TAG,
-        team_data->comm, &flag, MPI_STATUS_IGNORE);
+      dart__mpi__lock_progress(team_data->comm);
       DART_ASSERT_RETURNS(
         MPI_Fetch_and_op(
           NULL,
@@ -369,10 +792,30 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
     DART_LOG_DEBUG("dart_lock_release: notifying %d in team %d", next,
                    (lock->teamid));
 
-    /* Notifying the next unit waiting on the lock queue. */
-    MPI_Send(NULL, 0, MPI_INT, next, 0, team_data->comm);
+    /* Notifying the next unit waiting on the lock queue by setting its
+     * handover flag. */
+    int32_t  handover = 1;
+    MPI_Aint disp_next;
+    DART_ASSERT_RETURNS(dart_segment_get_disp(
+          &team_data->segdata,
+          gptr_list.segid,
+          DART_TEAM_UNIT_ID(next),
+          &disp_next), DART_OK);
     *addr = -1;
     MPI_Win_sync(win);
+    DART_ASSERT_RETURNS(
+      MPI_Fetch_and_op(
+        &handover,
+        &result,
+        MPI_INT32_T,
+        next,
+        disp_next + DART_LOCK_LIST_FLAG,
+        MPI_REPLACE,
+        win),
+      MPI_SUCCESS);
+    DART_ASSERT_RETURNS(
+      MPI_Win_flush(next, win),
+      MPI_SUCCESS);
   }
   lock->is_acquired = 0;
   DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
@@ -388,22 +831,35 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
   dart_gptr_t gptr_tail = (*lock)->gptr_tail;
   dart_gptr_t gptr_list = (*lock)->gptr_list;
   dart_team_t teamid    = (*lock)->teamid;
+  struct dart_lock_cohort * cohort = (*lock)->cohort;
 
   dart_team_myid(teamid, &unitid);
 
-
-  /* Unit 0 is the process holding the gptr_tail by default. */
-  if (unitid.id == 0) {
-    ret = dart_memfree(gptr_tail);
+  if (cohort != NULL) {
+    MPI_Win_unlock_all(cohort->node_win);
+    MPI_Win_free(&cohort->node_win);
+    MPI_Comm_free(&cohort->node_comm);
+    ret = dart_team_memfree(cohort->gptr_ticket);
     if (ret != DART_OK) {
-      DART_LOG_ERROR("Failed to free global mmeory");
+      DART_LOG_ERROR("Failed to free global memory");
+      return ret;
+    }
+    free(cohort);
+    (*lock)->cohort = NULL;
+  } else {
+    /* Unit 0 is the process holding the gptr_tail by default. */
+    if (unitid.id == 0) {
+      ret = dart_memfree(gptr_tail);
+      if (ret != DART_OK) {
+        DART_LOG_ERROR("Failed to free global memory");
+        return ret;
+      }
+    }
+    ret = dart_team_memfree(gptr_list);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("Failed to free global memory");
       return ret;
     }
-  }
-  ret = dart_team_memfree(gptr_list);
-  if (ret != DART_OK) {
-    DART_LOG_ERROR("Failed to free global mmeory");
-    return ret;
   }
   (*lock)->gptr_tail = DART_GPTR_NULL;
   (*lock)->gptr_list = DART_GPTR_NULL;
@@ -415,6 +871,163 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
   return DART_OK;
 }
 
+dart_ret_t dart_team_rwlock_init(dart_team_t teamid, dart_rwlock_t* lock)
+{
+  dart_ret_t ret;
+  dart_lock_t wlock;
+  dart_gptr_t gptr_state;
+  dart_team_unit_t unitid;
+
+  *lock = NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_myid(teamid, &unitid);
+
+  ret = dart_team_lock_init(teamid, &wlock);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
+  /* The state is stored in team-unit 0, the elements of other units are
+   * unused. */
+  ret = dart_team_memalloc_aligned(teamid, 1, DART_TYPE_LONGLONG,
+                                   &gptr_state);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
+    dart_team_lock_destroy(&wlock);
+    return ret;
+  }
+  int64_t *state_ptr;
+  dart_gptr_setunit(&gptr_state, unitid);
+  dart_gptr_getaddr(gptr_state, (void*)&state_ptr);
+  *state_ptr = 0;
+  MPI_Win_sync(team_data->window);
+
+  /* The lock must not be used before it is initialized at all units. */
+  ret = dart_barrier(teamid);
+  if (ret != DART_OK) {
+    return ret;
+  }
 
+  *lock = malloc(sizeof(struct dart_rwlock_struct));
+  (*lock)->wlock      = wlock;
+  (*lock)->gptr_state = gptr_state;
+  (*lock)->teamid     = teamid;
 
+  DART_LOG_DEBUG("dart_team_rwlock_init: INIT - done");
 
+  return DART_OK;
+}
+
+dart_ret_t dart_team_rwlock_destroy(dart_rwlock_t* lock)
+{
+  dart_ret_t ret;
+
+  ret = dart_team_memfree((*lock)->gptr_state);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("Failed to free global memory");
+    return ret;
+  }
+  ret = dart_team_lock_destroy(&(*lock)->wlock);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  DART_LOG_DEBUG("dart_team_rwlock_destroy: done in team %d",
+                 (*lock)->teamid);
+  free(*lock);
+  *lock = NULL;
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_acquire_read(dart_rwlock_t lock)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_rwlock_acquire_read ! failed: Unknown team %i!",
+                   lock->teamid);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Win  win  = team_data->window;
+  MPI_Aint disp = dart__mpi__lock_disp0(team_data, lock->gptr_state);
+
+  while (dart__mpi__lock_fetch_and_op(win, 0, disp, 1, MPI_SUM)
+         >= DART_RWLOCK_WRITER) {
+    /* A writer holds or waits for the lock, back off until it is done */
+    dart__mpi__lock_fetch_and_op(win, 0, disp, -1, MPI_SUM);
+    DART_LOG_TRACE("dart_rwlock_acquire_read: waiting for writer "
+                   "in team %d", lock->teamid);
+    int delay = 1;
+    while (dart__mpi__lock_fetch_and_op(win, 0, disp, 0, MPI_NO_OP)
+           >= DART_RWLOCK_WRITER) {
+      dart__mpi__lock_backoff(team_data->comm, &delay);
+    }
+  }
+
+  DART_LOG_DEBUG("dart_rwlock_acquire_read: lock acquired in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_release_read(dart_rwlock_t lock)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  DART_ASSERT(team_data != NULL);
+
+  MPI_Aint disp = dart__mpi__lock_disp0(team_data, lock->gptr_state);
+  dart__mpi__lock_fetch_and_op(team_data->window, 0, disp, -1, MPI_SUM);
+
+  DART_LOG_DEBUG("dart_rwlock_release_read: release lock in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_acquire_write(dart_rwlock_t lock)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_rwlock_acquire_write ! failed: Unknown team %i!",
+                   lock->teamid);
+    return DART_ERR_INVAL;
+  }
+
+  /* Writers are serialized in the queue lock */
+  dart_ret_t ret = dart_lock_acquire(lock->wlock);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
+  /* Block arriving readers and wait for active readers to leave */
+  MPI_Win  win  = team_data->window;
+  MPI_Aint disp = dart__mpi__lock_disp0(team_data, lock->gptr_state);
+  if (dart__mpi__lock_fetch_and_op(win, 0, disp, DART_RWLOCK_WRITER, MPI_SUM)
+      != 0) {
+    int delay = 1;
+    while (dart__mpi__lock_fetch_and_op(win, 0, disp, 0, MPI_NO_OP)
+           != DART_RWLOCK_WRITER) {
+      dart__mpi__lock_backoff(team_data->comm, &delay);
+    }
+  }
+
+  DART_LOG_DEBUG("dart_rwlock_acquire_write: lock acquired in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_release_write(dart_rwlock_t lock)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  DART_ASSERT(team_data != NULL);
+
+  MPI_Aint disp = dart__mpi__lock_disp0(team_data, lock->gptr_state);
+  dart__mpi__lock_fetch_and_op(
+    team_data->window, 0, disp, -DART_RWLOCK_WRITER, MPI_SUM);
+
+  DART_LOG_DEBUG("dart_rwlock_release_write: release lock in team %d",
+                 lock->teamid);
+  return dart_lock_release(lock->wlock);
+}
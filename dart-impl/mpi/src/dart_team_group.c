@@ -626,6 +626,7 @@ dart_ret_t dart_team_create(
     *newteam = max_teamid;
     dart_team_data_t *team_data = dart_adapt_teamlist_get(max_teamid);
     team_data->comm = subcomm;
+    MPI_Comm_dup(subcomm, &team_data->coll_comm);
     MPI_Win_create_dynamic(MPI_INFO_NULL, subcomm, &win);
     team_data->window = win;
 
@@ -676,7 +677,8 @@ dart_ret_t dart_team_destroy(
   MPI_Win_unlock_all(win);
   MPI_Win_free(&win);
 
-  /* -- Release the communicator associated with teamid -- */
+  /* -- Release the communicators associated with teamid -- */
+  MPI_Comm_free(&team_data->coll_comm);
   MPI_Comm_free(&comm);
 
   dart_adapt_teamlist_dealloc(*teamid);
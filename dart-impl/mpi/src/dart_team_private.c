@@ -233,6 +233,9 @@ dart_adapt_teamlist_alloc(dart_team_t teamid)
   dart_team_data_t *res = calloc(1, sizeof(dart_team_data_t));
   res->teamid = teamid;
   res->unitid = DART_UNDEFINED_UNIT_ID;
+  res->epoch  = DART_MPI_EPOCH_PASSIVE;
+  res->pscw_origin_group = MPI_GROUP_NULL;
+  res->pscw_target_group = MPI_GROUP_NULL;
   res->next = dart_team_data[slot];
   dart_team_data[slot] = res;
   dart_segment_init(&(res->segdata), teamid);
@@ -0,0 +1,140 @@
+/**
+ * Benchmark of distributed sort (dash::sort) on dash::Array.
+ *
+ * Usage:
+ *
+ *   bench.13.sort [size_base] [max_key] [num_iterations] [num_repeats]
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <ctime>
+#include <limits>
+#include <algorithm>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+typedef int                                key_type;
+typedef dash::Array<key_type>              array_t;
+
+#define DEFAULT_SIZE_BASE   (1 << 20)
+#define DEFAULT_MAX_KEY     (1 << 30)
+#define DEFAULT_ITERATIONS  5
+#define DEFAULT_REPEATS     5
+
+bool verify(array_t & arr);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  size_t size_base  = DEFAULT_SIZE_BASE;
+  size_t max_key    = DEFAULT_MAX_KEY;
+  size_t iterations = DEFAULT_ITERATIONS;
+  size_t repeats    = DEFAULT_REPEATS;
+
+  if (argc > 1) { size_base  = atol(argv[1]); }
+  if (argc > 2) { max_key    = atol(argv[2]); }
+  if (argc > 3) { iterations = atol(argv[3]); }
+  if (argc > 4) { repeats    = atol(argv[4]); }
+
+  auto myid   = dash::myid();
+  auto nunits = dash::size();
+
+  if (myid == 0) {
+    cout << setw(12) << "nunits"
+         << setw(14) << "n"
+         << setw(10) << "repeats"
+         << setw(12) << "min.s"
+         << setw(12) << "avg.s"
+         << setw(12) << "max.s"
+         << setw(12) << "mkeys/s"
+         << setw(12) << "mkeys/s/p"
+         << setw(10) << "valid"
+         << endl;
+  }
+
+  size_t array_size = size_base * nunits;
+  for (size_t iter = 0; iter < iterations; ++iter) {
+    array_t arr(array_size);
+
+    double duration_min_s = std::numeric_limits<double>::max();
+    double duration_max_s = 0;
+    double duration_sum_s = 0;
+    bool   valid          = true;
+
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      std::srand(std::time(0) + myid * 7919 + rep);
+      for (auto lit = arr.lbegin(); lit != arr.lend(); ++lit) {
+        *lit = std::rand() % max_key;
+      }
+      arr.barrier();
+
+      auto ts_start = Timer::Now();
+      dash::sort(arr.begin(), arr.end());
+      double duration_s = Timer::ElapsedSince(ts_start) * 1.0e-6;
+
+      duration_min_s  = std::min(duration_min_s, duration_s);
+      duration_max_s  = std::max(duration_max_s, duration_s);
+      duration_sum_s += duration_s;
+
+      if (rep == 0) {
+        valid = verify(arr);
+      }
+    }
+
+    double duration_avg_s = duration_sum_s / repeats;
+    if (myid == 0) {
+      double mkeys_per_s = (array_size / duration_avg_s) * 1.0e-6;
+      cout << setw(12) << nunits
+           << setw(14) << array_size
+           << setw(10) << repeats
+           << std::fixed << std::setprecision(4)
+           << setw(12) << duration_min_s
+           << setw(12) << duration_avg_s
+           << setw(12) << duration_max_s
+           << std::setprecision(2)
+           << setw(12) << mkeys_per_s
+           << setw(12) << mkeys_per_s / nunits
+           << setw(10) << (valid ? "ok" : "FAILED")
+           << endl;
+    }
+
+    array_size *= 2;
+    repeats     = std::max<size_t>(1, repeats / 2);
+  }
+
+  dash::finalize();
+
+  return EXIT_SUCCESS;
+}
+
+/**
+ * Checks that local elements are sorted and that the last element of
+ * every unit does not exceed the first element of its successor.
+ */
+bool verify(array_t & arr)
+{
+  auto & team   = arr.team();
+  auto   myid   = team.myid();
+  int    l_ok   = std::is_sorted(arr.lbegin(), arr.lend()) ? 1 : 0;
+  if (arr.lsize() > 0 && myid < team.size() - 1) {
+    auto l_last_gidx = arr.pattern().global(arr.lsize() - 1);
+    if (l_last_gidx + 1 < arr.size() &&
+        static_cast<key_type>(arr[l_last_gidx + 1]) < *(arr.lend() - 1)) {
+      l_ok = 0;
+    }
+  }
+  int ok;
+  dart_allreduce(&l_ok, &ok, 1, DART_TYPE_INT, DART_OP_MIN, team.dart_id());
+  return ok == 1;
+}
@@ -24,6 +24,7 @@
 #include <dash/algorithm/AnyOf.h>
 #include <dash/algorithm/Find.h>
 #include <dash/algorithm/Equal.h>
+#include <dash/algorithm/Sort.h>
 
 #include <dash/algorithm/SUMMA.h>
 
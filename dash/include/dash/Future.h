@@ -5,25 +5,55 @@
 #include <functional>
 #include <sstream>
 #include <iostream>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <dash/Exception.h>
 #include <dash/internal/Logging.h>
 
+#include <dash/dart/if/dart_communication.h>
+
 
 namespace dash {
 
+/**
+ * Result of an asynchronous operation.
+ *
+ * A future is either
+ *
+ * - associated with a set of DART handles of pending one-sided operations
+ *   and a function providing the result once all operations completed
+ *   locally,
+ * - associated with a test function that determines completion without
+ *   blocking and a function providing the result (see \c dash::when_all,
+ *   \c dash::when_any), or
+ * - deferred, i.e. only associated with a function that is invoked in the
+ *   first call of \c test, \c wait or \c get.
+ *
+ * Completion of pending operations is tested in \c test without blocking
+ * so futures make progress when polled.
+ * Futures are move-only.
+ */
 template<typename ResultT>
 class Future
 {
+  template<typename ResultT_>
+  friend class Future;
+
 private:
   typedef Future<ResultT>               self_t;
   typedef std::function<ResultT (void)> func_t;
+  typedef std::function<bool (void)>    test_func_t;
 
 private:
-  func_t    _func;
-  ResultT   _value;
-  bool      _ready     = false;
-  bool      _has_func  = false;
+  func_t                     _func;
+  test_func_t                _test_func;
+  std::vector<dart_handle_t> _handles;
+  ResultT                    _value;
+  bool                       _ready     = false;
+  bool                       _has_func  = false;
 
 public:
   // For ostream output
@@ -32,37 +62,107 @@ public:
       std::ostream & os,
       const Future<ResultT_> & future);
 
+public:
+  typedef ResultT value_type;
+
 public:
   Future()
   : _ready(false),
     _has_func(false)
   { }
 
+  /**
+   * Creates a deferred future, \c func is invoked in the first call of
+   * \c test, \c wait or \c get.
+   */
   Future(const func_t & func)
   : _func(func),
     _ready(false),
     _has_func(true)
   { }
 
+  /**
+   * Creates a future of pending operations referenced by the given DART
+   * handles. The result is obtained from \c func once all operations
+   * completed locally.
+   */
   Future(
-    const self_t & other)
-  : _func(other._func),
-    _value(other._value),
+    std::vector<dart_handle_t> && handles,
+    const func_t                & func)
+  : _func(func),
+    _handles(std::move(handles)),
+    _ready(false),
+    _has_func(true)
+  { }
+
+  /**
+   * Creates a future that is ready once \c test_func returns \c true.
+   * The result is obtained from \c func which may block until \c test_func
+   * would return \c true.
+   */
+  Future(
+    const test_func_t & test_func,
+    const func_t      & func)
+  : _func(func),
+    _test_func(test_func),
+    _ready(false),
+    _has_func(true)
+  { }
+
+  Future(self_t && other)
+  : _func(std::move(other._func)),
+    _test_func(std::move(other._test_func)),
+    _handles(std::move(other._handles)),
+    _value(std::move(other._value)),
     _ready(other._ready),
     _has_func(other._has_func)
-  { }
+  {
+    other._handles.clear();
+    other._ready    = false;
+    other._has_func = false;
+  }
 
-  Future<ResultT> & operator=(const self_t & other)
+  self_t & operator=(self_t && other)
   {
     if (this != &other) {
-      _func      = other._func;
-      _value     = other._value;
+      _release_handles();
+      _func      = std::move(other._func);
+      _test_func = std::move(other._test_func);
+      _handles   = std::move(other._handles);
+      _value     = std::move(other._value);
       _ready     = other._ready;
       _has_func  = other._has_func;
+      other._handles.clear();
+      other._ready    = false;
+      other._has_func = false;
     }
     return *this;
   }
 
+  Future(const self_t & other)              = delete;
+  self_t & operator=(const self_t & other)  = delete;
+
+  /**
+   * Waits for local completion of pending operations and releases their
+   * handles, the result is discarded.
+   */
+  ~Future()
+  {
+    _release_handles();
+  }
+
+  /**
+   * Whether the future is associated with a result or an operation
+   * providing a result.
+   */
+  bool valid() const noexcept
+  {
+    return _ready || _has_func;
+  }
+
+  /**
+   * Blocks until the result is available.
+   */
   void wait()
   {
     DASH_LOG_TRACE_VAR("Future.wait()", _ready);
@@ -75,26 +175,424 @@ public:
         dash::exception::RuntimeError,
         "Future not initialized with function");
     }
+    if (!_handles.empty()) {
+      DASH_LOG_TRACE("Future.wait", "wait for", _handles.size(), "handles");
+      if (dart_waitall_local(_handles.data(), _handles.size())
+          != DART_OK) {
+        DASH_LOG_ERROR("Future.wait()", "dart_waitall_local failed");
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "Future.wait: dart_waitall_local failed");
+      }
+      _handles.clear();
+    }
     _value = _func();
     _ready = true;
     DASH_LOG_TRACE_VAR("Future.wait >", _ready);
   }
 
-  bool test() const
+  /**
+   * Tests for completion of the asynchronous operation without blocking.
+   * If the operation completed, the result is available in \c get.
+   */
+  bool test()
   {
+    if (_ready) {
+      return true;
+    }
+    if (_test_func) {
+      if (!_test_func()) {
+        return false;
+      }
+    } else if (!_handles.empty()) {
+      int32_t complete = 0;
+      DASH_ASSERT_RETURNS(
+        dart_testall_local(_handles.data(), _handles.size(), &complete),
+        DART_OK);
+      if (!complete) {
+        return false;
+      }
+    }
+    wait();
     return _ready;
   }
 
+  /**
+   * Blocks until the result is available and returns a reference to it.
+   */
   ResultT & get()
   {
     DASH_LOG_TRACE_VAR("Future.get()", _ready);
     wait();
-    DASH_LOG_TRACE_VAR("Future.get >", _value);
+    DASH_LOG_TRACE_VAR("Future.get >", _ready);
     return _value;
   }
 
+  /**
+   * Attaches a continuation to the future that is applied to the result
+   * once it is available.
+   * Pending operations of this future are transferred to the returned
+   * future, this future is invalid afterwards.
+   *
+   * \returns  A future providing the result of \c cont.
+   */
+  template<class ContinuationT>
+  Future<typename std::result_of<ContinuationT(ResultT &)>::type>
+  then(ContinuationT cont)
+  {
+    typedef typename std::result_of<ContinuationT(ResultT &)>::type
+      cont_result_t;
+    typedef Future<cont_result_t> cont_future_t;
+
+    if (!valid()) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Future.then: future is not valid");
+    }
+    cont_future_t cont_future;
+    if (_ready) {
+      ResultT value = std::move(_value);
+      cont_future   = cont_future_t([=]() mutable { return cont(value); });
+    } else {
+      func_t func   = std::move(_func);
+      cont_future   = cont_future_t(
+                        [=]() mutable {
+                          ResultT value = func();
+                          return cont(value);
+                        });
+      cont_future._test_func = std::move(_test_func);
+      cont_future._handles   = std::move(_handles);
+    }
+    _handles.clear();
+    _ready    = false;
+    _has_func = false;
+    return cont_future;
+  }
+
+private:
+  /**
+   * Waits for local completion of pending operations and releases their
+   * handles without providing the result.
+   */
+  void _release_handles() noexcept
+  {
+    if (!_handles.empty()) {
+      if (dart_waitall_local(_handles.data(), _handles.size())
+          != DART_OK) {
+        DASH_LOG_ERROR("Future._release_handles()",
+                       "dart_waitall_local failed");
+      }
+      _handles.clear();
+    }
+  }
+
 }; // class Future
 
+/**
+ * Specialization of \c dash::Future for asynchronous operations that do
+ * not provide a result, e.g. non-blocking collective synchronization
+ * (see \c dash::Team::barrier_async).
+ */
+template<>
+class Future<void>
+{
+  template<typename ResultT_>
+  friend class Future;
+
+private:
+  typedef Future<void>                  self_t;
+  typedef std::function<void (void)>    func_t;
+  typedef std::function<bool (void)>    test_func_t;
+
+private:
+  func_t                     _func;
+  test_func_t                _test_func;
+  std::vector<dart_handle_t> _handles;
+  bool                       _ready     = false;
+  bool                       _has_func  = false;
+
+public:
+  typedef void value_type;
+
+public:
+  Future()
+  : _ready(false),
+    _has_func(false)
+  { }
+
+  /**
+   * Creates a deferred future, \c func is invoked in the first call of
+   * \c test, \c wait or \c get.
+   */
+  Future(const func_t & func)
+  : _func(func),
+    _ready(false),
+    _has_func(true)
+  { }
+
+  /**
+   * Creates a future of pending operations referenced by the given DART
+   * handles. \c func is invoked once all operations completed locally.
+   */
+  Future(
+    std::vector<dart_handle_t> && handles,
+    const func_t                & func = func_t())
+  : _func(func),
+    _handles(std::move(handles)),
+    _ready(false),
+    _has_func(true)
+  { }
+
+  /**
+   * Creates a future that is ready once \c test_func returns \c true.
+   */
+  Future(
+    const test_func_t & test_func,
+    const func_t      & func)
+  : _func(func),
+    _test_func(test_func),
+    _ready(false),
+    _has_func(true)
+  { }
+
+  Future(self_t && other)
+  : _func(std::move(other._func)),
+    _test_func(std::move(other._test_func)),
+    _handles(std::move(other._handles)),
+    _ready(other._ready),
+    _has_func(other._has_func)
+  {
+    other._handles.clear();
+    other._ready    = false;
+    other._has_func = false;
+  }
+
+  self_t & operator=(self_t && other)
+  {
+    if (this != &other) {
+      _release_handles();
+      _func      = std::move(other._func);
+      _test_func = std::move(other._test_func);
+      _handles   = std::move(other._handles);
+      _ready     = other._ready;
+      _has_func  = other._has_func;
+      other._handles.clear();
+      other._ready    = false;
+      other._has_func = false;
+    }
+    return *this;
+  }
+
+  Future(const self_t & other)              = delete;
+  self_t & operator=(const self_t & other)  = delete;
+
+  /**
+   * Waits for local completion of pending operations and releases their
+   * handles, the result is discarded.
+   */
+  ~Future()
+  {
+    _release_handles();
+  }
+
+  /**
+   * Whether the future is associated with an operation.
+   */
+  bool valid() const noexcept
+  {
+    return _ready || _has_func;
+  }
+
+  /**
+   * Blocks until the operation completed.
+   */
+  void wait()
+  {
+    if (_ready) {
+      return;
+    }
+    if (!_has_func) {
+      DASH_LOG_ERROR("Future.wait()", "No function");
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Future not initialized with function");
+    }
+    if (!_handles.empty()) {
+      if (dart_waitall_local(_handles.data(), _handles.size())
+          != DART_OK) {
+        DASH_LOG_ERROR("Future.wait()", "dart_waitall_local failed");
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "Future.wait: dart_waitall_local failed");
+      }
+      _handles.clear();
+    }
+    if (_func) {
+      _func();
+    }
+    _ready = true;
+  }
+
+  /**
+   * Tests for completion of the asynchronous operation without blocking.
+   */
+  bool test()
+  {
+    if (_ready) {
+      return true;
+    }
+    if (_test_func) {
+      if (!_test_func()) {
+        return false;
+      }
+    } else if (!_handles.empty()) {
+      int32_t complete = 0;
+      DASH_ASSERT_RETURNS(
+        dart_testall_local(_handles.data(), _handles.size(), &complete),
+        DART_OK);
+      if (!complete) {
+        return false;
+      }
+    }
+    wait();
+    return _ready;
+  }
+
+  /**
+   * Blocks until the operation completed.
+   */
+  void get()
+  {
+    wait();
+  }
+
+  /**
+   * Attaches a continuation to the future that is invoked once the
+   * operation completed.
+   * Pending operations of this future are transferred to the returned
+   * future, this future is invalid afterwards.
+   *
+   * \returns  A future providing the result of \c cont.
+   */
+  template<class ContinuationT>
+  Future<typename std::result_of<ContinuationT()>::type>
+  then(ContinuationT cont)
+  {
+    typedef typename std::result_of<ContinuationT()>::type
+      cont_result_t;
+    typedef Future<cont_result_t> cont_future_t;
+
+    if (!valid()) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Future.then: future is not valid");
+    }
+    cont_future_t cont_future;
+    if (_ready) {
+      cont_future = cont_future_t([=]() mutable { return cont(); });
+    } else {
+      func_t func = std::move(_func);
+      cont_future = cont_future_t(
+                      [=]() mutable {
+                        if (func) {
+                          func();
+                        }
+                        return cont();
+                      });
+      cont_future._test_func = std::move(_test_func);
+      cont_future._handles   = std::move(_handles);
+    }
+    _handles.clear();
+    _ready    = false;
+    _has_func = false;
+    return cont_future;
+  }
+
+private:
+  /**
+   * Waits for local completion of pending operations and releases their
+   * handles without providing the result.
+   */
+  void _release_handles() noexcept
+  {
+    if (!_handles.empty()) {
+      if (dart_waitall_local(_handles.data(), _handles.size())
+          != DART_OK) {
+        DASH_LOG_ERROR("Future._release_handles()",
+                       "dart_waitall_local failed");
+      }
+      _handles.clear();
+    }
+  }
+
+}; // class Future<void>
+
+/**
+ * Creates a future that becomes ready once all futures in the range
+ * \c [first, last) are ready.
+ * The futures in the range must remain valid until the returned future
+ * is ready.
+ *
+ * \returns  A future providing \c last.
+ */
+template<class FutureIterator>
+Future<FutureIterator> when_all(
+  FutureIterator first,
+  FutureIterator last)
+{
+  return Future<FutureIterator>(
+           [=]() {
+             bool all_ready = true;
+             for (auto it = first; it != last; ++it) {
+               // Test every future to make progress on all operations:
+               all_ready = it->test() && all_ready;
+             }
+             return all_ready;
+           },
+           [=]() {
+             for (auto it = first; it != last; ++it) {
+               it->wait();
+             }
+             return last;
+           });
+}
+
+/**
+ * Creates a future that becomes ready once any future in the range
+ * \c [first, last) is ready.
+ * The futures in the range must remain valid until the returned future
+ * is ready.
+ *
+ * \returns  A future providing an iterator to the first ready future in
+ *           the range, or \c last if the range is empty.
+ */
+template<class FutureIterator>
+Future<FutureIterator> when_any(
+  FutureIterator first,
+  FutureIterator last)
+{
+  auto find_ready = [=]() {
+                      for (auto it = first; it != last; ++it) {
+                        if (it->test()) {
+                          return it;
+                        }
+                      }
+                      return last;
+                    };
+  return Future<FutureIterator>(
+           [=]() {
+             return first == last || find_ready() != last;
+           },
+           [=]() {
+             if (first == last) {
+               return last;
+             }
+             FutureIterator ready;
+             while ((ready = find_ready()) == last) { }
+             return ready;
+           });
+}
+
 template<typename ResultT>
 std::ostream & operator<<(
   std::ostream & os,
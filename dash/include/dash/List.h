@@ -13,6 +13,7 @@
 #include <dash/list/ListRef.h>
 #include <dash/list/LocalListRef.h>
 #include <dash/list/GlobListIter.h>
+#include <dash/list/ListQueue.h>
 #include <dash/list/internal/ListTypes.h>
 
 #include <iterator>
@@ -92,6 +93,7 @@ namespace dash {
  * <tt>reverse</tt>             | <tt>void</tt>       | Reverse the order of list elements
  * <b>Views (DASH specific)</b> | &nbsp;              | &nbsp;
  * <tt>local</tt>               | <tt>local_type</tt> | View on list elements local to calling unit
+ * <tt>queue</tt>               | <tt>queue_type</tt> | Lock-free queue shared by all units, independent of list elements
  * \}
  *
  * Usage examples:
@@ -163,6 +165,10 @@ namespace dash {
 /**
  * A dynamic bi-directional list with support for workload balancing.
  *
+ * Units that need to insert and remove elements concurrently without
+ * synchronization use the list's member \c queue, see \c dash::ListQueue.
+ * Elements in the queue are not elements of the list.
+ *
  * \concept{DashListConcept}
  */
 template<
@@ -189,6 +195,7 @@ public:
 
   typedef ListRef<ElementType, AllocatorType>                      view_type;
   typedef LocalListRef<ElementType, AllocatorType>                local_type;
+  typedef ListQueue<ElementType, AllocatorType>                   queue_type;
 
 private:
   typedef internal::ListNode<value_type>
@@ -241,6 +248,8 @@ public:
 public:
   /// Local proxy object, allows use in range-based for loops.
   local_type local;
+  /// Lock-free queue shared by all units, allocated with the list.
+  queue_type queue;
 
 private:
   /// Team containing all units interacting with the list.
@@ -595,6 +604,7 @@ public:
     if (_globmem != nullptr) {
       _globmem->commit();
     }
+    queue.barrier();
     // Accumulate local sizes of remote units:
     _remote_size = 0;
     for (int u = 0; u < _team->size(); ++u) {
@@ -642,6 +652,7 @@ public:
     DASH_LOG_TRACE_VAR("List.allocate", lcap);
 
     _globmem     = new glob_mem_type(lcap, *_team);
+    queue.allocate(_local_buffer_size, *_team);
     // Global iterators:
     _begin       = iterator(_globmem, _nil_node);
     _end         = _begin;
@@ -691,6 +702,7 @@ public:
       delete _globmem;
       _globmem = nullptr;
     }
+    queue.deallocate();
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
     DASH_LOG_TRACE_VAR("List.deallocate >", this);
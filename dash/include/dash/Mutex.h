@@ -10,6 +10,18 @@
 
 namespace dash {
 
+/**
+ * Tag type selecting a hierarchical lock in the construction of
+ * \c dash::Mutex.
+ */
+struct hierarchical_lock_t { };
+
+/**
+ * Tag selecting a hierarchical lock in the construction of
+ * \c dash::Mutex.
+ */
+constexpr hierarchical_lock_t hierarchical_lock { };
+
 /**
  * Behaves similar to \c std::mutex and is used to ensure mutual exclusion
  * within a dash team.
@@ -44,6 +56,17 @@ public:
    * @param team team for mutual exclusive accesses
    */
   explicit Mutex(Team & team = dash::Team::All());
+
+  /**
+   * Creates a hierarchical mutex in which units on the same node first
+   * arbitrate in shared memory before competing for the lock across
+   * nodes. The lock is preferably handed over between units on the same
+   * node, use it for critical sections mostly entered by co-located units.
+   *
+   * This function is not thread-safe
+   * @param team team for mutual exclusive accesses
+   */
+  Mutex(Team & team, hierarchical_lock_t);
   
   Mutex(const Mutex & other)               = delete;
   Mutex(Mutex && other)                    = default;
@@ -652,5 +652,6 @@ using Pattern = dash::BlockPattern<NumDimensions, Arrangement, IndexType>;
 #include <dash/pattern/PatternIterator.h>
 #include <dash/pattern/PatternProperties.h>
 #include <dash/pattern/MakePattern.h>
+#include <dash/pattern/LocalSegments.h>
 
 #endif // DASH__PATTERN_H__INCLUDED
@@ -0,0 +1,321 @@
+#ifndef DASH__READ_CACHE_H__INCLUDED
+#define DASH__READ_CACHE_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+
+#include <dash/internal/Math.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Read-only software cache of remote elements in a global memory
+ * segment.
+ *
+ * Remote elements are fetched in lines of contiguous bytes at the target
+ * unit, subsequent reads of elements in the same line are served from the
+ * cache. Lines are stored in a direct-mapped table.
+ * Cached lines are valid in the synchronization epoch of the team they
+ * have been fetched in (\see dash::Team::epoch) and invalidated by the
+ * next barrier or explicitly by \c invalidate().
+ *
+ * Elements located at the calling unit are read from local memory and
+ * never cached.
+ */
+template<typename T>
+class ReadCache
+{
+private:
+  typedef ReadCache<T>                              self_t;
+  typedef typename std::remove_const<T>::type       value_type;
+
+  struct line_tag
+  {
+    /// Target unit and line index of the cached line
+    uint64_t key;
+    /// Synchronization epoch the line has been fetched in
+    size_t   epoch;
+    bool     valid;
+  };
+
+public:
+  /**
+   * Creates a cache of elements in a global memory segment.
+   */
+  ReadCache(
+    /// Team that allocated the global memory segment
+    const dash::Team & team,
+    /// Global pointer to the begin of the segment, unit is ignored
+    dart_gptr_t        segment_begin,
+    /// Number of bytes in the segment at every unit, lines do not extend
+    /// beyond the segment end
+    size_t             segment_size,
+    /// Number of bytes in a line, rounded up to a power of two
+    size_t             line_size = 512,
+    /// Number of lines in the cache, rounded up to a power of two
+    size_t             num_lines = 1024)
+  : _team(&team),
+    _myid(team.myid()),
+    _segment_begin(segment_begin),
+    _segment_size(segment_size),
+    _line_shift(dash::math::internal::ilog2(
+                  next_pow2(std::max(line_size, sizeof(value_type))))),
+    _line_size(size_t(1) << _line_shift),
+    _slot_mask(next_pow2(std::max<size_t>(num_lines, 2)) - 1),
+    _tags(_slot_mask + 1, line_tag { 0, 0, false }),
+    _lines(_tags.size() * _line_size)
+  {
+    DASH_LOG_TRACE("ReadCache()",
+                   "line size:", _line_size,
+                   "lines:",     _tags.size());
+  }
+
+  ReadCache(const self_t & other)            = default;
+  ReadCache(self_t && other)                 = default;
+  self_t & operator=(const self_t & other)   = default;
+  self_t & operator=(self_t && other)        = default;
+
+  /**
+   * Value of the element referenced by the given global pointer.
+   */
+  value_type get(dart_gptr_t gptr)
+  {
+    value_type value;
+    if (gptr.unitid == _myid.id) {
+      void * addr;
+      DASH_ASSERT_RETURNS(
+        dart_gptr_getaddr(gptr, &addr),
+        DART_OK);
+      std::memcpy(&value, addr, sizeof(value_type));
+      return value;
+    }
+    uint64_t offset  = gptr.addr_or_offs.offset -
+                       _segment_begin.addr_or_offs.offset;
+    uint64_t line    = offset >> _line_shift;
+    uint64_t l_offs  = offset & (_line_size - 1);
+    if (l_offs + sizeof(value_type) > _line_size) {
+      // Element spans two lines:
+      ++_misses;
+      dart_storage_t ds = dash::dart_storage<value_type>(1);
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(&value, gptr, ds.nelem, ds.dtype),
+        DART_OK);
+      return value;
+    }
+    uint64_t key     = (static_cast<uint64_t>(gptr.unitid) << 40) | line;
+    // Consecutive lines of a unit are mapped to consecutive slots, line
+    // sequences of different units start at scattered slots:
+    size_t   slot    = (line + gptr.unitid * 0x9E3779B1ull) & _slot_mask;
+    auto   & tag     = _tags[slot];
+    char   * l_data  = _lines.data() + (slot << _line_shift);
+    size_t   epoch   = _team->epoch();
+    if (!tag.valid || tag.key != key || tag.epoch != epoch) {
+      fetch(gptr.unitid, line, l_data);
+      tag.key   = key;
+      tag.epoch = epoch;
+      tag.valid = true;
+    }
+    std::memcpy(&value, l_data + l_offs, sizeof(value_type));
+    return value;
+  }
+
+  /**
+   * Discards all cached lines.
+   */
+  void invalidate()
+  {
+    DASH_LOG_TRACE("ReadCache.invalidate()");
+    for (auto & tag : _tags) {
+      tag.valid = false;
+    }
+  }
+
+  /**
+   * Number of bytes in a cache line.
+   */
+  constexpr size_t line_size() const noexcept
+  {
+    return _line_size;
+  }
+
+  /**
+   * Number of reads of remote elements that required a transfer.
+   */
+  constexpr size_t misses() const noexcept
+  {
+    return _misses;
+  }
+
+private:
+  static constexpr size_t next_pow2(size_t n) noexcept
+  {
+    return (n < 2) ? 1 : (size_t(1) << dash::math::internal::ilog2(n - 1))
+                         << 1;
+  }
+
+  void fetch(
+    dart_unit_t   unit,
+    uint64_t      line,
+    char        * l_data)
+  {
+    ++_misses;
+    uint64_t l_begin = line << _line_shift;
+    size_t   nbytes  = std::min<uint64_t>(
+                         _line_size, _segment_size - l_begin);
+    dart_gptr_t gptr = _segment_begin;
+    gptr.unitid                = unit;
+    gptr.addr_or_offs.offset  += l_begin;
+    DASH_LOG_TRACE("ReadCache.fetch()",
+                   "unit:", unit, "line:", line, "bytes:", nbytes);
+    DASH_ASSERT_RETURNS(
+      dart_get_blocking(l_data, gptr, nbytes, DART_TYPE_BYTE),
+      DART_OK);
+  }
+
+private:
+  const dash::Team      * _team;
+  team_unit_t             _myid;
+  dart_gptr_t             _segment_begin;
+  size_t                  _segment_size;
+  unsigned                _line_shift;
+  size_t                  _line_size;
+  size_t                  _slot_mask;
+  std::vector<line_tag>   _tags;
+  std::vector<char>       _lines;
+  size_t                  _misses = 0;
+
+}; // class ReadCache
+
+/**
+ * Adapter for read access to the elements of a container via a
+ * \c dash::ReadCache.
+ *
+ * \see dash::cached
+ */
+template<class ContainerType>
+class CachedRange
+{
+private:
+  typedef CachedRange<ContainerType>                      self_t;
+  typedef typename ContainerType::value_type              value_type;
+  typedef typename ContainerType::index_type              index_type;
+  typedef typename ContainerType::size_type               size_type;
+
+public:
+  CachedRange(
+    const ContainerType & container,
+    size_t                line_size,
+    size_t                num_lines)
+  : _container(&container),
+    _cache(container.team(),
+           segment_begin(container),
+           container.pattern().local_capacity() * sizeof(value_type),
+           line_size,
+           num_lines)
+  { }
+
+  /**
+   * Value of the element at the given index of the container.
+   */
+  value_type operator[](index_type index)
+  {
+    return _cache.get((_container->begin() + index).dart_gptr());
+  }
+
+  constexpr size_type size() const noexcept
+  {
+    return _container->size();
+  }
+
+  /**
+   * Completes outstanding operations on the container and invalidates
+   * cached elements.
+   */
+  void flush()
+  {
+    _container->flush();
+    _cache.invalidate();
+  }
+
+  /**
+   * Discards cached elements.
+   */
+  void invalidate()
+  {
+    _cache.invalidate();
+  }
+
+  const ReadCache<value_type> & cache() const noexcept
+  {
+    return _cache;
+  }
+
+private:
+  /**
+   * Global pointer to the first element in local memory of units.
+   */
+  static dart_gptr_t segment_begin(const ContainerType & container)
+  {
+    dart_gptr_t gptr  = container.begin().dart_gptr();
+    auto        l_pos = container.pattern().local(0);
+    gptr.addr_or_offs.offset -= l_pos.index * sizeof(value_type);
+    return gptr;
+  }
+
+private:
+  const ContainerType   * _container;
+  ReadCache<value_type>   _cache;
+
+}; // class CachedRange
+
+/**
+ * Read access to elements of a container via a software cache of remote
+ * elements.
+ *
+ * Remote elements are fetched in lines of \c line_size bytes, subsequent
+ * reads of elements in the same line are served from local memory until
+ * the next barrier of the container's team or an explicit call of
+ * \c invalidate() or \c flush().
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Array<double> array(size);
+ *   // ...
+ *   array.barrier();
+ *   auto cached_array = dash::cached(array);
+ *   double sum = 0;
+ *   for (auto i : stencil_indices) {
+ *     sum += cached_array[i];
+ *   }
+ * \endcode
+ *
+ * \ingroup DashContainerConcept
+ */
+template<class ContainerType>
+CachedRange<ContainerType> cached(
+  /// Container providing global iterators
+  const ContainerType & container,
+  /// Number of bytes fetched per transfer
+  size_t                line_size = 512,
+  /// Maximum number of cached lines
+  size_t                num_lines = 1024)
+{
+  return CachedRange<ContainerType>(container, line_size, num_lines);
+}
+
+} // namespace dash
+
+#endif // DASH__READ_CACHE_H__INCLUDED
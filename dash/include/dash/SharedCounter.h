@@ -2,17 +2,39 @@
 #define DASH__SHARED_COUNTER_H_
 
 #include <dash/Array.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_locality.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
 
 namespace dash {
 
 /**
- * A simple shared counter that allows atomic increment-
- * and decrement operations.
+ * A shared counter that allows atomic increment- and decrement
+ * operations.
  *
- * TODO: Should probably be based on MPI_ACCUMULATE.
+ * Units located at the same node accumulate their increments and
+ * decrements in the counter value of the node's first unit (the node's
+ * leader unit). Reading the counter therefore only requires one atomic
+ * read per node.
+ *
+ * All accesses to counter values are MPI atomic operations, as MPI does
+ * not define the atomicity of processor atomics mixed with accumulate
+ * operations on the same window. Within a node these operations are
+ * served from the node's shared memory window where MPI supports it.
  */
 template<typename ValueType = int>
 class SharedCounter {
+  static_assert(
+    dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED,
+    "dash::SharedCounter requires a value type supported by DART");
+
 private:
   typedef SharedCounter<ValueType> self_t;
 
@@ -21,20 +43,17 @@ public:
    * Constructor.
    */
   SharedCounter()
-  : _num_units(dash::Team::All().size()),
-    _myid(dash::Team::All().myid()),
-    _local_counts(_num_units)
-  {
-    _local_counts.local[0] = 0;
-    _local_counts.barrier();
-  }
+  : SharedCounter(dash::Team::All())
+  { }
 
   SharedCounter(dash::Team& team)
-  : _num_units(team.size()),
+  : _team(&team),
+    _num_units(team.size()),
     _myid(team.myid()),
     _local_counts(_num_units, team)
   {
     _local_counts.local[0] = 0;
+    init_leaders();
     _local_counts.barrier();
   }
 
@@ -45,7 +64,7 @@ public:
     /// Increment value
     ValueType increment)
   {
-    _local_counts[_myid] += increment;
+    accumulate(increment);
   }
 
   /**
@@ -53,36 +72,138 @@ public:
    */
   void dec(
     /// Decrement value
-    ValueType increment)
+    ValueType decrement)
   {
-    _local_counts[_myid] -= increment;
+    accumulate(ValueType(0) - decrement);
   }
 
   /**
    * Read the current value of the shared counter.
-   * Accumulates increment/decrement values of every unit.
-   * Reading a shared is not atomic, use Team::barrier() to synchronize.
+   * Accumulates the counter values of all node leader units, every value
+   * is read atomically. Reads are issued concurrently and completed in a
+   * single flush.
+   * Reading a shared counter is not atomic, use Team::barrier() to
+   * synchronize.
    *
-   * \complexity  O(u) for \c u units in the associated team
+   * \complexity  O(n) for \c n nodes of units in the associated team
    */
   ValueType get() const
   {
+    std::vector<ValueType> counts(_leaders.size());
+    ValueType              nop = 0;
+    for (size_t l = 0; l < _leaders.size(); ++l) {
+      DASH_ASSERT_RETURNS(
+        dart_fetch_and_op(
+          _local_counts[_leaders[l]].dart_gptr(),
+          &nop,
+          &counts[l],
+          dash::dart_datatype<ValueType>::value,
+          DART_OP_NO_OP),
+        DART_OK);
+    }
+    DASH_ASSERT_RETURNS(
+      dart_flush_all(_local_counts.begin().dart_gptr()),
+      DART_OK);
     ValueType acc = 0;
-    for (team_unit_t i{0}; i < _num_units; ++i) {
-      // use local access on own counter value:
-      acc += (i == _myid
-                ? _local_counts.local[0]
-                : _local_counts[i]);
+    for (auto count : counts) {
+      acc += count;
     }
     return acc;
   }
 
+  /**
+   * Read the current value of the shared counter in a collective
+   * reduction.
+   * Collective operation, the value is returned at all units.
+   *
+   * \complexity  O(log u) for \c u units in the associated team
+   */
+  ValueType reduce() const
+  {
+    ValueType l_count = 0;
+    ValueType g_count = 0;
+    if (_leader == _myid) {
+      ValueType nop = 0;
+      DASH_ASSERT_RETURNS(
+        dart_fetch_and_op(
+          _local_counts[_myid].dart_gptr(),
+          &nop,
+          &l_count,
+          dash::dart_datatype<ValueType>::value,
+          DART_OP_NO_OP),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_flush(_local_counts[_myid].dart_gptr()),
+        DART_OK);
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &l_count,
+        &g_count,
+        1,
+        dash::dart_datatype<ValueType>::value,
+        DART_OP_SUM,
+        _team->dart_id()),
+      DART_OK);
+    return g_count;
+  }
+
+private:
+  /**
+   * Atomically adds the given value to the counter value of the local
+   * node's leader unit.
+   */
+  void accumulate(ValueType value)
+  {
+    auto gptr = _local_counts[_leader].dart_gptr();
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(
+        gptr,
+        &value,
+        1,
+        dash::dart_datatype<ValueType>::value,
+        DART_OP_SUM),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_flush(gptr), DART_OK);
+  }
+
+  /**
+   * Resolves the leader unit of every node from the host names in the
+   * units' locality information.
+   */
+  void init_leaders()
+  {
+    std::vector<std::string> hosts;
+    for (team_unit_t u{0}; u < _num_units; ++u) {
+      dart_unit_locality_t * uloc;
+      DASH_ASSERT_RETURNS(
+        dart_unit_locality(_team->dart_id(), u, &uloc),
+        DART_OK);
+      std::string host(uloc->hwinfo.host);
+      size_t      node = std::find(hosts.begin(), hosts.end(), host)
+                         - hosts.begin();
+      if (node == hosts.size()) {
+        hosts.push_back(host);
+        _leaders.push_back(u);
+      }
+      if (u == _myid) {
+        _leader = _leaders[node];
+      }
+    }
+  }
+
 private:
+  /// The team of units interacting with the counter
+  dash::Team           * _team;
   /// The number of units interacting with the counter
   size_t                 _num_units;
   /// The DART id of the unit that created this local counter intance
   team_unit_t            _myid;
-  /// Buffer containing counter increments/decrements of every unit
+  /// The leader unit of the local node
+  team_unit_t            _leader{0};
+  /// The first unit of every node, holding the node's counter value
+  std::vector<team_unit_t> _leaders;
+  /// Buffer containing counter increments/decrements of every node
   dash::Array<ValueType> _local_counts;
 };
 
@@ -0,0 +1,89 @@
+#ifndef DASH__SHARED_MUTEX_H__INCLUDED
+#define DASH__SHARED_MUTEX_H__INCLUDED
+
+#include <dash/Team.h>
+
+#include <dash/dart/if/dart_synchronization.h>
+
+
+namespace dash {
+
+/**
+ * Behaves similar to \c std::shared_timed_mutex without timed locking and
+ * is used to ensure shared read and exclusive write access within a dash
+ * team.
+ *
+ * Any number of units may hold the mutex in shared mode at the same time,
+ * a unit holding it in exclusive mode excludes all other units. Units
+ * waiting for exclusive access have precedence over units arriving for
+ * shared access.
+ *
+ * \note This works properly with \c std::lock_guard and
+ *       \c std::shared_lock
+ * \note SharedMutex cannot be placed in DASH containers
+ *
+ * \code
+ * dash::SharedMutex mx; // mutex for dash::Team::All();
+ * dash::Shared<int> config;
+ * {
+ *    std::shared_lock<dash::SharedMutex> sl(mx);
+ *    int value = config.get();
+ * }
+ * {
+ *    std::lock_guard<dash::SharedMutex> lg(mx);
+ *    config.set(42);
+ * }
+ * \endcode
+ */
+class SharedMutex {
+private:
+  using self_t = SharedMutex;
+
+public:
+  /**
+   * DASH SharedMutex is only valid for a dash team. If no team is passed,
+   * team all is used.
+   *
+   * This function is not thread-safe
+   * @param team team for mutual exclusive accesses
+   */
+  explicit SharedMutex(Team & team = dash::Team::All());
+
+  SharedMutex(const SharedMutex & other)   = delete;
+
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Collective destructor to destruct a DART reader-writer lock.
+   *
+   * This function is not thread-safe
+   */
+  ~SharedMutex();
+
+  /**
+   * Block until the lock was acquired for exclusive access.
+   */
+  void lock();
+
+  /**
+   * Release exclusive access acquired through \c lock().
+   */
+  void unlock();
+
+  /**
+   * Block until the lock was acquired for shared access.
+   */
+  void lock_shared();
+
+  /**
+   * Release shared access acquired through \c lock_shared().
+   */
+  void unlock_shared();
+
+private:
+  dart_rwlock_t _mutex;
+}; // class SharedMutex
+
+} // namespace dash
+
+#endif // DASH__SHARED_MUTEX_H__INCLUDED
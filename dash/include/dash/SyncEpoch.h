@@ -0,0 +1,200 @@
+#ifndef DASH__SYNC_EPOCH_H__INCLUDED
+#define DASH__SYNC_EPOCH_H__INCLUDED
+
+#include <dash/Team.h>
+#include <dash/Types.h>
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Scoped active-target synchronization epoch of a team in which one-sided
+ * operations are completed by collective fences instead of flushes.
+ *
+ * Construction and destruction are collective operations on the team.
+ * Puts, gets and accumulates issued in the epoch complete at the next call
+ * of \c fence() or at the end of the epoch. Call \c close() to end the
+ * epoch explicitly, errors in the destructor are only logged. Blocking and handle-based
+ * one-sided operations are not permitted in the epoch, flushes have no
+ * effect.
+ *
+ * \code
+ * dash::Array<int> arr(dash::size());
+ * int value = dash::myid();
+ * {
+ *   dash::FenceEpoch epoch;
+ *   auto right = (dash::myid() + 1) % dash::size();
+ *   dart_put((arr.begin() + right).dart_gptr(), &value, 1, DART_TYPE_INT);
+ * } // values have been written to all units
+ * \endcode
+ */
+class FenceEpoch
+{
+private:
+  typedef FenceEpoch self_t;
+
+public:
+  /**
+   * Collectively opens a fence epoch on the given team.
+   */
+  explicit FenceEpoch(Team & team = dash::Team::All())
+  : _team(team)
+  {
+    DASH_ASSERT_RETURNS(
+      dart_epoch_fence_begin(_team.dart_id()),
+      DART_OK);
+  }
+
+  FenceEpoch(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other)    = delete;
+
+  /**
+   * Collectively closes the epoch unless it has been closed already.
+   */
+  ~FenceEpoch()
+  {
+    if (!_closed) {
+      _closed = true;
+      if (dart_epoch_fence_end(_team.dart_id()) != DART_OK) {
+        DASH_LOG_ERROR("FenceEpoch.~FenceEpoch()",
+                       "dart_epoch_fence_end failed");
+      }
+    }
+  }
+
+  /**
+   * Collectively closes the epoch, completing all operations issued in it.
+   * Has no effect if the epoch has been closed already.
+   *
+   * \throws  dash::exception::RuntimeError  if the epoch could not be
+   *          closed
+   */
+  void close()
+  {
+    if (_closed) {
+      return;
+    }
+    _closed = true;
+    if (dart_epoch_fence_end(_team.dart_id()) != DART_OK) {
+      DASH_THROW(dash::exception::RuntimeError,
+                 "FenceEpoch.close: dart_epoch_fence_end failed");
+    }
+  }
+
+  /**
+   * Collectively completes all operations issued in the epoch so far.
+   */
+  void fence()
+  {
+    DASH_ASSERT_RETURNS(
+      dart_epoch_fence(_team.dart_id()),
+      DART_OK);
+  }
+
+private:
+  Team & _team;
+  bool   _closed = false;
+
+}; // class FenceEpoch
+
+/**
+ * Scoped post-start-complete-wait synchronization epoch which only
+ * synchronizes a unit with its neighbors.
+ *
+ * A unit exposes its memory to the units in \c origins and accesses the
+ * memory of units in \c targets. Neighbor lists must be consistent across
+ * the team: unit \c a must be listed in the origins of \c b if and only if
+ * \c b is listed in the targets of \c a.
+ * Puts, gets and accumulates to targets complete at the end of the epoch,
+ * writes of origins to the unit's memory are visible after the end of the
+ * epoch. Suitable for halo exchanges with a fixed set of neighbors.
+ * Call \c close() to end the epoch explicitly, errors in the destructor
+ * are only logged.
+ */
+class NeighborEpoch
+{
+private:
+  typedef NeighborEpoch self_t;
+
+public:
+  /**
+   * Opens an epoch exposing memory to and accessing memory of the same
+   * set of neighbors.
+   */
+  NeighborEpoch(
+    const std::vector<team_unit_t> & neighbors,
+    Team                           & team = dash::Team::All())
+  : NeighborEpoch(neighbors, neighbors, team)
+  { }
+
+  /**
+   * Opens an epoch exposing memory to units in \c origins and accessing
+   * memory of units in \c targets.
+   */
+  NeighborEpoch(
+    const std::vector<team_unit_t> & origins,
+    const std::vector<team_unit_t> & targets,
+    Team                           & team = dash::Team::All())
+  : _team(team)
+  {
+    std::vector<dart_team_unit_t> d_origins(origins.begin(), origins.end());
+    std::vector<dart_team_unit_t> d_targets(targets.begin(), targets.end());
+    DASH_ASSERT_RETURNS(
+      dart_epoch_pscw_begin(
+        _team.dart_id(),
+        d_origins.data(), d_origins.size(),
+        d_targets.data(), d_targets.size()),
+      DART_OK);
+  }
+
+  NeighborEpoch(const self_t & other)         = delete;
+  self_t & operator=(const self_t & other)    = delete;
+
+  /**
+   * Closes the epoch unless it has been closed already.
+   */
+  ~NeighborEpoch()
+  {
+    if (!_closed) {
+      _closed = true;
+      if (dart_epoch_pscw_end(_team.dart_id()) != DART_OK) {
+        DASH_LOG_ERROR("NeighborEpoch.~NeighborEpoch()",
+                       "dart_epoch_pscw_end failed");
+      }
+    }
+  }
+
+  /**
+   * Closes the epoch, waits for completion of operations on targets and
+   * of operations of origins on the unit's memory.
+   * Has no effect if the epoch has been closed already.
+   *
+   * \throws  dash::exception::RuntimeError  if the epoch could not be
+   *          closed
+   */
+  void close()
+  {
+    if (_closed) {
+      return;
+    }
+    _closed = true;
+    if (dart_epoch_pscw_end(_team.dart_id()) != DART_OK) {
+      DASH_THROW(dash::exception::RuntimeError,
+                 "NeighborEpoch.close: dart_epoch_pscw_end failed");
+    }
+  }
+
+private:
+  Team & _team;
+  bool   _closed = false;
+
+}; // class NeighborEpoch
+
+} // namespace dash
+
+#endif // DASH__SYNC_EPOCH_H__INCLUDED
@@ -6,6 +6,7 @@
 #include <dash/Init.h>
 #include <dash/Types.h>
 #include <dash/Exception.h>
+#include <dash/Future.h>
 
 #include <dash/util/Locality.h>
 
@@ -15,6 +16,7 @@
 #include <unordered_map>
 #include <iostream>
 #include <memory>
+#include <vector>
 #include <type_traits>
 
 
@@ -145,6 +147,7 @@ public:
       _num_siblings = t._num_siblings;
       _myid         = t._myid;
       _size         = t._size;
+      _epoch        = t._epoch;
     }
   }
 
@@ -166,6 +169,7 @@ public:
       _num_siblings = t._num_siblings;
       _myid         = t._myid;
       _size         = t._size;
+      _epoch        = t._epoch;
     }
     return *this;
   }
@@ -464,9 +468,49 @@ public:
       DASH_ASSERT_RETURNS(
         dart_barrier(_dartid),
         DART_OK);
+      ++_epoch;
     }
   }
 
+  /**
+   * Non-blocking barrier, all units in the team have entered the barrier
+   * once the returned future is ready.
+   * The synchronization epoch of the team is advanced when the returned
+   * future completes in \c test, \c wait or \c get.
+   */
+  inline dash::Future<void> barrier_async() const
+  {
+    std::vector<dart_handle_t> handles;
+    if (is_null()) {
+      return dash::Future<void>(std::move(handles));
+    }
+    dart_handle_t handle;
+    DASH_ASSERT_RETURNS(
+      dart_ibarrier(_dartid, &handle),
+      DART_OK);
+    handles.push_back(handle);
+    // Values read before the barrier completed must not be considered
+    // valid in the following epoch:
+    const Team * team = this;
+    return dash::Future<void>(
+             std::move(handles),
+             [team]() { ++team->_epoch; });
+  }
+
+  /**
+   * Synchronization epoch of the calling unit in the team, incremented
+   * in every \c Team::barrier and on completion of every
+   * \c Team::barrier_async.
+   * Values of remote elements read in an earlier epoch might have been
+   * modified by other units since.
+   * Synchronization that does not use these methods, e.g. \c dart_barrier
+   * or collective operations, does not advance the epoch.
+   */
+  inline size_t epoch() const noexcept
+  {
+    return _epoch;
+  }
+
   inline team_unit_t myid() const
   {
     if (_myid == -1 && dash::is_initialized() && _dartid != DART_TEAM_NULL) {
@@ -595,6 +639,7 @@ private:
   mutable team_unit_t     _myid         = UNDEFINED_TEAM_UNIT_ID;
   mutable bool            _has_group    = false;
   mutable dart_group_t    _group        = DART_GROUP_NULL;
+  mutable size_t          _epoch        = 0;
 
   /// Deallocation list for freeing memory acquired via
   /// team-aligned allocation
@@ -0,0 +1,358 @@
+#ifndef DASH__WRITE_COMBINER_H__INCLUDED
+#define DASH__WRITE_COMBINER_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/GlobPtr.h>
+#include <dash/GlobRef.h>
+#include <dash/GlobAsyncRef.h>
+#include <dash/Atomic.h>
+#include <dash/Exception.h>
+
+#include <dash/algorithm/Operation.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <tuple>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Aggregates element-wise writes and atomic updates to global memory and
+ * publishes them in contiguous transfers.
+ *
+ * Writes are buffered per target unit and global memory segment. A buffer
+ * is published when it reaches its capacity, on \c flush() and when the
+ * write combiner is destroyed. Callers should publish pending writes with
+ * an explicit \c flush() as errors cannot be reported in the destructor.
+ * When a buffer is published, multiple writes to the same element are
+ * reduced to a single value and writes to adjacent elements are merged to
+ * a single \c dart_put, atomic updates to a single \c dart_accumulate.
+ *
+ * Writes are not visible at the target before they have been published.
+ * Ordering of plain writes and atomic updates of the same element between
+ * two flushes is undefined.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Array<int>         array(size);
+ *   dash::WriteCombiner<int> wc;
+ *   for (auto i : indices) {
+ *     // Instead of array[i] = value:
+ *     wc.put(array[i], value);
+ *   }
+ *   wc.flush();
+ *   array.barrier();
+ * \endcode
+ */
+template<typename T>
+class WriteCombiner
+{
+private:
+  typedef WriteCombiner<T>                          self_t;
+  typedef typename std::remove_const<T>::type       value_type;
+  typedef std::function<
+            value_type(const value_type &,
+                       const value_type &)>         combine_fun;
+
+  /// Operation tag of buffers of plain writes
+  static constexpr int put_op = -1;
+
+  /**
+   * Buffered write to a single element.
+   */
+  struct write_entry
+  {
+    /// Offset of the element in the target segment in bytes
+    uint64_t   offset;
+    value_type value;
+  };
+
+  /**
+   * Identifies the buffer of a target unit, memory segment and operation.
+   */
+  struct buffer_key
+  {
+    dart_team_t teamid;
+    int32_t     unitid;
+    int16_t     segid;
+    int         op;
+
+    bool operator<(const buffer_key & other) const
+    {
+      return std::tie(teamid, unitid, segid, op) <
+             std::tie(other.teamid, other.unitid, other.segid, other.op);
+    }
+  };
+
+  struct buffer
+  {
+    /// Global pointer to the target segment at the target unit
+    dart_gptr_t              gptr;
+    /// Reduces multiple writes to the same element
+    combine_fun              combine;
+    /// Writes in the order they have been issued
+    std::vector<write_entry> entries;
+    /// Contiguous values of published transfers, must remain valid
+    /// until the target has been flushed
+    std::vector<value_type>  values;
+  };
+
+public:
+  /**
+   * Creates a write combiner with the specified capacity of buffered
+   * writes per target unit and memory segment.
+   */
+  explicit WriteCombiner(
+    size_t capacity = 4096)
+  : _capacity(std::max<size_t>(1, capacity))
+  { }
+
+  WriteCombiner(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other)       = delete;
+
+  WriteCombiner(self_t && other)                 = default;
+  self_t & operator=(self_t && other)            = default;
+
+  /**
+   * Publishes all pending writes.
+   * Errors in publishing writes are logged but not reported, call
+   * \c flush() explicitly before the write combiner is destroyed to
+   * handle them.
+   */
+  ~WriteCombiner()
+  {
+    try {
+      flush();
+    } catch (const std::exception & e) {
+      DASH_LOG_ERROR("WriteCombiner.~WriteCombiner()",
+                     "flush failed:", e.what());
+    }
+  }
+
+  /**
+   * Buffers a write of \c value to the element referenced by a global
+   * pointer.
+   */
+  void put(
+    dart_gptr_t        gptr,
+    const value_type & value)
+  {
+    append(gptr, put_op, dash::second<value_type>(), value);
+  }
+
+  /**
+   * Buffers a write of \c value to the element referenced by a global
+   * pointer.
+   */
+  template<class MemSpaceT>
+  void put(
+    const GlobPtr<T, MemSpaceT> & gptr,
+    const value_type            & value)
+  {
+    put(gptr.dart_gptr(), value);
+  }
+
+  /**
+   * Buffers a write of \c value to the referenced element.
+   */
+  void put(
+    const GlobRef<T>   & gref,
+    const value_type   & value)
+  {
+    put(gref.dart_gptr(), value);
+  }
+
+  /**
+   * Buffers a write of \c value to the referenced element.
+   */
+  void put(
+    const GlobAsyncRef<T> & gref,
+    const value_type      & value)
+  {
+    put(gref.dart_gptr(), value);
+  }
+
+  /**
+   * Buffers an atomic update of the referenced element with \c value
+   * using the specified reduce operation, e.g. \c dash::plus.
+   * Updates of the same element are combined by the operation before
+   * they are published.
+   */
+  template<class BinaryOp = dash::plus<value_type>>
+  void accumulate(
+    const GlobRef<dash::Atomic<T>> & gref,
+    const value_type               & value,
+    BinaryOp                         binary_op = BinaryOp())
+  {
+    append(gref.dart_gptr(), binary_op.dart_operation(), binary_op, value);
+  }
+
+  /**
+   * Publishes pending writes and blocks until they are completed at
+   * their targets.
+   */
+  void flush()
+  {
+    DASH_LOG_TRACE("WriteCombiner.flush()", "buffers:", _buffers.size());
+    for (auto & kv : _buffers) {
+      publish(kv.first, kv.second);
+    }
+    for (auto & kv : _buffers) {
+      complete(kv.second);
+    }
+    DASH_LOG_TRACE("WriteCombiner.flush >");
+  }
+
+  /**
+   * Number of buffered writes that have not been published yet.
+   */
+  size_t size() const noexcept
+  {
+    size_t nentries = 0;
+    for (const auto & kv : _buffers) {
+      nentries += kv.second.entries.size();
+    }
+    return nentries;
+  }
+
+  /**
+   * Maximum number of buffered writes per target unit and memory segment.
+   */
+  constexpr size_t capacity() const noexcept
+  {
+    return _capacity;
+  }
+
+private:
+  template<class BinaryOp>
+  void append(
+    dart_gptr_t        gptr,
+    int                op,
+    BinaryOp           binary_op,
+    const value_type & value)
+  {
+    buffer_key key { gptr.teamid, gptr.unitid, gptr.segid, op };
+    auto buf_it = _buffers.find(key);
+    if (buf_it == _buffers.end()) {
+      buffer buf;
+      buf.gptr    = gptr;
+      buf.combine = binary_op;
+      buf.gptr.addr_or_offs.offset = 0;
+      buf.entries.reserve(_capacity);
+      buf_it = _buffers.insert(std::make_pair(key, std::move(buf))).first;
+    }
+    auto & buf = buf_it->second;
+    buf.entries.push_back({ gptr.addr_or_offs.offset, value });
+    if (buf.entries.size() >= _capacity) {
+      DASH_LOG_TRACE("WriteCombiner.append", "buffer full",
+                     "unit:", key.unitid, "segment:", key.segid);
+      publish(key, buf);
+      complete(buf);
+    }
+  }
+
+  /**
+   * Issues transfers of all pending writes in a buffer.
+   * Writes to the same element are reduced in the order they have been
+   * issued, writes to adjacent elements are published in a single
+   * transfer.
+   */
+  void publish(
+    const buffer_key & key,
+    buffer           & buf)
+  {
+    if (buf.entries.empty()) {
+      return;
+    }
+    auto & entries = buf.entries;
+    std::stable_sort(
+      entries.begin(), entries.end(),
+      [](const write_entry & a, const write_entry & b) {
+        return a.offset < b.offset;
+      });
+    // Reduce writes to the same element, values are packed in the order
+    // of their offsets so runs of adjacent elements are contiguous:
+    std::vector<uint64_t> offsets;
+    buf.values.clear();
+    buf.values.reserve(entries.size());
+    offsets.reserve(entries.size());
+    for (const auto & entry : entries) {
+      if (!offsets.empty() && offsets.back() == entry.offset) {
+        buf.values.back() = buf.combine(buf.values.back(), entry.value);
+      } else {
+        offsets.push_back(entry.offset);
+        buf.values.push_back(entry.value);
+      }
+    }
+    entries.clear();
+
+    DASH_LOG_TRACE("WriteCombiner.publish()",
+                   "unit:",     key.unitid,
+                   "segment:",  key.segid,
+                   "elements:", offsets.size());
+    for (size_t first = 0; first < offsets.size();) {
+      size_t nelem = 1;
+      while (first + nelem < offsets.size() &&
+             offsets[first + nelem] ==
+               offsets[first] + nelem * sizeof(value_type)) {
+        ++nelem;
+      }
+      dart_gptr_t gptr = buf.gptr;
+      gptr.addr_or_offs.offset = offsets[first];
+      if (key.op == put_op) {
+        dart_storage_t ds = dash::dart_storage<value_type>(nelem);
+        DASH_ASSERT_RETURNS(
+          dart_put(gptr, &buf.values[first], ds.nelem, ds.dtype),
+          DART_OK);
+      } else {
+        DASH_ASSERT_RETURNS(
+          dart_accumulate(
+            gptr,
+            &buf.values[first],
+            nelem,
+            dash::dart_punned_datatype<value_type>::value,
+            static_cast<dart_operation_t>(key.op)),
+          DART_OK);
+      }
+      first += nelem;
+    }
+  }
+
+  /**
+   * Blocks until published writes of a buffer are completed at their
+   * target.
+   */
+  void complete(
+    buffer & buf)
+  {
+    if (buf.values.empty()) {
+      return;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_flush(buf.gptr),
+      DART_OK);
+    buf.values.clear();
+  }
+
+private:
+  size_t                         _capacity;
+  std::map<buffer_key, buffer>   _buffers;
+
+}; // class WriteCombiner
+
+template<typename T>
+constexpr int WriteCombiner<T>::put_op;
+
+} // namespace dash
+
+#endif // DASH__WRITE_COMBINER_H__INCLUDED
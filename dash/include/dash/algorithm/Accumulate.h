@@ -2,65 +2,224 @@
 #define DASH__ALGORITHM__ACCUMULATE_H__
 
 #include <dash/Array.h>
+#include <dash/Types.h>
+#include <dash/Team.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
 
 namespace dash {
 
+namespace internal {
+
 /**
- * Accumulate values in range \c [first, last) as the sum of all values
- * in the range.
- *
- * Note: For equivalent of semantics of \c MPI_Accumulate, see
- * \c dash::transform.
- *
- * Semantics:
+ * Identity element of a reduce operation, used as contribution of units
+ * with empty local range in reductions delegated to \c dart_allreduce.
  *
- *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
+ * Only defined for operations that map to a commutative DART operation.
+ */
+template <class BinaryOperation>
+struct accumulate_identity {
+  typedef void value_type;
+  static constexpr bool defined = false;
+};
+
+template <typename ValueType>
+struct accumulate_identity< dash::plus<ValueType> > {
+  typedef ValueType value_type;
+  static constexpr bool defined = true;
+  static ValueType value() { return ValueType(0); }
+};
+
+template <typename ValueType>
+struct accumulate_identity< dash::multiply<ValueType> > {
+  typedef ValueType value_type;
+  static constexpr bool defined = true;
+  static ValueType value() { return ValueType(1); }
+};
+
+template <typename ValueType>
+struct accumulate_identity< dash::min<ValueType> > {
+  typedef ValueType value_type;
+  static constexpr bool defined = true;
+  static ValueType value() {
+    return std::numeric_limits<ValueType>::max();
+  }
+};
+
+template <typename ValueType>
+struct accumulate_identity< dash::max<ValueType> > {
+  typedef ValueType value_type;
+  static constexpr bool defined = true;
+  static ValueType value() {
+    return std::numeric_limits<ValueType>::lowest();
+  }
+};
+
+template <typename ValueType>
+struct accumulate_identity< dash::bit_and<ValueType> > {
+  typedef ValueType value_type;
+  static constexpr bool defined = true;
+  static ValueType value() { return ~ValueType(0); }
+};
+
+template <typename ValueType>
+struct accumulate_identity< dash::bit_or<ValueType> > {
+  typedef ValueType value_type;
+  static constexpr bool defined = true;
+  static ValueType value() { return ValueType(0); }
+};
+
+template <typename ValueType>
+struct accumulate_identity< dash::bit_xor<ValueType> > {
+  typedef ValueType value_type;
+  static constexpr bool defined = true;
+  static ValueType value() { return ValueType(0); }
+};
+
+/**
+ * Whether the reduction of values of type \c ValueType with operation
+ * \c BinaryOperation can be delegated to \c dart_allreduce.
+ */
+template <class ValueType, class BinaryOperation>
+struct accumulate_use_dart_op
+: public std::integral_constant<
+           bool,
+           accumulate_identity<BinaryOperation>::defined &&
+           std::is_same<
+             ValueType,
+             typename accumulate_identity<BinaryOperation>::value_type
+           >::value &&
+           dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED &&
+           dash::dart_datatype<ValueType>::value != DART_TYPE_BYTE >
+{ };
+
+/**
+ * Reduces the local partial results of all units in \c team using the
+ * DART reduce operation associated with \c binary_op.
  *
- * \see      dash::transform
+ * The result is available at all units.
+ */
+template <
+  class ValueType,
+  class LocalInputIt,
+  class BinaryOperation >
+typename std::enable_if<
+  accumulate_use_dart_op<ValueType, BinaryOperation>::value,
+  ValueType >::type
+accumulate_reduce(
+  LocalInputIt            l_first,
+  LocalInputIt            l_last,
+  ValueType               init,
+  BinaryOperation         binary_op,
+  dash::Team            & team)
+{
+  ValueType l_result = std::accumulate(
+                         l_first, l_last,
+                         accumulate_identity<BinaryOperation>::value(),
+                         binary_op);
+  ValueType g_result;
+
+  DASH_LOG_TRACE("dash::accumulate", "dart_allreduce()");
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_result,
+      &g_result,
+      1,
+      dash::dart_datatype<ValueType>::value,
+      binary_op.dart_operation(),
+      team.dart_id()),
+    DART_OK);
+
+  return binary_op(init, g_result);
+}
+
+/**
+ * Reduces the local partial results of all units in \c team using a
+ * user-defined reduce operation by gathering the partial results at all
+ * units and folding them in unit order.
  *
- * \ingroup  DashAlgorithms
+ * The result is available at all units.
  */
 template <
-  class GlobInputIt,
-  class ValueType >
-ValueType accumulate(
-  GlobInputIt     in_first,
-  GlobInputIt     in_last,
-  ValueType       init)
+  class ValueType,
+  class LocalInputIt,
+  class BinaryOperation >
+typename std::enable_if<
+  !accumulate_use_dart_op<ValueType, BinaryOperation>::value,
+  ValueType >::type
+accumulate_reduce(
+  LocalInputIt            l_first,
+  LocalInputIt            l_last,
+  ValueType               init,
+  BinaryOperation         binary_op,
+  dash::Team            & team)
 {
-  typedef typename GlobInputIt::index_type index_t;
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::accumulate requires a trivially copyable value type");
 
-  auto & team      = in_first.team();
-  auto myid        = team.myid();
-  auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init);
-  auto result      = 0;
+  typedef struct {
+    ValueType value;
+    bool      valid;
+  } partial_t;
+
+  // Units with empty local range do not contribute to the result:
+  partial_t l_partial;
+  l_partial.valid = (l_first != l_last);
+  l_partial.value = l_partial.valid
+                    ? std::accumulate(std::next(l_first), l_last,
+                                      ValueType(*l_first), binary_op)
+                    : init;
 
-  dash::Array<index_t> l_results(team.size(), team);
-  l_results.local[0] = l_result;
+  std::vector<partial_t> partials(team.size());
 
-  team.barrier();
+  DASH_LOG_TRACE("dash::accumulate", "dart_allgather()");
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_partial,
+      partials.data(),
+      sizeof(partial_t),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
 
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result += l_results[i];
+  ValueType result = init;
+  for (const auto & partial : partials) {
+    if (partial.valid) {
+      result = binary_op(result, partial.value);
     }
   }
   return result;
 }
 
+} // namespace internal
+
 /**
  * Accumulate values in range \c [first, last) using the given binary
  * reduce function \c op.
  *
- * Collective operation.
+ * Collective operation, the result is returned at all units.
+ *
+ * Reduce operations from \c dash/algorithm/Operation.h on arithmetic
+ * value types are performed by a single \c dart_allreduce. Any other
+ * operation is applied to the local partial results of all units in unit
+ * order.
+ *
+ * Elements are combined in the order of local memory at every unit which
+ * differs from global iteration order for cyclic and block-cyclic
+ * patterns, so \c binary_op is required to be associative and
+ * commutative.
  *
  * Note: For equivalent of semantics of \c MPI_Accumulate, see
  * \c dash::transform.
@@ -83,27 +242,45 @@ ValueType accumulate(
   ValueType       init,
   BinaryOperation binary_op = dash::plus<ValueType>())
 {
-  typedef typename GlobInputIt::index_type index_t;
-
   auto & team      = in_first.team();
-  auto myid        = team.myid();
   auto index_range = dash::local_range(in_first, in_last);
   auto l_first     = index_range.begin;
   auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init, binary_op);
-  auto result      = 0;
-
-  dash::Array<index_t> l_results(team.size(), team);
-  l_results.local[0] = l_result;
 
-  team.barrier();
-
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result = binary_op(result, l_results[i]);
-    }
+  if (team.size() == 1) {
+    return std::accumulate(l_first, l_last, init, binary_op);
   }
-  return result;
+  return dash::internal::accumulate_reduce(
+           l_first, l_last, init, binary_op, team);
+}
+
+/**
+ * Accumulate values in range \c [first, last) as the sum of all values
+ * in the range.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * Note: For equivalent of semantics of \c MPI_Accumulate, see
+ * \c dash::transform.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
+ *
+ * \see      dash::transform
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType >
+ValueType accumulate(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init)
+{
+  return dash::accumulate(in_first, in_last, init,
+                          dash::plus<ValueType>());
 }
 
 } // namespace dash
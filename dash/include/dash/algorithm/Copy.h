@@ -5,6 +5,8 @@
 #include <dash/Iterator.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/pattern/LocalSegments.h>
+#include <dash/util/Config.h>
 
 #include <dash/dart/if/dart_communication.h>
 
@@ -14,10 +16,11 @@
 #include <future>
 
 
-// #ifndef DASH__ALGORITHM__COPY__USE_WAIT
-#define DASH__ALGORITHM__COPY__USE_FLUSH
-// #define DASH__ALGORITHM__COPY__USE_WAIT
-// #endif
+// Asynchronous copy operations are completed using DART handles that
+// can be tested for completion in dash::Future::test. Define
+// DASH__ALGORITHM__COPY__USE_FLUSH to complete them by flushing the
+// accessed global pointers instead.
+// #define DASH__ALGORITHM__COPY__USE_FLUSH
 
 namespace dash {
 
@@ -103,9 +106,100 @@ namespace internal {
 // Global to Local
 // =========================================================================
 
+/**
+ * Contiguous range of elements in a global-to-local copy operation that is
+ * located at a single unit and transferred in a single operation.
+ */
+template <typename IndexType>
+struct copy_chunk
+{
+  /// Offset of the chunk's first element in the input and output range
+  IndexType offset;
+  /// Number of elements in the chunk
+  IndexType nelem;
+};
+
+/**
+ * Resolves the chunks of a global index range of a one-dimensional
+ * pattern from its local segments, ordered by unit.
+ */
+template <class PatternType>
+void copy_chunks_in_range(
+  const PatternType                                        & pattern,
+  typename PatternType::index_type                           g_begin,
+  typename PatternType::index_type                           g_end,
+  std::vector<copy_chunk<typename PatternType::index_type>> & chunks,
+  std::true_type                                             /* 1-dim */)
+{
+  for (const auto & seg : dash::local_segments(pattern, g_begin, g_end)) {
+    chunks.push_back({ seg.pos, seg.size });
+  }
+}
+
+/**
+ * Resolves the chunks of a global index range of a multidimensional
+ * pattern as the runs of elements that are contiguous in the local memory
+ * of a unit.
+ */
+template <class PatternType>
+void copy_chunks_in_range(
+  const PatternType                                        & pattern,
+  typename PatternType::index_type                           g_begin,
+  typename PatternType::index_type                           g_end,
+  std::vector<copy_chunk<typename PatternType::index_type>> & chunks,
+  std::false_type                                            /* n-dim */)
+{
+  typedef typename PatternType::index_type index_type;
+  for (index_type g = g_begin; g < g_end;) {
+    auto       l_pos = pattern.local(g);
+    index_type nelem = std::min<index_type>(
+                         pattern.local_size(l_pos.unit) - l_pos.index,
+                         g_end - g);
+    DASH_ASSERT_GT(nelem, 0, "Number of elements to copy is 0");
+    chunks.push_back({ g - g_begin, nelem });
+    g += nelem;
+  }
+}
+
+/**
+ * Maximum number of bytes of get operations in flight in a blocking
+ * global-to-local copy operation.
+ * Configured by \c DASH_COPY_MAX_INFLIGHT_SIZE, defaults to 64 MB.
+ */
+inline size_t copy_max_inflight_bytes()
+{
+  size_t bytes = dash::util::Config::get<size_t>(
+                   "DASH_COPY_MAX_INFLIGHT_SIZE_BYTES");
+  return (bytes > 0) ? bytes : (64 * 1024 * 1024);
+}
+
+/**
+ * Maximum number of bytes transferred in a single get operation of a
+ * global-to-local copy operation, larger chunks are split.
+ * Configured by \c DASH_COPY_CHUNK_SIZE, defaults to the maximum message
+ * size supported by MPI.
+ */
+inline size_t copy_max_chunk_bytes()
+{
+  size_t bytes = dash::util::Config::get<size_t>(
+                   "DASH_COPY_CHUNK_SIZE_BYTES");
+  // MPI uses offset type int, do not copy more than INT_MAX bytes:
+  size_t max_bytes = std::numeric_limits<int>::max();
+  return (bytes > 0 && bytes < max_bytes) ? bytes : max_bytes;
+}
+
 /**
  * Blocking implementation of \c dash::copy (global to local) without
  * optimization for local subrange.
+ *
+ * The input range is split into chunks of elements located at a single
+ * unit. Get operations of all chunks are posted before waiting for their
+ * completion, so the latency of transfers from different units overlaps.
+ * Chunks located at the calling unit are copied directly, chunks at units
+ * in the same shared memory domain are copied by DART without a request.
+ * Once the number of bytes in flight exceeds
+ * \c copy_max_inflight_bytes(), the older half of pending requests is
+ * completed before posting further gets.
  */
 template <
   typename ValueType,
@@ -119,9 +213,10 @@ ValueType * copy_impl(
                  "in_first:",  in_first.pos(),
                  "in_last:",   in_last.pos(),
                  "out_first:", out_first);
-  auto pattern = in_first.pattern();
-  typedef typename decltype(pattern)::index_type index_type;
-  typedef typename decltype(pattern)::size_type  size_type;
+  const auto & pattern = in_first.pattern();
+  typedef typename std::decay<decltype(pattern)>::type pattern_type;
+  typedef typename pattern_type::index_type            index_type;
+  typedef typename pattern_type::size_type             size_type;
   size_type num_elem_total = dash::distance(in_first, in_last);
   if (num_elem_total <= 0) {
     DASH_LOG_TRACE("dash::copy_impl", "input range empty");
@@ -135,115 +230,89 @@ ValueType * copy_impl(
   // Do not use in_last.global() as this would span over the relative input
   // range.
   auto g_in_first      = in_first.global();
-  auto g_in_last       = g_in_first + num_elem_total;
-  DASH_LOG_TRACE("dash::copy_impl",
-                 "g_in_first:", g_in_first.pos(),
-                 "g_in_last:",  g_in_last.pos());
-  auto unit_first      = pattern.unit_at(g_in_first.pos());
-  DASH_LOG_TRACE_VAR("dash::copy_impl", unit_first);
-  auto unit_last       = pattern.unit_at(g_in_last.pos() - 1);
-  DASH_LOG_TRACE_VAR("dash::copy_impl", unit_last);
+  index_type g_begin   = g_in_first.pos();
+  index_type g_end     = g_begin + num_elem_total;
+  DASH_LOG_TRACE("dash::copy_impl", "g_in_first:", g_begin,
+                                    "g_in_last:",  g_end);
 
-  // MPI uses offset type int, do not copy more than INT_MAX bytes:
-  size_type max_copy_elem   = (std::numeric_limits<int>::max() /
-                               sizeof(ValueType));
-  size_type num_elem_copied = 0;
-  DASH_LOG_TRACE_VAR("dash::copy_impl", max_copy_elem);
-  if (num_elem_total > max_copy_elem) {
-    DASH_LOG_DEBUG("dash::copy_impl",
-                   "cannot copy", num_elem_total, "elements",
-                   "in a single dart_get operation");
-  }
-  if (unit_first == unit_last) {
-    // Input range is located at a single remote unit:
-    DASH_LOG_TRACE("dash::copy_impl", "input range at single unit");
-    while (num_elem_copied < num_elem_total) {
-      // Number of elements left to copy:
-      auto total_elem_left = num_elem_total - num_elem_copied;
-      auto num_copy_elem   = (num_elem_total > max_copy_elem)
-                             ? max_copy_elem
-                             : num_elem_total;
-      if (num_copy_elem > total_elem_left) {
-        num_copy_elem = total_elem_left;
-      }
-      DASH_LOG_TRACE("dash::copy_impl",
-                     "copy max:",       max_copy_elem,
-                     "get elements:",   num_copy_elem,
-                     "total:",          num_elem_total,
-                     "copied:",         num_elem_copied,
-                     "left:",           total_elem_left);
-      auto cur_in_first  = g_in_first + num_elem_copied;
-      auto cur_out_first = out_first  + num_elem_copied;
-      dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
-      DASH_ASSERT_RETURNS(
-        dart_get_blocking(
-          cur_out_first,
-          cur_in_first.dart_gptr(),
-          ds.nelem,
-          ds.dtype),
-        DART_OK);
-      num_elem_copied += num_copy_elem;
+  std::vector<copy_chunk<index_type>> chunks;
+  copy_chunks_in_range(
+    pattern, g_begin, g_end, chunks,
+    std::integral_constant<bool, pattern_type::ndim() == 1>());
+  DASH_LOG_TRACE_VAR("dash::copy_impl", chunks.size());
+
+  size_type max_chunk_elem    = std::max<size_type>(
+                                  1, copy_max_chunk_bytes() /
+                                     sizeof(ValueType));
+  size_t    max_inflight      = copy_max_inflight_bytes();
+  size_t    num_inflight      = 0;
+  // Pending requests, completed requests are removed from the front:
+  std::vector<dart_handle_t> req_handles;
+  std::vector<size_t>        req_bytes;
+  size_t                     req_first = 0;
+  for (const auto & chunk : chunks) {
+    auto cur_in_first = g_in_first + chunk.offset;
+    auto l_in_first   = cur_in_first.is_local()
+                        ? cur_in_first.local()
+                        : nullptr;
+    if (l_in_first != nullptr) {
+      // Chunk is located at the calling unit:
+      std::copy(l_in_first, l_in_first + chunk.nelem,
+                out_first + chunk.offset);
+      continue;
     }
-  } else {
-    // Input range is spread over several remote units:
-    DASH_LOG_TRACE("dash::copy_impl", "input range spans multiple units");
-    //
-    // Copy elements from every unit:
-    //
-    while (num_elem_copied < num_elem_total) {
-      // Global iterator pointing at begin of current unit's input range:
-      auto cur_in_first    = g_in_first + num_elem_copied;
-      // unit and local index of first element in current range segment:
-      auto local_pos       = pattern.local(static_cast<index_type>(
-                                             cur_in_first.pos()));
-      // Number of elements located at current source unit:
-      size_type max_elem_per_unit = pattern.local_size(local_pos.unit);
-      // Local offset of first element in input range at current unit:
-      auto l_in_first_idx  = local_pos.index;
-      // Maximum number of elements to copy from current unit:
-      auto num_unit_elem   = max_elem_per_unit - l_in_first_idx;
-      // Number of elements left to copy:
-      auto total_elem_left = num_elem_total - num_elem_copied;
-      // Number of elements to copy in this iteration.
-      auto num_copy_elem   = (num_unit_elem < max_copy_elem)
-                             ? num_unit_elem
-                             : max_copy_elem;
-      if (num_copy_elem > total_elem_left) {
-        num_copy_elem = total_elem_left;
-      }
-      DASH_ASSERT_GT(num_copy_elem, 0,
-                     "Number of element to copy is 0");
+    for (index_type offset = 0; offset < chunk.nelem;) {
+      size_type num_copy_elem = std::min<size_type>(
+                                  chunk.nelem - offset, max_chunk_elem);
       DASH_LOG_TRACE("dash::copy_impl",
-                     "start g_idx:",    cur_in_first.pos(),
-                     "->",
-                     "unit:",           local_pos.unit,
-                     "l_idx:",          l_in_first_idx,
-                     "->",
-                     "unit elements:",  num_unit_elem,
-                     "max elem/unit:",  max_elem_per_unit,
-                     "copy max:",       max_copy_elem,
-                     "get elements:",   num_copy_elem,
-                     "total:",          num_elem_total,
-                     "copied:",         num_elem_copied,
-                     "left:",           total_elem_left);
-      auto dest_ptr = out_first + num_elem_copied;
-      auto src_gptr = cur_in_first.dart_gptr();
+                     "g_idx:", g_begin + chunk.offset + offset,
+                     "get elements:", num_copy_elem);
+      dart_handle_t  get_handle;
       dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
-      if (dart_get_blocking(
-            dest_ptr,
-            src_gptr,
+      if (dart_get_handle(
+            out_first + chunk.offset + offset,
+            (cur_in_first + offset).dart_gptr(),
             ds.nelem,
-            ds.dtype)
+            ds.dtype,
+            &get_handle)
           != DART_OK) {
-        DASH_LOG_ERROR("dash::copy_impl", "dart_get failed");
+        DASH_LOG_ERROR("dash::copy_impl", "dart_get_handle failed");
         DASH_THROW(
-          dash::exception::RuntimeError, "dart_get failed");
+          dash::exception::RuntimeError, "dart_get_handle failed");
+      }
+      offset += num_copy_elem;
+      if (get_handle == NULL) {
+        // Transfer already completed:
+        continue;
+      }
+      req_handles.push_back(get_handle);
+      req_bytes.push_back(num_copy_elem * sizeof(ValueType));
+      num_inflight += req_bytes.back();
+      if (num_inflight > max_inflight) {
+        // Complete the older half of pending requests:
+        size_t num_pending  = req_handles.size() - req_first;
+        size_t num_complete = (num_pending + 1) / 2;
+        DASH_LOG_TRACE("dash::copy_impl",
+                       "bytes in flight:", num_inflight,
+                       "completing requests:", num_complete);
+        DASH_ASSERT_RETURNS(
+          dart_waitall_local(req_handles.data() + req_first, num_complete),
+          DART_OK);
+        for (size_t r = req_first; r < req_first + num_complete; ++r) {
+          num_inflight -= req_bytes[r];
+        }
+        req_first += num_complete;
       }
-      num_elem_copied += num_copy_elem;
     }
   }
+  if (req_first < req_handles.size()) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall_local(req_handles.data() + req_first,
+                         req_handles.size() - req_first),
+      DART_OK);
+  }
 
-  ValueType * out_last = out_first + num_elem_copied;
+  ValueType * out_last = out_first + num_elem_total;
   DASH_LOG_TRACE_VAR("dash::copy_impl >", out_last);
   return out_last;
 }
@@ -433,6 +502,7 @@ dash::Future<ValueType *> copy_async_impl(
     DASH_LOG_TRACE("dash::copy_async_impl", "  req_handle:", gptr);
   }
 #endif
+#ifdef DASH__ALGORITHM__COPY__USE_FLUSH
   dash::Future<ValueType *> result([=]() mutable {
     // Wait for all get requests to complete:
     ValueType * _out = out_first + num_elem_copied;
@@ -440,34 +510,24 @@ dash::Future<ValueType *> copy_async_impl(
                    "  wait for", req_handles.size(), "async get request");
     DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  flush:", req_handles);
     DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  _out:", _out);
-#ifdef DASH_ENABLE_TRACE_LOGGING
-    for (auto gptr : req_handles) {
-      DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  req_handle:",
-                     gptr);
-    }
-#endif
-#ifdef DASH__ALGORITHM__COPY__USE_FLUSH
     for (auto gptr : req_handles) {
       dart_flush_local_all(gptr);
     }
-#else
-    if (req_handles.size() > 0) {
-      if (dart_waitall_local(&req_handles[0], req_handles.size())
-          != DART_OK) {
-        DASH_LOG_ERROR("dash::copy_async_impl [Future]",
-                       "  dart_waitall_local failed");
-        DASH_THROW(
-          dash::exception::RuntimeError,
-          "dash::copy_async_impl [Future]: dart_waitall_local failed");
-      }
-    } else {
-      DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  No pending handles");
-    }
-#endif
     DASH_LOG_TRACE("dash::copy_async_impl [Future] >",
                    "  async requests completed, _out:", _out);
     return _out;
   });
+#else
+  // Get requests are completed in Future::test or Future::wait:
+  ValueType * out_last = out_first + num_elem_copied;
+  dash::Future<ValueType *> result(
+    std::move(req_handles),
+    [=]() {
+      DASH_LOG_TRACE("dash::copy_async_impl [Future] >",
+                     "  async requests completed, _out:", out_last);
+      return out_last;
+    });
+#endif
   DASH_LOG_TRACE("dash::copy_async_impl >", "  returning future");
   return result;
 }
@@ -571,41 +631,34 @@ dash::Future<GlobOutputIt> copy_async_impl(
     DASH_LOG_TRACE("dash::copy_async_impl", "  req_handle:", gptr);
   }
 #endif
+#ifdef DASH__ALGORITHM__COPY__USE_FLUSH
   dash::Future<GlobOutputIt> result([=]() mutable {
-    // Wait for all get requests to complete:
+    // Wait for all put requests to complete:
     GlobOutputIt _out = out_first + num_copy_elem;
     DASH_LOG_TRACE("dash::copy_async_impl [Future]()",
                    "  wait for", req_handles.size(), "async put request");
     DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  flush:", req_handles);
     DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  _out:", _out);
-#ifdef DASH_ENABLE_TRACE_LOGGING
-    for (auto gptr : req_handles) {
-      DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  req_handle:",
-                     gptr);
-    }
-#endif
-#ifdef DASH__ALGORITHM__COPY__USE_FLUSH
     for (auto gptr : req_handles) {
       dart_flush_all(gptr);
     }
-#else
-    if (req_handles.size() > 0) {
-      if (dart_waitall(&req_handles[0], req_handles.size())
-          != DART_OK) {
-        DASH_LOG_ERROR("dash::copy_async_impl [Future]",
-                       "  dart_waitall failed");
-        DASH_THROW(
-          dash::exception::RuntimeError,
-          "dash::copy_async_impl [Future]: dart_waitall failed");
-      }
-    } else {
-      DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  No pending handles");
-    }
-#endif
     DASH_LOG_TRACE("dash::copy_async_impl [Future] >",
                    "  async requests completed, _out:", _out);
     return _out;
   });
+#else
+  // Put requests are completed locally in Future::test or Future::wait,
+  // remote completion requires a flush of the target unit:
+  GlobOutputIt out_last = out_first + num_copy_elem;
+  dash::Future<GlobOutputIt> result(
+    std::move(req_handles),
+    [=]() {
+      DASH_ASSERT_RETURNS(dart_flush(dest_gptr), DART_OK);
+      DASH_LOG_TRACE("dash::copy_async_impl [Future] >",
+                     "  async requests completed, _out:", out_last);
+      return out_last;
+    });
+#endif
   DASH_LOG_TRACE("dash::copy_async_impl >", "  returning future");
   return result;
 }
@@ -736,7 +789,7 @@ dash::Future<ValueType *> copy_async(
       auto fut_prelocal = dash::internal::copy_async_impl(g_in_first,
                                                           g_l_in_first,
                                                           dest_first);
-      futures.push_back(fut_prelocal);
+      futures.push_back(std::move(fut_prelocal));
       // Advance output pointers:
       out_last   += num_prelocal_elem;
       dest_first  = out_last;
@@ -759,7 +812,7 @@ dash::Future<ValueType *> copy_async(
       auto fut_postlocal = dash::internal::copy_async_impl(g_l_in_last,
                                                            g_in_last,
                                                            dest_first);
-      futures.push_back(fut_postlocal);
+      futures.push_back(std::move(fut_postlocal));
       out_last += num_postlocal_elem;
     }
     //
@@ -808,23 +861,33 @@ dash::Future<ValueType *> copy_async(
     auto fut_all = dash::internal::copy_async_impl(in_first,
                                                    in_last,
                                                    dest_first);
-    futures.push_back(fut_all);
+    futures.push_back(std::move(fut_all));
     out_last = out_first + total_copy_elem;
   }
   DASH_LOG_TRACE("dash::copy_async", "preparing future");
-  dash::Future<ValueType *> fut_result([=]() mutable {
-    ValueType * _out = out_last;
-    DASH_LOG_TRACE("dash::copy_async [Future]()",
-                   "wait for", futures.size(), "async copy requests");
-    DASH_LOG_TRACE("dash::copy_async [Future]", "  futures:", futures);
-    DASH_LOG_TRACE("dash::copy_async [Future]", "  _out:", _out);
-    for (auto f : futures) {
-      f.wait();
-    }
-    DASH_LOG_TRACE("dash::copy_async [Future] >", "async requests completed",
-                   "futures:", futures, "_out:", _out);
-    return _out;
-  });
+  // Futures of the partial copy operations are shared with the returned
+  // future which is ready once all partial copy operations completed:
+  auto sh_futures = std::make_shared<
+                      std::vector< dash::Future<ValueType *> > >(
+                      std::move(futures));
+  dash::Future<ValueType *> fut_result(
+    [=]() {
+      bool all_ready = true;
+      for (auto & f : *sh_futures) {
+        all_ready = f.test() && all_ready;
+      }
+      return all_ready;
+    },
+    [=]() {
+      DASH_LOG_TRACE("dash::copy_async [Future]()",
+                     "wait for", sh_futures->size(), "async copy requests");
+      for (auto & f : *sh_futures) {
+        f.wait();
+      }
+      DASH_LOG_TRACE("dash::copy_async [Future] >", "async requests completed",
+                     "_out:", out_last);
+      return out_last;
+    });
   DASH_LOG_TRACE("dash::copy_async >", "finished,",
                  "expected out_last:", out_last);
   return fut_result;
@@ -1170,37 +1233,292 @@ copy_async(
     return dash::Future< dash::LocalRange<ValueType> >(
              [=]() { return l_range; });
   }
-  auto fut_copy_end = dash::copy_async(in_first, in_last, out_first);
-  return dash::Future< dash::LocalRange<ValueType> >([=]() {
-           l_range.begin = out_first;
-           l_range.end   = fut_copy_end.get();
-           return l_range;
-         });
+  return dash::copy_async(in_first, in_last, out_first).then(
+           [=](ValueType * out_last) {
+             dash::LocalRange<ValueType> l_range;
+             l_range.begin = out_first;
+             l_range.end   = out_last;
+             return l_range;
+           });
 }
 #endif
 
+// =========================================================================
+// Global to Global
+// =========================================================================
+
+namespace internal {
+
+/**
+ * Issues the transfers of a global-to-global copy operation to the local
+ * subrange of a 1-dimensional output range.
+ * Each unit intersects its local output blocks with the blocks of the
+ * input range and fetches every intersection in a single get, or copies
+ * it directly if it is located at the unit itself.
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt >
+void copy_glob_to_glob_local(
+  GlobInputIt                  in_first,
+  GlobOutputIt                 out_first,
+  GlobOutputIt                 out_last,
+  std::vector<dart_handle_t> & req_handles,
+  std::true_type               /* 1-dimensional patterns */)
+{
+  typedef typename GlobOutputIt::value_type         value_type;
+  typedef typename GlobOutputIt::pattern_type       out_pattern_t;
+  typedef typename out_pattern_t::index_type        index_type;
+  typedef typename out_pattern_t::size_type         size_type;
+
+  // Map iterators to global index domain, see copy_impl:
+  auto   g_in_first  = in_first.global();
+  auto & in_pattern  = in_first.pattern();
+  auto & out_pattern = out_first.pattern();
+  // Global index range of the output range:
+  index_type g_out_begin = out_first.global().pos();
+  index_type g_out_end   = g_out_begin +
+                           dash::distance(out_first, out_last);
+  // Destination of local output elements:
+  value_type * l_out = out_first.globmem().lbegin();
+
+  // MPI uses offset type int, do not copy more than INT_MAX bytes:
+  size_type max_copy_elem = (std::numeric_limits<int>::max() /
+                             sizeof(value_type));
+  // Local blocks are stored contiguously in local memory in the order of
+  // their global offsets:
+  size_type  num_lblocks   = out_pattern.local_blockspec().size();
+  index_type l_block_begin = 0;
+  for (size_type lbi = 0; lbi < num_lblocks; ++lbi) {
+    auto       lblock  = out_pattern.local_block(lbi);
+    index_type b_begin = lblock.offset(0);
+    index_type b_end   = b_begin + lblock.extent(0);
+    if (b_begin >= g_out_end) {
+      break;
+    }
+    // Intersection of the local block with the output range:
+    index_type g_out   = std::max(b_begin, g_out_begin);
+    index_type g_last  = std::min(b_end,   g_out_end);
+    while (g_out < g_last) {
+      // Offset in the output range and global input index of the
+      // corresponding source element:
+      index_type offset   = g_out - g_out_begin;
+      index_type g_in     = g_in_first.pos() + offset;
+      // Number of elements until the end of the current input block,
+      // elements in a block are contiguous in local memory:
+      auto       in_block = in_pattern.block(in_pattern.block_at({{ g_in }}));
+      size_type  num_copy = std::min<size_type>({
+                              static_cast<size_type>(g_last - g_out),
+                              in_block.offset(0) + in_block.extent(0) - g_in,
+                              max_copy_elem });
+      DASH_ASSERT_GT(num_copy, 0, "Number of elements to copy is 0");
+      value_type * dest   = l_out + l_block_begin + (g_out - b_begin);
+      auto         cur_in = g_in_first + offset;
+      auto         l_in   = cur_in.is_local() ? cur_in.local() : nullptr;
+      DASH_LOG_TRACE("dash::copy_glob_to_glob_local",
+                     "g_out:",  g_out,
+                     "g_in:",   g_in,
+                     "nelem:",  num_copy,
+                     "local:",  (l_in != nullptr));
+      if (l_in != nullptr) {
+        std::copy(l_in, l_in + num_copy, dest);
+      } else {
+        dart_handle_t  get_handle;
+        dart_storage_t ds = dash::dart_storage<value_type>(num_copy);
+        DASH_ASSERT_RETURNS(
+          dart_get_handle(
+            dest,
+            cur_in.dart_gptr(),
+            ds.nelem,
+            ds.dtype,
+            &get_handle),
+          DART_OK);
+        if (get_handle != NULL) {
+          req_handles.push_back(get_handle);
+        }
+      }
+      g_out += num_copy;
+    }
+    l_block_begin += lblock.extent(0);
+  }
+}
+
+/**
+ * Issues the transfers of a global-to-global copy operation to the local
+ * elements of a multidimensional output range.
+ * Local output elements are resolved to segments that are contiguous in
+ * local memory and in the output range, every segment is split into the
+ * contiguous segments of the corresponding input elements. Each input
+ * segment is fetched in a single get, or copied directly if it is located
+ * at the unit itself.
+ * Ranges of views are copied element by element.
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt >
+void copy_glob_to_glob_local(
+  GlobInputIt                  in_first,
+  GlobOutputIt                 out_first,
+  GlobOutputIt                 out_last,
+  std::vector<dart_handle_t> & req_handles,
+  std::false_type              /* multidimensional patterns */)
+{
+  typedef typename GlobOutputIt::value_type         value_type;
+  typedef typename GlobOutputIt::pattern_type       out_pattern_t;
+  typedef typename out_pattern_t::index_type        index_type;
+  typedef typename out_pattern_t::size_type         size_type;
+
+  auto num_elem_total = dash::distance(out_first, out_last);
+  if (in_first.is_relative() || out_first.is_relative()) {
+    for (decltype(num_elem_total) i = 0; i < num_elem_total; ++i) {
+      auto cur_out = out_first + i;
+      if (!cur_out.is_local()) {
+        continue;
+      }
+      auto cur_in  = in_first + i;
+      if (cur_in.is_local()) {
+        *cur_out.local() = *cur_in.local();
+        continue;
+      }
+      dart_handle_t  get_handle;
+      dart_storage_t ds = dash::dart_storage<value_type>(1);
+      DASH_ASSERT_RETURNS(
+        dart_get_handle(
+          cur_out.local(),
+          cur_in.dart_gptr(),
+          ds.nelem,
+          ds.dtype,
+          &get_handle),
+        DART_OK);
+      if (get_handle != NULL) {
+        req_handles.push_back(get_handle);
+      }
+    }
+    return;
+  }
+
+  auto & in_pattern  = in_first.pattern();
+  auto & out_pattern = out_first.pattern();
+  auto   in_myid     = in_pattern.team().myid();
+  // Global index range of the output range:
+  index_type g_out_begin = out_first.pos();
+  index_type g_out_end   = g_out_begin + num_elem_total;
+  // Destination of local output elements:
+  value_type * l_out = out_first.globmem().lbegin();
+  // Source of local input elements:
+  value_type * l_in  = in_first.globmem().lbegin();
+
+  // MPI uses offset type int, do not copy more than INT_MAX bytes:
+  size_type max_copy_elem = (std::numeric_limits<int>::max() /
+                             sizeof(value_type));
+  for (const auto & out_seg : dash::unit_local_segments(
+                                out_pattern, g_out_begin, g_out_end)) {
+    index_type g_in = in_first.pos() + out_seg.pos;
+    for (const auto & in_seg : dash::local_segments(
+                                 in_pattern, g_in, g_in + out_seg.size)) {
+      value_type * dest = l_out + out_seg.lindex + in_seg.pos;
+      DASH_LOG_TRACE("dash::copy_glob_to_glob_local",
+                     "g_in:",   in_seg.gindex,
+                     "unit:",   in_seg.unit,
+                     "nelem:",  in_seg.size);
+      if (in_seg.unit == in_myid) {
+        std::copy(l_in + in_seg.lindex,
+                  l_in + in_seg.lindex + in_seg.size,
+                  dest);
+        continue;
+      }
+      for (index_type done = 0; done < in_seg.size;) {
+        size_type num_copy = std::min<size_type>(
+                               in_seg.size - done, max_copy_elem);
+        auto      cur_in   = in_first + (out_seg.pos + in_seg.pos + done);
+        dart_handle_t  get_handle;
+        dart_storage_t ds = dash::dart_storage<value_type>(num_copy);
+        DASH_ASSERT_RETURNS(
+          dart_get_handle(
+            dest + done,
+            cur_in.dart_gptr(),
+            ds.nelem,
+            ds.dtype,
+            &get_handle),
+          DART_OK);
+        if (get_handle != NULL) {
+          req_handles.push_back(get_handle);
+        }
+        done += num_copy;
+      }
+    }
+  }
+}
+
+} // namespace internal
+
+/**
+ * Variant of \c dash::copy as asynchronous global-to-global copy
+ * operation.
+ *
+ * Collaborative operation: every unit copies the elements of its local
+ * subrange of the output range only, source and destination may be
+ * distributed by different patterns.
+ * As in \c dash::fill, synchronize the output container's team before
+ * accessing remote elements of the output range.
+ *
+ * \returns  A future providing the iterator to the end of the output
+ *           range.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ValueType = void,
+  class    GlobInputIt,
+  class    GlobOutputIt >
+dash::Future<GlobOutputIt> copy_async(
+  GlobInputIt   in_first,
+  GlobInputIt   in_last,
+  GlobOutputIt  out_first)
+{
+  typedef typename GlobInputIt::pattern_type        in_pattern_t;
+  typedef typename GlobOutputIt::pattern_type       out_pattern_t;
+
+  DASH_LOG_TRACE("dash::copy_async()", "async, global to global");
+  auto         num_elem_total = dash::distance(in_first, in_last);
+  GlobOutputIt out_last       = out_first + num_elem_total;
+  if (num_elem_total <= 0) {
+    DASH_LOG_TRACE("dash::copy_async", "input range empty");
+    return dash::Future<GlobOutputIt>([=]() { return out_last; });
+  }
+  std::vector<dart_handle_t> req_handles;
+  dash::internal::copy_glob_to_glob_local(
+    in_first, out_first, out_last, req_handles,
+    std::integral_constant<
+      bool, in_pattern_t::ndim() == 1 && out_pattern_t::ndim() == 1>());
+  DASH_LOG_TRACE("dash::copy_async >", "pending gets:", req_handles.size());
+  return dash::Future<GlobOutputIt>(
+           std::move(req_handles),
+           [=]() { return out_last; });
+}
+
 /**
  * Specialization of \c dash::copy as global-to-global blocking copy
  * operation.
  *
+ * Collaborative operation, every unit copies the elements of its local
+ * subrange of the output range.
+ *
+ * \see      dash::copy_async
+ *
  * \ingroup  DashAlgorithms
  */
 template <
-  typename ValueType,
-  class GlobInputIt,
-  class GlobOutputIt >
+  typename ValueType = void,
+  class    GlobInputIt,
+  class    GlobOutputIt >
 GlobOutputIt copy(
   GlobInputIt   in_first,
   GlobInputIt   in_last,
   GlobOutputIt  out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
-
-  // TODO:
-  // - Implement adapter for local-to-global dash::copy here
-  // - Return if global input range has no local sub-range
-
-  return GlobOutputIt();
+  return dash::copy_async(in_first, in_last, out_first).get();
 }
 
 #endif // DOXYGEN
@@ -7,18 +7,53 @@
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
-
-#include <dash/util/UnitLocality.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 #include <dash/dart/if/dart_communication.h>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <algorithm>
+#include <type_traits>
 
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Assigns a value to elements \c [begin, end) of a local range of DART
+ * basic type elements in a vectorized loop.
+ */
+template <typename ValueType>
+inline void fill_local_block(
+  ValueType        * lfirst,
+  size_t             begin,
+  size_t             end,
+  const ValueType  & value,
+  std::true_type     /* is_basic_type */)
+{
+  const ValueType v = value;
+  DASH__PRAGMA_SIMD
+  for (size_t i = begin; i < end; ++i) {
+    lfirst[i] = v;
+  }
+}
+
+/**
+ * Assigns a value to elements \c [begin, end) of a local range.
+ */
+template <typename ValueType>
+inline void fill_local_block(
+  ValueType        * lfirst,
+  size_t             begin,
+  size_t             end,
+  const ValueType  & value,
+  std::false_type    /* is_basic_type */)
+{
+  std::fill(lfirst + begin, lfirst + end, value);
+}
+
+} // namespace internal
+
 /**
  * Assigns the given value to the elements in the range [first, last)
  *
@@ -40,42 +75,25 @@ void fill(
   /// Value which will be assigned to the elements in range [first, last)
   const typename GlobIterType::value_type & value)
 {
-  typedef typename GlobIterType::index_type index_t;
   typedef typename GlobIterType::value_type value_t;
 
   // Global iterators to local range:
   auto      index_range = dash::local_range(first, last);
   value_t * lfirst      = index_range.begin;
   value_t * llast       = index_range.end;
-  auto      nlocal      = llast - lfirst;
-
-#if 0
-  for (index_t lt = 0; lt < nlocal; lt++) {
-    lfirst[lt] = value;
-  }
-#else
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::fill", "thread capacity:",  n_threads);
-  #pragma omp parallel num_threads(n_threads)
-  for (index_t lt = 0; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
+  size_t    nlocal      = llast - lfirst;
 
-  #pragma omp parallel num_threads(n_threads)
-  for (index_t lt = 1; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-#else
-  for (index_t lt = 0; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-  for (index_t lt = 1; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-#endif
-#endif
+  typedef std::integral_constant<
+            bool,
+            dash::dart_datatype<value_t>::value != DART_TYPE_UNDEFINED>
+    is_basic_type;
+  dash::internal::parallel_for_static(
+    nlocal,
+    std::max<size_t>(DASH__ARCH__CACHE_LINE_SIZE / sizeof(value_t), 1),
+    [&](size_t begin, size_t end) {
+      dash::internal::fill_local_block(lfirst, begin, end, value,
+                                       is_basic_type());
+    });
 }
 
 } // namespace dash
@@ -4,6 +4,7 @@
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 #include <dash/dart/if/dart_communication.h>
 
@@ -54,7 +55,10 @@ void generate (
  * a global index.
  *
  * Being a collaborative operation, each unit will invoke the given
- * function on its local elements only.
+ * function on its local elements only, in the order of their local
+ * indices.
+ *
+ * \see dash::generate_with_index_parallel
  *
  * \tparam      ElementType    Type of the elements in the sequence
  *                             invoke, deduced from parameter \c gen
@@ -85,18 +89,71 @@ void generate_with_index(
   if (lbegin_index != lend_index) {
     // Pattern from global begin iterator:
     auto & pattern    = first.pattern();
-    auto first_offset = first.pos();
+    // Native pointer to first element in local range:
+    auto   lfirst     = first.globmem().lbegin() + lbegin_index;
     // Iterate local index range:
     for (auto lindex = lbegin_index;
          lindex != lend_index;
          ++lindex) {
-      auto gindex     = pattern.global(lindex);
-      auto element_it = first + (gindex - first_offset);
-      *element_it = gen(gindex);
+      *lfirst++ = gen(pattern.global(lindex));
     }
   }
 }
 
+/**
+ * Assigns each element in range [first, last) a value generated by the
+ * given function object g. The index passed to the function is
+ * a global index.
+ *
+ * Like \c dash::generate_with_index, but the local elements are
+ * statically partitioned among the threads of the unit. The function
+ * is invoked concurrently by multiple threads and in arbitrary order of
+ * indices, so it must not depend on state shared between invocations.
+ *
+ * \tparam      ElementType    Type of the elements in the sequence
+ *                             invoke, deduced from parameter \c gen
+ * \tparam      UnaryFunction  Thread-safe unary function with signature
+ *                             \c ElementType(index_t)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    typename ElementType,
+    class    PatternType,
+    class    UnaryFunction >
+void generate_with_index_parallel(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Generator function
+  UnaryFunction                      gen) {
+  /// Global iterators to local index range:
+  auto index_range  = dash::local_index_range(first, last);
+  auto lbegin_index = index_range.begin;
+  auto lend_index   = index_range.end;
+
+  if (lbegin_index != lend_index) {
+    // Pattern from global begin iterator:
+    auto & pattern    = first.pattern();
+    // Native pointer to first element in local range:
+    auto   lfirst     = first.globmem().lbegin() + lbegin_index;
+    // Iterate local index range:
+    dash::internal::parallel_for_static(
+      lend_index - lbegin_index,
+      std::max<size_t>(
+        DASH__ARCH__CACHE_LINE_SIZE / sizeof(ElementType), 1),
+      [&](size_t begin, size_t end) {
+        for (auto l = begin; l < end; ++l) {
+          lfirst[l] = gen(pattern.global(lbegin_index + l));
+        }
+      });
+  }
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__GENERATE_H__
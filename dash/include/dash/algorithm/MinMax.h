@@ -4,6 +4,7 @@
 #include <dash/internal/Config.h>
 
 #include <dash/Allocator.h>
+#include <dash/Future.h>
 
 #include <dash/algorithm/LocalRange.h>
 
@@ -16,6 +17,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 
 #ifdef DASH_ENABLE_OPENMP
 #include <omp.h>
@@ -132,18 +134,18 @@ const ElementType * min_element(
 }
 
 /**
- * Finds an iterator pointing to the element with the smallest value in
- * the range [first,last).
- *
- * \return      An iterator to the first occurrence of the smallest value
- *              in the range, or \c last if the range is empty.
+ * Asynchronous variant of \c dash::min_element.
+ * Finds the local minimum immediately and exchanges local minima in a
+ * non-blocking collective, the global minimum is determined once the
+ * returned future is ready.
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
  *
- * \tparam      ElementType  Type of the elements in the sequence
- * \tparam      Compare      Binary comparison function with signature
- *                           \c bool (const TypeA &a, const TypeB &b)
+ * \return      A future providing an iterator to the first occurrence of
+ *              the smallest value in the range, or \c last if the range
+ *              is empty.
  *
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \see         dash::min_element
  *
  * \ingroup     DashAlgorithms
  */
@@ -151,7 +153,7 @@ template <
   class ElementType,
   class PatternType,
   class Compare = std::less<const ElementType &> >
-GlobIter<ElementType, PatternType> min_element(
+dash::Future< GlobIter<ElementType, PatternType> > min_element_async(
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
@@ -164,12 +166,13 @@ GlobIter<ElementType, PatternType> min_element(
   typedef PatternType                               pattern_t;
   typedef typename pattern_t::index_type              index_t;
   typedef typename std::decay<ElementType>::type      value_t;
+  typedef dash::Future<globiter_t>                   future_t;
 
   // return last for empty array
   if (first == last) {
-    DASH_LOG_DEBUG("dash::min_element >",
+    DASH_LOG_DEBUG("dash::min_element_async >",
                    "empty range, returning last", last);
-    return last;
+    return future_t([=]() { return last; });
   }
 
   dash::util::Trace trace("min_element");
@@ -211,19 +214,14 @@ GlobIter<ElementType, PatternType> min_element(
   }
   DASH_LOG_TRACE("dash::min_element",
                  "local index of local minimum:", l_idx_lmin);
-  DASH_LOG_TRACE("dash::min_element",
-                 "waiting for local min of other units");
-
-  trace.enter_state("barrier");
-  team.barrier();
-  trace.exit_state("barrier");
-
   typedef struct {
     value_t  value;
     index_t  g_index;
   } local_min_t;
 
-  std::vector<local_min_t> local_min_values(team.size());
+  // Receive buffer must remain valid until completion of the allgather:
+  auto local_min_values = std::make_shared<std::vector<local_min_t>>(
+                            team.size());
 
   // Set global index of local minimum to -1 if no local minimum has been
   // found:
@@ -239,65 +237,108 @@ GlobIter<ElementType, PatternType> min_element(
                  "value:",   local_min.value,
                  "g.index:", local_min.g_index, "}");
 
-  DASH_LOG_TRACE("dash::min_element", "dart_allgather()");
-  trace.enter_state("allgather");
+  // Local minimum is copied into the receive buffer so the send buffer
+  // does not have to outlive this call:
+  (*local_min_values)[team.myid()] = local_min;
+
+  DASH_LOG_TRACE("dash::min_element", "dart_iallgather()");
+  dart_handle_t handle;
   DASH_ASSERT_RETURNS(
-    dart_allgather(
-      &local_min,
-      local_min_values.data(),
+    dart_iallgather(
+      local_min_values->data(),
+      local_min_values->data(),
       sizeof(local_min_t),
       DART_TYPE_BYTE,
-      team.dart_id()),
+      team.dart_id(),
+      &handle),
     DART_OK);
-  trace.exit_state("allgather");
 
+  // Resolves the global minimum from the gathered local minima:
+  auto global_min = [=]() -> globiter_t {
 #ifdef DASH_ENABLE_LOGGING
-  for (int lmin_u = 0; lmin_u < local_min_values.size(); lmin_u++) {
-    auto lmin_entry = local_min_values[lmin_u];
-    DASH_LOG_TRACE("dash::min_element", "dart_allgather >",
-                   "unit:",    lmin_u,
-                   "value:",   lmin_entry.value,
-                   "g_index:", lmin_entry.g_index);
-  }
+    for (int lmin_u = 0; lmin_u < local_min_values->size(); lmin_u++) {
+      auto lmin_entry = (*local_min_values)[lmin_u];
+      DASH_LOG_TRACE("dash::min_element", "dart_allgather >",
+                     "unit:",    lmin_u,
+                     "value:",   lmin_entry.value,
+                     "g_index:", lmin_entry.g_index);
+    }
 #endif
 
-  auto gmin_elem_it  = ::std::min_element(
-                           local_min_values.begin(),
-                           local_min_values.end(),
-                           [&](const local_min_t & a,
-                               const local_min_t & b) {
-                             // Ignore elements with global index -1 (no
-                             // element found):
-                             return (b.g_index < 0 ||
-                                     (a.g_index > 0 &&
-                                      compare(a.value, b.value)));
-                           });
-
-  if (gmin_elem_it == local_min_values.end()) {
-    DASH_LOG_DEBUG_VAR("dash::min_element >", last);
-    return last;
-  }
+    auto gmin_elem_it  = ::std::min_element(
+                             local_min_values->begin(),
+                             local_min_values->end(),
+                             [&](const local_min_t & a,
+                                 const local_min_t & b) {
+                               // Ignore elements with global index -1 (no
+                               // element found):
+                               return (b.g_index < 0 ||
+                                       (a.g_index >= 0 &&
+                                        compare(a.value, b.value)));
+                             });
+
+    if (gmin_elem_it == local_min_values->end()) {
+      DASH_LOG_DEBUG_VAR("dash::min_element >", last);
+      return last;
+    }
 
-  auto gi_minimum    = gmin_elem_it->g_index;
+    auto gi_minimum    = gmin_elem_it->g_index;
 
-  DASH_LOG_TRACE("dash::min_element",
-                 "min. value:", gmin_elem_it->value,
-                 "at unit:",    (gmin_elem_it - local_min_values.begin()),
-                 "global idx:", gi_minimum);
-
-  DASH_LOG_TRACE_VAR("dash::min_element", gi_minimum);
-  if (gi_minimum < 0 || gi_minimum == gi_last) {
-    DASH_LOG_DEBUG_VAR("dash::min_element >", last);
-    return last;
-  }
-  // iterator 'first' is relative to start of input range, convert to start
-  // of its referenced container (= container.begin()), then apply global
-  // offset of minimum element:
-  globiter_t minimum = (first - first.gpos()) + gi_minimum;
-  DASH_LOG_DEBUG("dash::min_element >", minimum,
-                 "=", static_cast<ElementType>(*minimum));
-
-  return minimum;
+    DASH_LOG_TRACE("dash::min_element",
+                   "min. value:", gmin_elem_it->value,
+                   "at unit:",
+                   (gmin_elem_it - local_min_values->begin()),
+                   "global idx:", gi_minimum);
+
+    DASH_LOG_TRACE_VAR("dash::min_element", gi_minimum);
+    if (gi_minimum < 0 || gi_minimum == gi_last) {
+      DASH_LOG_DEBUG_VAR("dash::min_element >", last);
+      return last;
+    }
+    // iterator 'first' is relative to start of input range, convert to start
+    // of its referenced container (= container.begin()), then apply global
+    // offset of minimum element:
+    globiter_t minimum = (first - first.gpos()) + gi_minimum;
+    DASH_LOG_DEBUG("dash::min_element >", minimum,
+                   "=", static_cast<ElementType>(*minimum));
+
+    return minimum;
+  };
+
+  std::vector<dart_handle_t> handles { handle };
+  return future_t(std::move(handles), global_min);
+}
+
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last).
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary comparison function with signature
+ *                           \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class Compare = std::less<const ElementType &> >
+GlobIter<ElementType, PatternType> min_element(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare
+    = std::less<const ElementType &>())
+{
+  return dash::min_element_async(first, last, compare).get();
 }
 
 /**
@@ -333,6 +374,34 @@ GlobIter<ElementType, PatternType> max_element(
   return dash::min_element(first, last, compare);
 }
 
+/**
+ * Asynchronous variant of \c dash::max_element.
+ *
+ * \return      A future providing an iterator to the first occurrence of
+ *              the greatest value in the range, or \c last if the range
+ *              is empty.
+ *
+ * \see         dash::min_element_async
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class Compare = std::greater<const ElementType &> >
+dash::Future< GlobIter<ElementType, PatternType> > max_element_async(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::greater
+  Compare                                    compare
+    = std::greater<const ElementType &>())
+{
+  // Same as min_element_async with different compare function
+  return dash::min_element_async(first, last, compare);
+}
+
 /**
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
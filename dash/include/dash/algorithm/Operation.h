@@ -7,6 +7,7 @@
 #include <dash/dart/if/dart_types.h>
 
 #include <functional>
+#include <type_traits>
 
 
 /**
@@ -184,6 +185,43 @@ struct bit_xor
   }
 };
 
+namespace internal {
+
+/**
+ * Whether applying the operation \c BinaryOperation to elements of type
+ * \c ValueType is free of side effects and can be executed in vectorized
+ * loops.
+ * Satisfied by the arithmetic and bitwise reduce operations on DART basic
+ * types.
+ *
+ * \ingroup  DashReduceOperations
+ */
+template <
+  class    BinaryOperation,
+  typename ValueType = typename BinaryOperation::value_type >
+struct is_simd_operation
+: public std::false_type { };
+
+#define DASH__DEFINE_SIMD_OPERATION(Operation)                             \
+  template <typename ValueType>                                          \
+  struct is_simd_operation<Operation<ValueType>, ValueType>              \
+  : public std::integral_constant<                                       \
+      bool,                                                              \
+      dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED> { };
+
+DASH__DEFINE_SIMD_OPERATION(dash::min)
+DASH__DEFINE_SIMD_OPERATION(dash::max)
+DASH__DEFINE_SIMD_OPERATION(dash::plus)
+DASH__DEFINE_SIMD_OPERATION(dash::multiply)
+DASH__DEFINE_SIMD_OPERATION(dash::second)
+DASH__DEFINE_SIMD_OPERATION(dash::bit_and)
+DASH__DEFINE_SIMD_OPERATION(dash::bit_or)
+DASH__DEFINE_SIMD_OPERATION(dash::bit_xor)
+
+#undef DASH__DEFINE_SIMD_OPERATION
+
+} // namespace internal
+
 }  // namespace dash
 
 #endif // DASH__ALGORITHM__OPERATION_H__
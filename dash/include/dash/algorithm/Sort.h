@@ -0,0 +1,401 @@
+#ifndef DASH__ALGORITHM__SORT_H__
+#define DASH__ALGORITHM__SORT_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Merges the consecutive sorted runs in \c [first, first + bounds.back())
+ * with run \c i in \c [first + bounds[i], first + bounds[i+1]) in
+ * \c log2(runs) rounds of pairwise merges.
+ */
+template <
+  class ValueType,
+  class Compare >
+void sort_merge_runs(
+  ValueType                 * first,
+  const std::vector<size_t> & bounds,
+  Compare                     compare,
+  int                         n_threads = 1)
+{
+  int n_runs = static_cast<int>(bounds.size()) - 1;
+  for (int step = 1; step < n_runs; step *= 2) {
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for num_threads(n_threads) schedule(dynamic)
+#endif
+    for (int r = 0; r < n_runs; r += 2 * step) {
+      if (r + step < n_runs) {
+        std::inplace_merge(
+          first + bounds[r],
+          first + bounds[r + step],
+          first + bounds[std::min(r + 2 * step, n_runs)],
+          compare);
+      }
+    }
+  }
+}
+
+/**
+ * Sorts the local range \c [first, last). Sorts partitions of the range
+ * in parallel and merges them if OpenMP is enabled and the range is large
+ * enough, otherwise delegates to \c std::sort.
+ */
+template <
+  class ValueType,
+  class Compare >
+void sort_local(
+  ValueType * first,
+  ValueType * last,
+  Compare     compare)
+{
+#ifdef DASH_ENABLE_OPENMP
+  // Minimum number of elements per thread to amortize the merge phase:
+  const size_t min_elem_per_thread = 1 << 14;
+
+  dash::util::UnitLocality uloc;
+  int    n_threads = uloc.num_domain_threads();
+  size_t n_elem    = std::distance(first, last);
+  if (n_threads > 1 && n_elem >= n_threads * min_elem_per_thread) {
+    DASH_LOG_DEBUG("dash::sort", "local sort, threads:", n_threads);
+    std::vector<size_t> bounds(n_threads + 1);
+    for (int t = 0; t <= n_threads; ++t) {
+      bounds[t] = (n_elem * t) / n_threads;
+    }
+    #pragma omp parallel for num_threads(n_threads) schedule(static)
+    for (int t = 0; t < n_threads; ++t) {
+      std::sort(first + bounds[t], first + bounds[t + 1], compare);
+    }
+    sort_merge_runs(first, bounds, compare, n_threads);
+    return;
+  }
+#endif // DASH_ENABLE_OPENMP
+  std::sort(first, last, compare);
+}
+
+/**
+ * Splitter key of the sample sort. Ties of equal values are broken by the
+ * position of the sampled element so that partitions are balanced even
+ * for input ranges with many duplicate values.
+ */
+template <class ValueType>
+struct sort_sample {
+  ValueType value;
+  size_t    unit;
+  size_t    index;
+};
+
+} // namespace internal
+
+/**
+ * Sorts the elements in the range \c [first, last) in non-descending
+ * order using the comparison function \c compare.
+ *
+ * Collective operation, implemented as a sample sort:
+ *
+ * 1. Every unit sorts its local elements in the range, using all threads
+ *    of its locality domain if OpenMP is enabled.
+ * 2. Every unit contributes regular samples of its sorted local elements;
+ *    the samples of all units determine a splitter for every unit.
+ * 3. The local elements are partitioned by the splitters and every
+ *    partition is written to its receiving unit in a single one-sided
+ *    transfer.
+ * 4. Every unit merges the sorted runs it received and writes them to
+ *    their final position in the range.
+ *
+ * The elements remain distributed according to the pattern of the range,
+ * independent of its distribution scheme.
+ * The sort is not stable.
+ *
+ * \complexity  O(nl log n) local work with \c nl local elements,
+ *              O(P^2) samples and partition sizes for \c P units
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class GlobRandomIt,
+  class Compare >
+void sort(
+  /// Iterator to the initial position in the sequence
+  GlobRandomIt first,
+  /// Iterator to the final position in the sequence
+  GlobRandomIt last,
+  /// Element comparison function
+  Compare      compare)
+{
+  typedef typename GlobRandomIt::value_type          value_t;
+  typedef dash::internal::sort_sample<value_t>       sample_t;
+
+  static_assert(std::is_trivially_copyable<value_t>::value,
+                "dash::sort requires a trivially copyable element type");
+
+  if (first >= last) {
+    return;
+  }
+
+  auto & team      = first.team();
+  auto   myid      = static_cast<size_t>(team.myid());
+  auto   nunits    = team.size();
+  auto   l_range   = dash::local_range(first, last);
+  auto   l_first   = l_range.begin;
+  auto   l_last    = l_range.end;
+  size_t l_size    = std::distance(l_first, l_last);
+
+  DASH_LOG_DEBUG("dash::sort()", "local elements:", l_size);
+
+  // Phase 1: local sort
+  dash::internal::sort_local(l_first, l_last, compare);
+
+  if (nunits == 1) {
+    return;
+  }
+
+  // Phase 2: regular sampling and splitter selection
+  //
+  // Every unit contributes nunits samples, which bounds the number of
+  // elements received by any unit to 2 * n / nunits.
+  size_t num_samples = nunits;
+  std::vector<sample_t> l_samples(num_samples);
+  for (size_t s = 0; s < num_samples; ++s) {
+    sample_t & sample = l_samples[s];
+    sample.unit  = myid;
+    sample.index = (l_size == 0)
+                   ? std::numeric_limits<size_t>::max()
+                   : (s * l_size) / num_samples;
+    if (l_size > 0) {
+      sample.value = l_first[sample.index];
+    }
+  }
+  std::vector<sample_t> samples(num_samples * nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      l_samples.data(),
+      samples.data(),
+      num_samples * sizeof(sample_t),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+  // Samples of units without local elements are ignored:
+  samples.erase(
+    std::remove_if(samples.begin(), samples.end(),
+                   [](const sample_t & s) {
+                     return s.index == std::numeric_limits<size_t>::max();
+                   }),
+    samples.end());
+
+  auto sample_less = [&](const sample_t & a, const sample_t & b) {
+                       if (compare(a.value, b.value)) { return true;  }
+                       if (compare(b.value, a.value)) { return false; }
+                       return (a.unit < b.unit) ||
+                              (a.unit == b.unit && a.index < b.index);
+                     };
+  std::sort(samples.begin(), samples.end(), sample_less);
+
+  // Phase 3: partition local elements by splitters
+  //
+  // Partition u receives all elements not less than splitter u-1 and less
+  // than splitter u. As local elements are sorted and ties are ordered by
+  // local index, partition bounds are found by binary search.
+  std::vector<size_t> l_part_bounds(nunits + 1, 0);
+  l_part_bounds[nunits] = l_size;
+  for (size_t u = 1; u < nunits; ++u) {
+    if (samples.empty()) {
+      l_part_bounds[u] = l_size;
+      continue;
+    }
+    const sample_t & splitter = samples[(u * samples.size()) / nunits];
+    size_t lo = l_part_bounds[u - 1];
+    size_t hi = l_size;
+    while (lo < hi) {
+      size_t   mid = lo + (hi - lo) / 2;
+      sample_t key;
+      key.value = l_first[mid];
+      key.unit  = myid;
+      key.index = mid;
+      if (sample_less(key, splitter)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    l_part_bounds[u] = lo;
+  }
+
+  // Partition sizes of all units, part_sizes[src * nunits + dst]:
+  std::vector<size_t> l_part_sizes(nunits);
+  for (size_t u = 0; u < nunits; ++u) {
+    l_part_sizes[u] = l_part_bounds[u + 1] - l_part_bounds[u];
+  }
+  std::vector<size_t> part_sizes(nunits * nunits);
+  dart_storage_t ds_sizes = dash::dart_storage<size_t>(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      l_part_sizes.data(),
+      part_sizes.data(),
+      ds_sizes.nelem,
+      ds_sizes.dtype,
+      team.dart_id()),
+    DART_OK);
+
+  // Number of elements received by every unit and offset of this unit's
+  // partitions in the receive buffers:
+  std::vector<size_t> recv_sizes(nunits, 0);
+  std::vector<size_t> send_offsets(nunits, 0);
+  for (size_t src = 0; src < nunits; ++src) {
+    for (size_t dst = 0; dst < nunits; ++dst) {
+      if (src == myid) {
+        send_offsets[dst] = recv_sizes[dst];
+      }
+      recv_sizes[dst] += part_sizes[src * nunits + dst];
+    }
+  }
+  size_t max_recv = *std::max_element(recv_sizes.begin(), recv_sizes.end());
+  DASH_LOG_DEBUG("dash::sort()", "receive elements:", recv_sizes[myid],
+                 "max:", max_recv);
+
+  // Phase 4: exchange partitions
+  dart_gptr_t recv_gptr;
+  DASH_ASSERT_RETURNS(
+    dart_team_memalloc_aligned(
+      team.dart_id(),
+      dash::dart_storage<value_t>(max_recv).nelem,
+      dash::dart_storage<value_t>(max_recv).dtype,
+      &recv_gptr),
+    DART_OK);
+  dart_gptr_t recv_lgptr = recv_gptr;
+  DASH_ASSERT_RETURNS(
+    dart_gptr_setunit(&recv_lgptr, team.myid()),
+    DART_OK);
+  void * recv_addr;
+  DASH_ASSERT_RETURNS(
+    dart_gptr_getaddr(recv_lgptr, &recv_addr),
+    DART_OK);
+  value_t * recv_buf = static_cast<value_t *>(recv_addr);
+
+  for (size_t dst = 0; dst < nunits; ++dst) {
+    size_t nelem = l_part_sizes[dst];
+    if (nelem == 0) {
+      continue;
+    }
+    const value_t * src = l_first + l_part_bounds[dst];
+    if (dst == myid) {
+      std::copy(src, src + nelem, recv_buf + send_offsets[dst]);
+      continue;
+    }
+    dart_gptr_t dst_gptr = recv_gptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_setunit(&dst_gptr, team_unit_t(dst)),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&dst_gptr, send_offsets[dst] * sizeof(value_t)),
+      DART_OK);
+    dart_storage_t ds = dash::dart_storage<value_t>(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_put(dst_gptr, src, ds.nelem, ds.dtype),
+      DART_OK);
+  }
+  DASH_ASSERT_RETURNS(dart_flush_all(recv_gptr), DART_OK);
+  team.barrier();
+
+  // Phase 5: merge received runs
+  size_t recv_size = recv_sizes[myid];
+  std::vector<size_t> run_bounds(nunits + 1, 0);
+  for (size_t src = 0; src < nunits; ++src) {
+    run_bounds[src + 1] = run_bounds[src]
+                          + part_sizes[src * nunits + myid];
+  }
+  dash::internal::sort_merge_runs(recv_buf, run_bounds, compare);
+
+  // Phase 6: write merged elements to their final position in the range
+  //
+  // Elements received by this unit follow the elements received by all
+  // preceding units in the sorted sequence.
+  size_t g_offset = 0;
+  for (size_t u = 0; u < myid; ++u) {
+    g_offset += recv_sizes[u];
+  }
+  const auto & pattern = first.pattern();
+  auto g_first         = first.pos() + g_offset;
+  size_t r = 0;
+  while (r < recv_size) {
+    // Find maximal run of output positions that are contiguous in the
+    // memory of a single unit:
+    auto   g_idx      = g_first + r;
+    auto   l_pos      = pattern.local(g_idx);
+    size_t run_length = 1;
+    while (r + run_length < recv_size) {
+      auto l_pos_next = pattern.local(g_idx + run_length);
+      if (l_pos_next.unit != l_pos.unit ||
+          l_pos_next.index != l_pos.index +
+                                static_cast<decltype(l_pos.index)>(
+                                  run_length)) {
+        break;
+      }
+      ++run_length;
+    }
+    auto out_it = first + (g_offset + r);
+    if (l_pos.unit == team.myid()) {
+      std::copy(recv_buf + r, recv_buf + r + run_length, out_it.local());
+    } else {
+      dart_storage_t ds = dash::dart_storage<value_t>(run_length);
+      DASH_ASSERT_RETURNS(
+        dart_put(out_it.dart_gptr(), recv_buf + r, ds.nelem, ds.dtype),
+        DART_OK);
+    }
+    r += run_length;
+  }
+  DASH_ASSERT_RETURNS(dart_flush_all(first.dart_gptr()), DART_OK);
+  team.barrier();
+
+  DASH_ASSERT_RETURNS(dart_team_memfree(recv_gptr), DART_OK);
+}
+
+/**
+ * Sorts the elements in the range \c [first, last) in non-descending
+ * order using \c operator<.
+ *
+ * \see dash::sort
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <class GlobRandomIt>
+void sort(
+  /// Iterator to the initial position in the sequence
+  GlobRandomIt first,
+  /// Iterator to the final position in the sequence
+  GlobRandomIt last)
+{
+  typedef typename GlobRandomIt::value_type value_t;
+  dash::sort(first, last, std::less<value_t>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SORT_H__
@@ -7,29 +7,30 @@
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 #include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 #include <dash/iterator/GlobIter.h>
 
+#include <dash/pattern/LocalSegments.h>
+
 #include <dash/internal/Config.h>
 #include <dash/util/Trace.h>
 
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
 #include <iterator>
-
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <type_traits>
 
 namespace dash {
 
 namespace internal {
 
 /**
- * Wrapper of the blocking DART accumulate operation.
+ * Wrapper of the non-blocking DART accumulate operation.
  */
 template< typename ValueType >
-inline dart_ret_t transform_blocking_impl(
+dart_ret_t transform_impl(
   dart_gptr_t        dest,
   ValueType        * values,
   size_t             nvalues,
@@ -44,31 +45,132 @@ inline dart_ret_t transform_blocking_impl(
                         nvalues,
                         dash::dart_datatype<ValueType>::value,
                         op);
-  dart_flush(dest);
+  dart_flush_local(dest);
   return result;
 }
 
 /**
- * Wrapper of the non-blocking DART accumulate operation.
+ * Accumulates values in a local range to the global range starting at
+ * \c out_first.
+ * The output range is split into its contiguous segments in the local
+ * memory of units, values are accumulated to every segment in a single
+ * operation. Operations on the same unit are completed by a single flush.
  */
-template< typename ValueType >
-dart_ret_t transform_impl(
-  dart_gptr_t        dest,
-  ValueType        * values,
+template<
+  typename ValueType,
+  class GlobOutputIt >
+void transform_segments_impl(
+  const ValueType  * values,
   size_t             nvalues,
+  GlobOutputIt       out_first,
   dart_operation_t   op)
 {
   static_assert(dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED,
       "Cannot accumulate unknown type!");
+  typedef typename GlobOutputIt::index_type index_t;
 
-  dart_ret_t result = dart_accumulate(
-                        dest,
-                        reinterpret_cast<void *>(values),
-                        nvalues,
-                        dash::dart_datatype<ValueType>::value,
-                        op);
-  dart_flush_local(dest);
-  return result;
+  if (nvalues == 0) {
+    return;
+  }
+  const auto & pattern  = out_first.pattern();
+  index_t      g_begin  = out_first.pos();
+  auto         segments = dash::local_segments(
+                            pattern,
+                            g_begin,
+                            g_begin + static_cast<index_t>(nvalues));
+  DASH_LOG_TRACE("dash::transform", "output segments:", segments.size());
+  for (size_t s = 0; s < segments.size(); ++s) {
+    const auto & seg  = segments[s];
+    dart_gptr_t  gptr = (out_first + seg.pos).dart_gptr();
+    DASH_LOG_TRACE("dash::transform", "accumulate",
+                   "unit:", seg.unit, "pos:", seg.pos, "size:", seg.size);
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(
+        gptr,
+        values + seg.pos,
+        seg.size,
+        dash::dart_datatype<ValueType>::value,
+        op),
+      DART_OK);
+    if (s + 1 == segments.size() || segments[s + 1].unit != seg.unit) {
+      // Last segment at the unit:
+      DASH_ASSERT_RETURNS(
+        dart_flush(gptr),
+        DART_OK);
+    }
+  }
+}
+
+/**
+ * Applies a binary operation to elements \c [begin, end) of two local
+ * ranges in a vectorized loop.
+ * Output and input ranges may be identical but must not overlap
+ * otherwise.
+ */
+template<
+  typename ValueType,
+  class BinaryOperation >
+inline void transform_local_block(
+  const ValueType  * in_a,
+  const ValueType  * in_b,
+  ValueType        * out,
+  size_t             begin,
+  size_t             end,
+  BinaryOperation    binary_op,
+  std::true_type     /* is_simd_operation */)
+{
+  DASH__PRAGMA_SIMD
+  for (size_t i = begin; i < end; ++i) {
+    out[i] = binary_op(in_a[i], in_b[i]);
+  }
+}
+
+/**
+ * Applies a binary operation to elements \c [begin, end) of two local
+ * ranges, for operations that cannot be vectorized.
+ */
+template<
+  typename ValueType,
+  class BinaryOperation >
+inline void transform_local_block(
+  const ValueType  * in_a,
+  const ValueType  * in_b,
+  ValueType        * out,
+  size_t             begin,
+  size_t             end,
+  BinaryOperation    binary_op,
+  std::false_type    /* is_simd_operation */)
+{
+  for (size_t i = begin; i < end; ++i) {
+    out[i] = binary_op(in_a[i], in_b[i]);
+  }
+}
+
+/**
+ * Applies a binary operation to elements of two local ranges using all
+ * threads available to the unit.
+ * Reduce operations on DART basic types (\see is_simd_operation) are
+ * executed in vectorized loops.
+ */
+template<
+  typename ValueType,
+  class BinaryOperation >
+void transform_local_kernel(
+  const ValueType  * in_a,
+  const ValueType  * in_b,
+  ValueType        * out,
+  size_t             nelem,
+  BinaryOperation    binary_op)
+{
+  typedef dash::internal::is_simd_operation<BinaryOperation, ValueType>
+    is_simd;
+  dash::internal::parallel_for_static(
+    nelem,
+    std::max<size_t>(DASH__ARCH__CACHE_LINE_SIZE / sizeof(ValueType), 1),
+    [=](size_t begin, size_t end) {
+      transform_local_block(in_a, in_b, out, begin, end, binary_op,
+                            is_simd());
+    });
 }
 
 } // namespace internal
@@ -114,10 +216,9 @@ OutputIt transform(
  * Corresponding to \c MPI_Accumulate, the binary operation is executed
  * atomically on single elements.
  *
- * Precondition: All elements in the input range are contained in a single
- * block so that
- *
- *   g_out_last == g_out_first + (l_in_last - l_in_first)
+ * The output range may span multiple blocks and units. It is split into
+ * its contiguous segments in the local memory of units, and every segment
+ * is updated in a single accumulate operation.
  *
  * Semantics:
  *
@@ -228,27 +329,8 @@ OutputIt transform_local(
   // Local pointer of initial output element:
   ValueType * lbegin_out = (out_first  + g_offset_first).local();
   // Generate output values:
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::transform_local", "thread capacity:",  n_threads);
-  if (n_threads > 1) {
-    auto l_size = lend_a - lbegin_a;
-    // TODO: Vectorize.
-    // Documentation of Intel MIC intrinsics, see:
-    // https://software.intel.com/de-de/node/523533
-    // https://software.intel.com/de-de/node/523387
-    #pragma omp parallel for num_threads(n_threads) schedule(static)
-    for (int i = 0; i < l_size; i++) {
-      lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
-    }
-    return out_first + num_gvalues;
-  }
-#endif
-  // No OpenMP or insufficient number of threads for parallelization:
-  for (; lbegin_a != lend_a; ++lbegin_a, ++lbegin_b, ++lbegin_out) {
-    *lbegin_out = binary_op(*lbegin_a, *lbegin_b);
-  }
+  dash::internal::transform_local_kernel(
+    lbegin_a, lbegin_b, lbegin_out, lend_a - lbegin_a, binary_op);
   // Return out_end iterator past final transformed element;
   return out_first + num_gvalues;
 }
@@ -292,34 +374,17 @@ GlobOutputIt transform(
 
   dash::util::Trace trace("transform");
 
-  // Resolve local range from global range:
   // Number of elements in local range:
   size_t num_local_elements     = std::distance(in_first, in_last);
-  // Global iterator to dart_gptr_t:
-  dart_gptr_t dest_gptr         = out_first.dart_gptr();
-  // Send accumulate message:
+  // Send accumulate message for every output segment:
   trace.enter_state("transform_blocking");
-  dash::internal::transform_blocking_impl(
-      dest_gptr,
-      in_first,
+  dash::internal::transform_segments_impl(
+      &(*in_first),
       num_local_elements,
+      out_first,
       binary_op.dart_operation());
   trace.exit_state("transform_blocking");
-  // The position past the last element transformed in global element space
-  // cannot be resolved from the size of the local range if the local range
-  // spans over more than one block. Otherwise, the difference of two global
-  // iterators is not well-defined. The corresponding invariant is:
-  //   g_out_last == g_out_first + (l_in_last - l_in_first)
-  // Example:
-  //   unit:            0       1       0
-  //   local offset:  | 0 1 2 | 0 1 2 | 3 4 5 | ...
-  //   global offset: | 0 1 2   3 4 5   6 7 8   ...
-  //   range:          [- - -           - -]
-  // When iterating in local memory range [0,5[ of unit 0, the position of the
-  // global iterator to return is 8 != 5
-  // For ranges over block borders, we would have to resolve the global
-  // position past the last element transformed from the iterator's pattern
-  // (see dash::PatternIterator).
+
   return out_first + num_local_elements;
 }
 
@@ -394,32 +459,26 @@ GlobOutputIt transform(
   DASH_ASSERT_MSG(
     team_in_a == pattern_out.team(),
     "dash::transform: Different teams in input- and output ranges");
-  // Resolve local range from global range:
-  auto l_index_range_in_a       = local_index_range(in_a_first, in_a_last);
-  DASH_LOG_TRACE_VAR("dash::transform", l_index_range_in_a.begin);
-  DASH_LOG_TRACE_VAR("dash::transform", l_index_range_in_a.end);
-  // Local range to global offset:
-  auto global_offset            = pattern_in_a.global(
-                                    l_index_range_in_a.begin);
-  DASH_LOG_TRACE_VAR("dash::transform", global_offset);
-  // Number of elements in local range:
-  size_t num_local_elements     = l_index_range_in_a.end -
-                                  l_index_range_in_a.begin;
-  DASH_LOG_TRACE_VAR("dash::transform", num_local_elements);
-  // Global iterator to dart_gptr_t:
-  dart_gptr_t dest_gptr         = (out_first + global_offset).dart_gptr();
-  // Native pointer to local sub-range:
-  ValueType * l_values          = (in_a_first + global_offset).local();
-  // Send accumulate message:
+  auto g_begin                  = in_a_first.pos();
+  auto g_end                    = in_a_last.pos();
+  // Native pointer to first element in local memory of range a:
+  ValueType * l_values          = in_a_first.globmem().lbegin();
+  // Every unit accumulates the elements of input range a in its local
+  // memory to the corresponding elements in the output range:
   trace.enter_state("transform_blocking");
-  dash::internal::transform_blocking_impl(
-      dest_gptr,
-      l_values,
-      num_local_elements,
-      binary_op.dart_operation());
+  for (const auto & seg : dash::unit_local_segments(
+                            pattern_in_a, g_begin, g_end)) {
+    DASH_LOG_TRACE("dash::transform", "local input segment:",
+                   "pos:", seg.pos, "size:", seg.size);
+    dash::internal::transform_segments_impl(
+        l_values + seg.lindex,
+        seg.size,
+        out_first + seg.pos,
+        binary_op.dart_operation());
+  }
   trace.exit_state("transform_blocking");
 
-  return out_first + global_offset + num_local_elements;
+  return out_first + (g_end - g_begin);
 }
 
 /**
@@ -0,0 +1,224 @@
+#ifndef DASH__ALGORITHM__INTERNAL__PARALLEL_FOR_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__PARALLEL_FOR_H__INCLUDED
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <cstddef>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#else
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+#ifndef DASH_ENABLE_OPENMP
+
+/**
+ * Pool of worker threads executing local kernels in builds without
+ * OpenMP.
+ * Workers are started on first use and are reused in subsequent calls,
+ * task \c t is always executed by the same thread.
+ */
+class LocalThreadPool
+{
+private:
+  typedef LocalThreadPool self_t;
+
+public:
+  static self_t & instance()
+  {
+    static self_t pool;
+    return pool;
+  }
+
+  ~LocalThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _shutdown = true;
+    }
+    _task_cv.notify_all();
+    for (auto & worker : _workers) {
+      worker.join();
+    }
+  }
+
+  LocalThreadPool(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other)         = delete;
+
+  /**
+   * Executes \c task(t) for \c t in \c [0, n_tasks) and returns after all
+   * tasks completed. Task 0 is executed by the calling thread.
+   */
+  void run(
+    int                              n_tasks,
+    const std::function<void(int)> & task)
+  {
+    // Serialize concurrent callers:
+    std::lock_guard<std::mutex> run_lock(_run_mutex);
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      while (static_cast<int>(_workers.size()) < n_tasks - 1) {
+        int worker_id = static_cast<int>(_workers.size()) + 1;
+        _workers.emplace_back(&self_t::work, this, worker_id);
+      }
+      _task      = &task;
+      _n_tasks   = n_tasks;
+      _n_pending = n_tasks - 1;
+      ++_generation;
+    }
+    _task_cv.notify_all();
+    task(0);
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done_cv.wait(lock, [this]() { return _n_pending == 0; });
+    _task = nullptr;
+  }
+
+private:
+  LocalThreadPool() = default;
+
+  void work(int worker_id)
+  {
+    size_t generation = 0;
+    while (true) {
+      const std::function<void(int)> * task;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _task_cv.wait(lock, [&]() {
+          return _shutdown || _generation != generation;
+        });
+        if (_shutdown) {
+          return;
+        }
+        generation = _generation;
+        if (worker_id >= _n_tasks) {
+          continue;
+        }
+        task = _task;
+      }
+      (*task)(worker_id);
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        --_n_pending;
+      }
+      _done_cv.notify_one();
+    }
+  }
+
+private:
+  std::vector<std::thread>           _workers;
+  std::mutex                         _run_mutex;
+  std::mutex                         _mutex;
+  std::condition_variable            _task_cv;
+  std::condition_variable            _done_cv;
+  const std::function<void(int)>   * _task       = nullptr;
+  int                                _n_tasks    = 0;
+  int                                _n_pending  = 0;
+  size_t                             _generation = 0;
+  bool                               _shutdown   = false;
+
+}; // class LocalThreadPool
+
+#endif // DASH_ENABLE_OPENMP
+
+/**
+ * Number of threads to use for a local kernel on \c nelem elements.
+ * Bounded by the threads available in the unit's locality domain and a
+ * minimum number of elements per thread.
+ */
+inline int local_kernel_num_threads(size_t nelem)
+{
+  // Minimum number of elements per thread to amortize thread dispatch:
+  const size_t min_elem_per_thread = 1 << 14;
+
+  if (nelem < 2 * min_elem_per_thread) {
+    return 1;
+  }
+  dash::util::UnitLocality uloc;
+  int n_threads = std::min<size_t>(uloc.num_domain_threads(),
+                                   nelem / min_elem_per_thread);
+  return std::max(n_threads, 1);
+}
+
+/**
+ * Calls \c kernel(begin, end) on contiguous partitions of the index range
+ * \c [0, nelem) using the threads available to the calling unit.
+ *
+ * The range is statically partitioned in blocks of \c nalign elements so
+ * that partitions do not share cache lines, and partition \c t is always
+ * processed by thread \c t. Pages of a range that has been initialized
+ * by a local kernel therefore remain in the NUMA domain of the thread
+ * accessing them in subsequent kernels on the same range.
+ *
+ * Uses OpenMP if enabled, \c dash::internal::LocalThreadPool otherwise.
+ */
+template <class Kernel>
+void parallel_for_static(
+  /// Number of elements in the range
+  size_t   nelem,
+  /// Number of elements in a cache line
+  size_t   nalign,
+  /// Kernel to apply on partitions, signature \c void(size_t, size_t)
+  Kernel   kernel)
+{
+  int n_threads = local_kernel_num_threads(nelem);
+  if (n_threads <= 1) {
+    kernel(size_t(0), nelem);
+    return;
+  }
+  nalign = std::max<size_t>(nalign, 1);
+  size_t nblocks          = (nelem + nalign - 1) / nalign;
+  auto   partition_begin  = [=](int t) -> size_t {
+    return std::min(((nblocks * t) / n_threads) * nalign, nelem);
+  };
+  DASH_LOG_DEBUG("dash::internal::parallel_for_static",
+                 "elements:", nelem, "threads:", n_threads);
+#ifdef DASH_ENABLE_OPENMP
+  // The OpenMP runtime may provide less threads than requested:
+  auto run_partitions = [&](int t, int n_team_threads) {
+    for (int p = t; p < n_threads; p += n_team_threads) {
+      kernel(partition_begin(p), partition_begin(p + 1));
+    }
+  };
+  dash::util::UnitLocality uloc;
+  if (uloc.num_numa() > 1) {
+    // Unit spans several NUMA domains, distribute threads over domains:
+#if DASH__OPENMP_VERSION >= 40
+    #pragma omp parallel num_threads(n_threads) proc_bind(spread)
+#else
+    #pragma omp parallel num_threads(n_threads)
+#endif
+    run_partitions(omp_get_thread_num(), omp_get_num_threads());
+  } else {
+#if DASH__OPENMP_VERSION >= 40
+    #pragma omp parallel num_threads(n_threads) proc_bind(close)
+#else
+    #pragma omp parallel num_threads(n_threads)
+#endif
+    run_partitions(omp_get_thread_num(), omp_get_num_threads());
+  }
+#else
+  LocalThreadPool::instance().run(
+    n_threads,
+    [&](int t) {
+      kernel(partition_begin(t), partition_begin(t + 1));
+    });
+#endif
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__PARALLEL_FOR_H__INCLUDED
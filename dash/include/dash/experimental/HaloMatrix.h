@@ -11,6 +11,7 @@
 #include <dash/experimental/iterator/HaloMatrixIterator.h>
 
 #include <type_traits>
+#include <vector>
 
 
 namespace dash {
@@ -85,12 +86,15 @@ public:
       if(offsets[d].plus)
         initBlockViewData(d, HaloRegion::PLUS);
     }
+    DASH_ASSERT_RETURNS(dart_handle_group_create(&_handle_group), DART_OK);
   }
 
+  HaloMatrix(const self_t & other)         = delete;
+  self_t & operator=(const self_t & other) = delete;
+
   ~HaloMatrix()
   {
-    for(auto & view : _blockview_data)
-      free(view.second.handle);
+    dart_handle_group_destroy(&_handle_group);
   }
 
   iterator begin() noexcept
@@ -171,8 +175,9 @@ public:
 
   void waitHalosAsync()
   {
-    for(auto & view : _blockview_data)
-      dart_waitall(view.second.handle, view.second.num_handles);
+    // Transfers of all halo regions are completed at once, every
+    // neighbor unit is flushed only once:
+    dart_handle_group_waitall(_handle_group);
   }
 
   void updateHalos()
@@ -214,11 +219,53 @@ private:
     }
 
     auto nbytes = cont_elems * sizeof(value_t);
-    dart_handle_t * handle = (dart_handle_t*) malloc (sizeof (dart_handle_t) * num_handle);
-    for(auto i = 0; i < num_handle; ++i)
-      handle[i] = nullptr;
+
+    // Halo rows in the same remote segment are fetched in a single
+    // strided or indexed transfer instead of one transfer per row:
+    std::vector<size_t> displs;
+    size_type           stride = 0;
+    if(num_handle > 1)
+    {
+      const auto scale = dash::dart_storage<value_t>(1).nelem;
+      auto it          = blockview.begin();
+      auto gptr_first  = it.dart_gptr();
+      displs.reserve(num_handle);
+      for(auto i = 0; i < num_handle; ++i, it += cont_elems)
+      {
+        auto gptr = it.dart_gptr();
+        if(gptr.unitid != gptr_first.unitid ||
+           gptr.segid  != gptr_first.segid  ||
+           gptr.teamid != gptr_first.teamid ||
+           gptr.addr_or_offs.offset < gptr_first.addr_or_offs.offset)
+        {
+          displs.clear();
+          break;
+        }
+        displs.push_back(
+          (gptr.addr_or_offs.offset - gptr_first.addr_or_offs.offset)
+          / sizeof(value_t) * scale);
+      }
+      if(displs.size() > 1)
+      {
+        stride = displs[1];
+        for(size_t i = 2; i < displs.size() && stride > 0; ++i)
+        {
+          if(displs[i] - displs[i-1] != stride)
+            stride = 0;
+        }
+        if(stride > 0)
+          displs.clear();
+      }
+    }
+
+    auto num_transfers = (stride > 0 || !displs.empty()) ? 1 : num_handle;
+    std::vector<size_t> blocklens(
+      displs.size(), dash::dart_storage<value_t>(cont_elems).nelem);
     _blockview_data.insert(std::make_pair(
-          std::move(std::make_pair(dim, region)), Data{std::move(blockview), handle, num_handle, cont_elems, nbytes}));
+          std::move(std::make_pair(dim, region)),
+          Data{std::move(blockview), num_transfers, num_handle,
+               cont_elems, nbytes, stride, std::move(displs),
+               std::move(blocklens)}));
   }
 
   void updateHaloIntern(dim_t dim, HaloRegion region, bool async)
@@ -229,12 +276,28 @@ private:
       auto & data = it_find->second;
       auto off = _halomemory.haloPos(dim, region);
       auto it = data.blockview.begin();
-      for(auto i = 0; i < data.num_handles; ++i, it += data.cont_elems){
-        dart_storage_t ds = dash::dart_storage<value_t>(data.cont_elems);
-        dart_get_handle (off + ds.nelem * i, it.dart_gptr(), ds.nelem, ds.dtype, &(data.handle[i]));
+      dart_storage_t ds = dash::dart_storage<value_t>(data.cont_elems);
+      if(data.stride > 0)
+      {
+        dart_get_strided_grouped(off, it.dart_gptr(), data.num_blocks,
+                                 ds.nelem, data.stride, ds.dtype,
+                                 _handle_group);
+      }
+      else if(!data.displs.empty())
+      {
+        dart_get_indexed_grouped(off, it.dart_gptr(), data.num_blocks,
+                                 data.blocklens.data(), data.displs.data(),
+                                 ds.dtype, _handle_group);
+      }
+      else
+      {
+        for(auto i = 0; i < data.num_transfers; ++i, it += data.cont_elems){
+          dart_get_grouped(off + data.cont_elems * i, it.dart_gptr(),
+                           ds.nelem, ds.dtype, _handle_group);
+        }
       }
       if(!async)
-        dart_waitall(data.handle, data.num_handles);
+        dart_handle_group_waitall(_handle_group);
     }
   }
 
@@ -249,12 +312,22 @@ private:
   struct Data
   {
     const HaloBlockView_t blockview;
-    dart_handle_t *       handle;
-    size_type             num_handles;
+    /// Number of transfers issued to update the halo region
+    size_type             num_transfers;
+    /// Number of contiguous blocks (rows) in the halo region
+    size_type             num_blocks;
     size_type             cont_elems;
     std::uint64_t         nbytes;
+    /// Distance between blocks in DART elements if regularly strided,
+    /// 0 otherwise
+    size_type             stride;
+    /// Block displacements in DART elements for indexed transfers,
+    /// empty if not applicable
+    std::vector<size_t>   displs;
+    std::vector<size_t>   blocklens;
   };
   std::map<std::pair<dim_t, HaloRegion>, Data> _blockview_data;
+  dart_handle_group_t     _handle_group = nullptr;
 
   iterator                _begin;
   iterator                _end;
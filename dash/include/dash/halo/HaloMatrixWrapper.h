@@ -0,0 +1,738 @@
+#ifndef DASH__HALO__HALO_MATRIX_WRAPPER_H__INCLUDED
+#define DASH__HALO__HALO_MATRIX_WRAPPER_H__INCLUDED
+
+#include <dash/Halo.h>
+#include <dash/Types.h>
+#include <dash/Dimensional.h>
+#include <dash/Exception.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+
+namespace dash {
+namespace halo {
+
+/**
+ * Treatment of halo regions beyond the global boundaries of a matrix.
+ */
+enum class BoundaryProp : uint8_t {
+  /// Halo values beyond the boundary are not set
+  NONE,
+  /// Halo values are copied from the opposite boundary (periodic)
+  CYCLIC,
+  /// Halo values are fixed values set with
+  /// \c HaloMatrixWrapper::set_custom_halos
+  CUSTOM
+};
+
+/**
+ * Boundary properties of a matrix in every dimension.
+ */
+template<dim_t NumDimensions>
+class GlobalBoundarySpec
+{
+public:
+  /**
+   * Creates a boundary specification with \c BoundaryProp::NONE in all
+   * dimensions.
+   */
+  GlobalBoundarySpec()
+  {
+    _props.fill(BoundaryProp::NONE);
+  }
+
+  GlobalBoundarySpec(
+    const std::array<BoundaryProp, NumDimensions> & props)
+  : _props(props)
+  { }
+
+  template<typename... Args>
+  GlobalBoundarySpec(BoundaryProp prop, Args... args)
+  : _props {{ prop, static_cast<BoundaryProp>(args)... }}
+  {
+    static_assert(sizeof...(Args) == NumDimensions-1,
+                  "Invalid number of boundary properties");
+  }
+
+  /**
+   * Boundary property in the given dimension.
+   */
+  BoundaryProp operator[](dim_t dim) const
+  {
+    return _props[dim];
+  }
+
+private:
+  std::array<BoundaryProp, NumDimensions> _props;
+};
+
+/**
+ * Halo exchange engine for multidimensional matrices in stencil codes.
+ *
+ * Maintains the halo regions of all local blocks of
+ * a \c dash::Matrix for a stencil of given extents (\c dash::HaloSpec).
+ * Halo regions are determined once at construction, including faces,
+ * edges and corners of the blocks. Every update fetches the boundary
+ * elements of neighboring blocks with a single strided or indexed
+ * transfer per region and neighbor unit.
+ *
+ * Updates are split in \c update_async and \c wait so the inner region of
+ * the local blocks, i.e. elements that do not depend on halo values, can
+ * be computed while halo transfers are in flight:
+ *
+ * \code
+ *   dash::HaloSpec<2> stencil({{ { -1, 1 }, { -1, 1 } }});
+ *   dash::halo::GlobalBoundarySpec<2> bnd(
+ *     dash::halo::BoundaryProp::CYCLIC,
+ *     dash::halo::BoundaryProp::CYCLIC);
+ *   dash::halo::HaloMatrixWrapper<matrix_t> halo(matrix, stencil, bnd);
+ *
+ *   for (int i = 0; i < iterations; ++i) {
+ *     halo.update_async();
+ *     // compute elements in halo.inner_view(lb) ...
+ *     halo.wait();
+ *     // compute remaining elements using halo.value_at(lb, coords) ...
+ *     matrix.barrier();
+ *   }
+ * \endcode
+ */
+template<typename MatrixT>
+class HaloMatrixWrapper
+{
+private:
+  static constexpr dim_t NumDimensions = MatrixT::ndim();
+
+  typedef HaloMatrixWrapper<MatrixT>                               self_t;
+
+public:
+  typedef MatrixT                                             matrix_type;
+  typedef typename MatrixT::value_type                         value_type;
+  typedef typename MatrixT::pattern_type                     pattern_type;
+  typedef typename pattern_type::index_type                    index_type;
+  typedef typename pattern_type::size_type                      size_type;
+  typedef typename pattern_type::viewspec_type              viewspec_type;
+  typedef dash::HaloSpec<NumDimensions>                     halospec_type;
+  typedef GlobalBoundarySpec<NumDimensions>                 boundary_type;
+  typedef std::array<index_type, NumDimensions>               coords_type;
+  /// Direction of a halo region relative to its block, -1, 0 or 1 in
+  /// every dimension
+  typedef std::array<int, NumDimensions>                   direction_type;
+
+  /**
+   * Halo region of a local block.
+   */
+  struct Region
+  {
+    /// Direction of the region relative to the block
+    direction_type direction;
+    /// Global coordinates of the region, may exceed the matrix extents
+    viewspec_type  view;
+    /// Offset of the region's first element in the halo buffer
+    size_type      buffer_offset;
+    /// Boundary property of elements beyond the matrix extents,
+    /// \c BoundaryProp::CYCLIC if the region does not exceed them.
+    /// Elements within the matrix extents are always updated.
+    BoundaryProp   prop;
+  };
+
+private:
+  static constexpr int num_directions(dim_t ndim)
+  {
+    return (ndim == 0) ? 1 : 3 * num_directions(ndim - 1);
+  }
+
+  static constexpr int NumDirections = num_directions(NumDimensions);
+
+  struct Block
+  {
+    /// Global coordinates of the block
+    viewspec_type                       view;
+    /// Local coordinates of the block
+    viewspec_type                       view_local;
+    /// Halo regions of the block
+    std::vector<Region>                 regions;
+    /// Index of the region in every direction, -1 if no halo region in
+    /// the direction
+    std::array<int, NumDirections>      region_index;
+  };
+
+  /**
+   * Transfer of elements of a halo region from a single unit.
+   */
+  struct Transfer
+  {
+    dart_gptr_t         gptr;
+    size_type           buffer_offset;
+    size_t              nblocks;
+    size_t              nelem_block;
+    size_t              stride;
+    std::vector<size_t> nelem_blocks;
+    std::vector<size_t> displs;
+  };
+
+  /**
+   * Contiguous elements in local memory of a unit copied to a contiguous
+   * range in the halo buffer.
+   */
+  struct Piece
+  {
+    team_unit_t unit;
+    index_type  lindex;
+    size_type   nelem;
+    size_type   buffer_offset;
+  };
+
+public:
+  /**
+   * Creates halo regions of all local blocks of the given matrix for a
+   * stencil with the given extents.
+   * Halo regions reaching beyond the global boundary are split at the
+   * boundary, elements beyond it are treated according to the boundary
+   * property of the exceeded dimension.
+   *
+   * Not collective, the matrix must be allocated.
+   */
+  HaloMatrixWrapper(
+    MatrixT             & matrix,
+    const halospec_type & halospec,
+    const boundary_type & boundary = boundary_type())
+  : _matrix(matrix),
+    _halospec(halospec),
+    _boundary(boundary)
+  {
+    const auto & pattern = _matrix.pattern();
+    size_type buffer_size = 0;
+    auto nblocks = pattern.local_blockspec().size();
+    _blocks.reserve(nblocks);
+    for (size_type lb = 0; lb < nblocks; ++lb) {
+      Block block;
+      block.view       = pattern.local_block(lb);
+      block.view_local = pattern.local_block_local(lb);
+      block.region_index.fill(-1);
+      if (block.view.size() > 0) {
+        init_regions(block, buffer_size);
+      }
+      _blocks.push_back(std::move(block));
+    }
+    _halo_buffer.resize(buffer_size);
+    for (const auto & block : _blocks) {
+      for (const auto & region : block.regions) {
+        init_transfers(region);
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_handle_group_create(&_handle_group),
+      DART_OK);
+    DASH_LOG_DEBUG("HaloMatrixWrapper()",
+                   "blocks:",    _blocks.size(),
+                   "transfers:", _transfers.size(),
+                   "halo size:", _halo_buffer.size());
+  }
+
+  HaloMatrixWrapper(const self_t & other)         = delete;
+  self_t & operator=(const self_t & other)        = delete;
+
+  ~HaloMatrixWrapper()
+  {
+    dart_handle_group_destroy(&_handle_group);
+  }
+
+  /**
+   * Starts the update of all halo regions from the boundaries of
+   * neighboring blocks.
+   *
+   * Neighboring units must have completed modifications of their boundary
+   * elements before, e.g. by a barrier, and must not modify them before
+   * the update has been completed by \c wait.
+   */
+  void update_async()
+  {
+    DASH_LOG_TRACE("HaloMatrixWrapper.update_async()",
+                   "transfers:", _transfers.size());
+    auto dtype = dash::dart_storage<value_type>(1).dtype;
+    for (const auto & transfer : _transfers) {
+      auto dest = _halo_buffer.data() + transfer.buffer_offset;
+      if (!transfer.displs.empty()) {
+        DASH_ASSERT_RETURNS(
+          dart_get_indexed_grouped(
+            dest, transfer.gptr, transfer.nblocks,
+            transfer.nelem_blocks.data(), transfer.displs.data(),
+            dtype, _handle_group),
+          DART_OK);
+      } else {
+        DASH_ASSERT_RETURNS(
+          dart_get_strided_grouped(
+            dest, transfer.gptr, transfer.nblocks, transfer.nelem_block,
+            transfer.stride, dtype, _handle_group),
+          DART_OK);
+      }
+    }
+  }
+
+  /**
+   * Waits for completion of the halo update started by \c update_async.
+   */
+  void wait()
+  {
+    DASH_ASSERT_RETURNS(
+      dart_handle_group_waitall(_handle_group),
+      DART_OK);
+  }
+
+  /**
+   * Updates all halo regions.
+   */
+  void update()
+  {
+    update_async();
+    wait();
+  }
+
+  /**
+   * Sets the values of halo regions beyond the global boundary in
+   * dimensions with \c BoundaryProp::CUSTOM.
+   * The values remain unchanged in subsequent updates.
+   *
+   * \param fn  Function returning the halo value for global coordinates,
+   *            signature <tt>value_type(const coords_type &)</tt>
+   */
+  template<typename FunctionT>
+  void set_custom_halos(FunctionT fn)
+  {
+    for (const auto & block : _blocks) {
+      for (const auto & region : block.regions) {
+        if (region.prop != BoundaryProp::CUSTOM) {
+          continue;
+        }
+        for (size_type i = 0; i < region.view.size(); ++i) {
+          auto coords = region_coords(region.view, i);
+          if (boundary_prop(coords) == BoundaryProp::CUSTOM) {
+            _halo_buffer[region.buffer_offset + i] = fn(coords);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Number of local blocks of the matrix.
+   */
+  size_type num_blocks() const
+  {
+    return _blocks.size();
+  }
+
+  /**
+   * Global coordinates of the local block with the given index.
+   */
+  const viewspec_type & block_view(size_type lb) const
+  {
+    return _blocks[lb].view;
+  }
+
+  /**
+   * Global coordinates of the elements in the local block with the given
+   * index that do not depend on halo values.
+   * These can be computed before completion of a halo update.
+   */
+  viewspec_type inner_view(size_type lb) const
+  {
+    auto view = _blocks[lb].view;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      index_type extent = static_cast<index_type>(view.extent(d))
+                          - width(d, -1) - width(d, 1);
+      view.resize_dim(d, view.offset(d) + width(d, -1),
+                      std::max<index_type>(extent, 0));
+    }
+    return view;
+  }
+
+  /**
+   * Halo regions of the local block with the given index.
+   */
+  const std::vector<Region> & regions(size_type lb) const
+  {
+    return _blocks[lb].regions;
+  }
+
+  /**
+   * Pointer to the first element of a halo region in the halo buffer,
+   * elements are stored in the memory order of the pattern.
+   * Returns \c nullptr if the block has no halo region in the given
+   * direction.
+   */
+  value_type * halo_region_begin(
+    size_type              lb,
+    const direction_type & direction)
+  {
+    auto index = _blocks[lb].region_index[direction_index(direction)];
+    if (index < 0) {
+      return nullptr;
+    }
+    return _halo_buffer.data() + _blocks[lb].regions[index].buffer_offset;
+  }
+
+  /**
+   * Value at the given global coordinates in the local block with the
+   * given index or in its halo.
+   * Coordinates must not exceed the halo of the block.
+   */
+  const value_type & value_at(
+    size_type           lb,
+    const coords_type & coords) const
+  {
+    const auto &   block = _blocks[lb];
+    direction_type direction;
+    coords_type    rel_coords;
+    bool           is_inner = true;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      rel_coords[d] = coords[d] - block.view.offset(d);
+      direction[d]  = (rel_coords[d] < 0)
+                      ? -1
+                      : (rel_coords[d] >=
+                           static_cast<index_type>(block.view.extent(d))
+                         ? 1 : 0);
+      is_inner = is_inner && (direction[d] == 0);
+    }
+    if (is_inner) {
+      for (dim_t d = 0; d < NumDimensions; ++d) {
+        rel_coords[d] += block.view_local.offset(d);
+      }
+      return _matrix.lbegin()[_matrix.pattern().local_at(rel_coords)];
+    }
+    auto index = block.region_index[direction_index(direction)];
+    DASH_ASSERT_MSG(index >= 0, "Coordinates exceed halo of block");
+    const auto & region = block.regions[index];
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      rel_coords[d] = coords[d] - region.view.offset(d);
+    }
+    return _halo_buffer[region.buffer_offset +
+                        memory_offset(region.view, rel_coords)];
+  }
+
+  /**
+   * The stencil extents of the halo.
+   */
+  const halospec_type & halospec() const
+  {
+    return _halospec;
+  }
+
+  /**
+   * The matrix the halo is associated with.
+   */
+  MatrixT & matrix()
+  {
+    return _matrix;
+  }
+
+private:
+  /**
+   * Halo width in dimension \c dim and direction \c dir (-1 or 1).
+   */
+  index_type width(dim_t dim, int dir) const
+  {
+    auto range = _halospec.offset_range(dim);
+    return (dir < 0) ? std::max(0, -range.min) : std::max(0, range.max);
+  }
+
+  /**
+   * Boundary property of the element at the given global coordinates,
+   * \c BoundaryProp::CYCLIC if the coordinates are within the matrix
+   * extents.
+   */
+  BoundaryProp boundary_prop(const coords_type & coords) const
+  {
+    const auto & pattern   = _matrix.pattern();
+    bool         is_none   = false;
+    bool         is_custom = false;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      if (coords[d] < 0 ||
+          coords[d] >= static_cast<index_type>(pattern.extent(d))) {
+        is_none   = is_none   || (_boundary[d] == BoundaryProp::NONE);
+        is_custom = is_custom || (_boundary[d] == BoundaryProp::CUSTOM);
+      }
+    }
+    return is_custom ? BoundaryProp::CUSTOM
+                     : (is_none ? BoundaryProp::NONE : BoundaryProp::CYCLIC);
+  }
+
+  /**
+   * Global coordinates wrapped to the matrix extents.
+   */
+  coords_type wrap_coords(coords_type coords) const
+  {
+    const auto & pattern = _matrix.pattern();
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      index_type extent_d = pattern.extent(d);
+      coords[d] = ((coords[d] % extent_d) + extent_d) % extent_d;
+    }
+    return coords;
+  }
+
+  static int direction_index(const direction_type & direction)
+  {
+    int index = 0;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      index = index * 3 + (direction[d] + 1);
+    }
+    return index;
+  }
+
+  /**
+   * Dimensions ordered from slowest to fastest in the pattern's memory
+   * order.
+   */
+  static std::array<dim_t, NumDimensions> memory_dims()
+  {
+    std::array<dim_t, NumDimensions> dims;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      dims[d] = (pattern_type::memory_order() == ROW_MAJOR)
+                ? d
+                : NumDimensions - 1 - d;
+    }
+    return dims;
+  }
+
+  /**
+   * Offset of coordinates relative to a view in the pattern's memory
+   * order.
+   */
+  static size_type memory_offset(
+    const viewspec_type & view,
+    const coords_type   & rel_coords)
+  {
+    size_type offset = 0;
+    for (auto d : memory_dims()) {
+      offset = offset * view.extent(d) + rel_coords[d];
+    }
+    return offset;
+  }
+
+  /**
+   * Global coordinates of the element at the given offset in a view in
+   * the pattern's memory order.
+   */
+  static coords_type region_coords(
+    const viewspec_type & view,
+    size_type             offset)
+  {
+    coords_type coords;
+    auto        dims = memory_dims();
+    for (int k = NumDimensions - 1; k >= 0; --k) {
+      auto d    = dims[k];
+      coords[d] = view.offset(d) +
+                  static_cast<index_type>(offset % view.extent(d));
+      offset   /= view.extent(d);
+    }
+    return coords;
+  }
+
+  void init_regions(Block & block, size_type & buffer_size)
+  {
+    const auto & pattern = _matrix.pattern();
+    for (int dir_index = 0; dir_index < NumDirections; ++dir_index) {
+      direction_type direction;
+      bool           is_halo = false;
+      auto           idx     = dir_index;
+      for (int d = NumDimensions - 1; d >= 0; --d) {
+        direction[d] = (idx % 3) - 1;
+        idx         /= 3;
+        is_halo      = is_halo || (direction[d] != 0);
+      }
+      if (!is_halo) {
+        continue;
+      }
+      Region region;
+      region.direction = direction;
+      region.view      = block.view;
+      region.prop      = BoundaryProp::CYCLIC;
+      bool is_empty    = false;
+      bool is_none     = false;
+      bool is_custom   = false;
+      for (dim_t d = 0; d < NumDimensions; ++d) {
+        if (direction[d] == 0) {
+          continue;
+        }
+        auto w = width(d, direction[d]);
+        if (w == 0) {
+          is_empty = true;
+          break;
+        }
+        index_type offset = (direction[d] < 0)
+                            ? block.view.offset(d) - w
+                            : block.view.offset(d) +
+                                static_cast<index_type>(block.view.extent(d));
+        region.view.resize_dim(d, offset, w);
+        if (offset < 0 ||
+            offset + w > static_cast<index_type>(pattern.extent(d))) {
+          is_none   = is_none   || (_boundary[d] == BoundaryProp::NONE);
+          is_custom = is_custom || (_boundary[d] == BoundaryProp::CUSTOM);
+        }
+      }
+      if (is_empty) {
+        continue;
+      }
+      if (is_custom) {
+        region.prop = BoundaryProp::CUSTOM;
+      } else if (is_none) {
+        region.prop = BoundaryProp::NONE;
+      }
+      region.buffer_offset = buffer_size;
+      buffer_size         += region.view.size();
+      block.region_index[dir_index] = block.regions.size();
+      block.regions.push_back(region);
+    }
+  }
+
+  /**
+   * Resolves the transfers of elements in a halo region from the
+   * boundaries of neighboring blocks.
+   * Rows of the region are split at the global boundary, elements within
+   * the matrix extents and beyond cyclic boundaries are collected in
+   * contiguous pieces of local memory of the owning units. Consecutive
+   * pieces of the same unit are combined in a single strided or indexed
+   * transfer.
+   */
+  void init_transfers(const Region & region)
+  {
+    const auto & pattern  = _matrix.pattern();
+    auto         fastest  = memory_dims()[NumDimensions - 1];
+    index_type   extent_f = pattern.extent(fastest);
+    size_type    row_len  = region.view.extent(fastest);
+    size_type    num_rows = region.view.size() / row_len;
+
+    std::vector<Piece> pieces;
+    for (size_type row = 0; row < num_rows; ++row) {
+      auto       coords  = region_coords(region.view, row * row_len);
+      index_type row_end = coords[fastest] + static_cast<index_type>(row_len);
+      for (index_type seg_begin = coords[fastest]; seg_begin < row_end; ) {
+        // Segment ends at the next multiple of the matrix extent:
+        index_type period  = seg_begin / extent_f
+                             - ((seg_begin % extent_f < 0) ? 1 : 0);
+        index_type seg_end = std::min(row_end, (period + 1) * extent_f);
+        auto seg_coords     = coords;
+        seg_coords[fastest] = seg_begin;
+        if (boundary_prop(seg_coords) == BoundaryProp::CYCLIC) {
+          add_row_pieces(
+            pieces, wrap_coords(seg_coords), seg_end - seg_begin,
+            region.buffer_offset + row * row_len
+              + (seg_begin - coords[fastest]));
+        }
+        seg_begin = seg_end;
+      }
+    }
+
+    auto & globmem = _matrix.begin().globmem();
+    auto   scale   = dash::dart_storage<value_type>(1).nelem;
+    for (size_t p_first = 0; p_first < pieces.size(); ) {
+      size_t p_last = p_first + 1;
+      while (p_last < pieces.size() &&
+             pieces[p_last].unit == pieces[p_first].unit &&
+             pieces[p_last].lindex > pieces[p_last - 1].lindex) {
+        ++p_last;
+      }
+      const auto & base = pieces[p_first];
+      Transfer transfer;
+      transfer.gptr          = globmem.at(base.unit, base.lindex).dart_gptr();
+      transfer.buffer_offset = base.buffer_offset;
+      transfer.nblocks       = p_last - p_first;
+      transfer.nelem_block   = base.nelem * scale;
+      transfer.stride        = (transfer.nblocks > 1)
+                               ? (pieces[p_first + 1].lindex - base.lindex)
+                                 * scale
+                               : transfer.nelem_block;
+      bool is_strided = true;
+      for (size_t p = p_first + 1; p < p_last && is_strided; ++p) {
+        is_strided = (pieces[p].nelem == base.nelem) &&
+                     (static_cast<size_t>(
+                        pieces[p].lindex - pieces[p - 1].lindex) * scale
+                      == transfer.stride);
+      }
+      if (!is_strided) {
+        for (size_t p = p_first; p < p_last; ++p) {
+          transfer.nelem_blocks.push_back(pieces[p].nelem * scale);
+          transfer.displs.push_back(
+            (pieces[p].lindex - base.lindex) * scale);
+        }
+      }
+      _transfers.push_back(std::move(transfer));
+      p_first = p_last;
+    }
+  }
+
+  /**
+   * Appends the pieces of \c nelem elements in a row of the matrix
+   * starting at the given global coordinates, which must be within the
+   * matrix extents.
+   */
+  void add_row_pieces(
+    std::vector<Piece> & pieces,
+    const coords_type  & coords,
+    size_type            nelem,
+    size_type            buffer_offset) const
+  {
+    const auto & pattern     = _matrix.pattern();
+    auto         fastest     = memory_dims()[NumDimensions - 1];
+    auto         first       = pattern.local_index(coords);
+    auto         last_coords = coords;
+    last_coords[fastest]    += nelem - 1;
+    auto         last        = pattern.local_index(last_coords);
+    if (first.unit == last.unit &&
+        last.index - first.index == static_cast<index_type>(nelem - 1)) {
+      add_piece(pieces, first.unit, first.index, nelem, buffer_offset);
+      return;
+    }
+    // Row spans several blocks, resolve elements individually:
+    for (size_type e = 0; e < nelem; ++e) {
+      auto e_coords = coords;
+      e_coords[fastest] += e;
+      auto l_pos = pattern.local_index(e_coords);
+      add_piece(pieces, l_pos.unit, l_pos.index, 1, buffer_offset + e);
+    }
+  }
+
+  /**
+   * Appends a piece, merges it with the previous piece if both are
+   * contiguous in local memory and in the halo buffer.
+   */
+  static void add_piece(
+    std::vector<Piece> & pieces,
+    team_unit_t          unit,
+    index_type           lindex,
+    size_type            nelem,
+    size_type            buffer_offset)
+  {
+    if (!pieces.empty()) {
+      auto & prev = pieces.back();
+      if (prev.unit == unit &&
+          prev.lindex + static_cast<index_type>(prev.nelem) == lindex &&
+          prev.buffer_offset + prev.nelem == buffer_offset) {
+        prev.nelem += nelem;
+        return;
+      }
+    }
+    pieces.push_back(Piece { unit, lindex, nelem, buffer_offset });
+  }
+
+private:
+  MatrixT                 & _matrix;
+  const halospec_type       _halospec;
+  const boundary_type       _boundary;
+  std::vector<Block>        _blocks;
+  std::vector<Transfer>     _transfers;
+  std::vector<value_type>   _halo_buffer;
+  dart_handle_group_t       _handle_group = nullptr;
+
+}; // class HaloMatrixWrapper
+
+} // namespace halo
+} // namespace dash
+
+#endif // DASH__HALO__HALO_MATRIX_WRAPPER_H__INCLUDED
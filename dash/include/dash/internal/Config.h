@@ -182,6 +182,19 @@
 #  endif
 #endif
 
+// Vectorization hint for loops without loop-carried dependencies
+#if defined(DASH_ENABLE_OPENMP) && DASH__OPENMP_VERSION >= 40
+#  define DASH__PRAGMA_SIMD _Pragma("omp simd")
+#elif defined(__INTEL_COMPILER)
+#  define DASH__PRAGMA_SIMD _Pragma("ivdep")
+#elif defined(__clang__)
+#  define DASH__PRAGMA_SIMD _Pragma("clang loop vectorize(enable)")
+#elif defined(__GNUC__)
+#  define DASH__PRAGMA_SIMD _Pragma("GCC ivdep")
+#else
+#  define DASH__PRAGMA_SIMD
+#endif
+
 #endif // DOXYGEN
 
 #endif // DASH__INTERNAL__CONFIG_H_
@@ -11,6 +11,7 @@
 #include <functional>
 #include <cmath>
 #include <numeric>
+#include <cstdint>
 
 namespace dash {
 namespace math {
@@ -274,6 +275,130 @@ balance_extents(
   return extents;
 }
 
+namespace internal {
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 uint128_t;
+
+/**
+ * High 64 bits of the 128-bit product of \c a and \c b.
+ */
+constexpr uint64_t mul_hi64(uint64_t a, uint64_t b) noexcept
+{
+  return static_cast<uint64_t>((static_cast<uint128_t>(a) * b) >> 64);
+}
+#endif
+
+constexpr unsigned ilog2(uint64_t n) noexcept
+{
+  return (n < 2) ? 0 : 1 + ilog2(n >> 1);
+}
+
+} // namespace internal
+
+/**
+ * Divisor with precomputed parameters for repeated division and modulo
+ * of non-negative values, intended for divisors that are invariant over
+ * the lifetime of an object like block extents and the number of units
+ * in a pattern.
+ *
+ * Powers of two are resolved to shift and mask operations. Other
+ * divisors of operands in 32 bit range are resolved to multiplication
+ * with a precomputed reciprocal (Lemire, Kaser, Kurz: "Faster Remainder
+ * by Direct Computation", 2019) on platforms providing 128-bit integer
+ * arithmetics. All other operands fall back to integer division.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::math::Divisor<size_t> bs(blocksize);
+ *   auto block = bs.div(g_index); // == g_index / blocksize
+ *   auto phase = bs.mod(g_index); // == g_index % blocksize
+ * \endcode
+ */
+template<typename Integer>
+class Divisor
+{
+public:
+  constexpr Divisor() noexcept = default;
+
+  constexpr Divisor(Integer d) noexcept
+  : _d(d),
+    _pow2(d > 0 && (d & (d - 1)) == 0),
+    _shift(internal::ilog2(static_cast<uint64_t>(d))),
+#ifdef __SIZEOF_INT128__
+    _magic((d > 1 && static_cast<uint64_t>(d) <= UINT32_MAX)
+           ? ~static_cast<uint64_t>(0) / static_cast<uint64_t>(d) + 1
+           : 0)
+#else
+    _magic(0)
+#endif
+  { }
+
+  /**
+   * The divisor value.
+   */
+  constexpr Integer value() const noexcept {
+    return _d;
+  }
+
+  /**
+   * Quotient \c (x / d).
+   */
+  template<typename T>
+  constexpr T div(T x) const noexcept {
+    return (x < 0)
+           ? x / static_cast<T>(_d)
+           : ( _pow2
+               ? static_cast<T>(static_cast<uint64_t>(x) >> _shift)
+#ifdef __SIZEOF_INT128__
+               : ( (_magic != 0 && static_cast<uint64_t>(x) <= UINT32_MAX)
+                   ? static_cast<T>(internal::mul_hi64(
+                                      _magic, static_cast<uint64_t>(x)))
+                   : x / static_cast<T>(_d) )
+#else
+               : x / static_cast<T>(_d)
+#endif
+             );
+  }
+
+  /**
+   * Remainder \c (x % d).
+   */
+  template<typename T>
+  constexpr T mod(T x) const noexcept {
+    return (x < 0)
+           ? x % static_cast<T>(_d)
+           : ( _pow2
+               ? static_cast<T>(static_cast<uint64_t>(x) &
+                                (static_cast<uint64_t>(_d) - 1))
+#ifdef __SIZEOF_INT128__
+               : ( (_magic != 0 && static_cast<uint64_t>(x) <= UINT32_MAX)
+                   ? static_cast<T>(internal::mul_hi64(
+                                      _magic * static_cast<uint64_t>(x),
+                                      static_cast<uint64_t>(_d)))
+                   : x % static_cast<T>(_d) )
+#else
+               : x % static_cast<T>(_d)
+#endif
+             );
+  }
+
+  constexpr bool operator==(const Divisor & other) const noexcept {
+    return _d == other._d;
+  }
+
+  constexpr bool operator!=(const Divisor & other) const noexcept {
+    return _d != other._d;
+  }
+
+private:
+  Integer  _d     = 0;
+  bool     _pow2  = false;
+  unsigned _shift = 0;
+  uint64_t _magic = 0;
+};
+
 /**
  * Seed initialization for \c dash::math::lrand().
  *
@@ -0,0 +1,664 @@
+#ifndef DASH__LIST__LIST_QUEUE_H__INCLUDED
+#define DASH__LIST__LIST_QUEUE_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/GlobRef.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/memory/GlobHeapMem.h>
+#include <dash/Allocator.h>
+#include <dash/Array.h>
+#include <dash/Atomic.h>
+
+#include <dash/list/internal/ListTypes.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace dash {
+
+/**
+ * Shared queue of elements in global memory, units insert and remove
+ * elements at both ends concurrently without synchronization.
+ *
+ * Operations are one-sided and lock-free, nodes are linked by atomic
+ * compare-and-swap operations on the head, the tail and the node links.
+ * Nodes are allocated in node pools at every unit which are only extended
+ * in the collective \c barrier().
+ *
+ * A \c ListQueue is available as member \c queue of every \c dash::List
+ * and is independent of the elements in the list's local segments.
+ *
+ * \code
+ * dash::ListQueue<task_t> tasks(nlbuf);
+ * // Any unit may append and consume tasks concurrently:
+ * tasks.push_back(task);
+ * task_t next;
+ * while (tasks.try_pop_front(next)) {
+ *   process(next);
+ * }
+ * tasks.barrier();
+ * \endcode
+ */
+template<
+  typename ElementType,
+  class    AllocatorType = dash::allocator::EpochSynchronizedAllocator<ElementType> >
+class ListQueue
+{
+  static_assert(
+    dash::is_container_compatible<ElementType>::value,
+    "Type not supported for DASH containers");
+
+private:
+  typedef ListQueue<ElementType, AllocatorType> self_t;
+
+public:
+  typedef ElementType                                             value_type;
+  typedef typename dash::default_index_t                          index_type;
+  typedef typename dash::default_size_t                            size_type;
+  typedef AllocatorType                                       allocator_type;
+
+  typedef GlobRef<value_type>                                      reference;
+  typedef GlobRef<const value_type>                          const_reference;
+
+private:
+  typedef internal::ListNode<value_type>
+    node_type;
+
+  typedef typename AllocatorType::template rebind<
+                     internal::ListNode<ElementType> >::other
+    node_allocator_type;
+
+  typedef dash::GlobHeapMem<node_type, node_allocator_type>
+    glob_mem_type;
+
+  typedef internal::ListNodeRef
+    node_ref;
+
+  typedef typename node_ref::value_type
+    node_ref_type;
+
+  typedef GlobRef<dash::Atomic<node_ref_type> >
+    atomic_node_ref;
+
+  typedef dash::Array<
+            node_ref_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
+    node_ref_map;
+
+  /// Indices of head and tail references in the queue's anchors.
+  enum anchor_index : int { Head = 0, Tail = 1 };
+
+private:
+  /// Team containing all units interacting with the queue.
+  dash::Team         * _team
+                         = nullptr;
+  /// DART id of the calling unit.
+  team_unit_t          _myid;
+  /// Number of node slots in a bucket of the node pool.
+  size_type            _local_buffer_size
+                         = 0;
+  /// Nodes of elements in the queue, allocated in buckets of
+  /// \c _local_buffer_size nodes at every unit.
+  glob_mem_type      * _node_pool
+                         = nullptr;
+  /// Number of node slots per unit in the node pool.
+  node_ref_type        _node_pool_lcap
+                         = 0;
+  /// Mapping units to their number of allocated node slots.
+  node_ref_map         _node_pool_count;
+  /// References to the sentinel node preceding the first element (head)
+  /// and to the last node (tail) of the queue.
+  node_ref_map         _anchors;
+  /// Number of elements in the queue at the last barrier.
+  size_type            _glob_size
+                         = 0;
+  /// Number of elements inserted minus number of elements removed by the
+  /// calling unit since the last barrier.
+  index_type           _glob_size_diff
+                         = 0;
+  /// Whether the calling unit modified the queue since the last barrier.
+  bool                 _modified
+                         = false;
+
+public:
+  /**
+   * Default constructor, for delayed allocation.
+   */
+  ListQueue(
+    Team & team = dash::Team::Null())
+  : _team(&team),
+    _myid(team.myid())
+  { }
+
+  /**
+   * Constructor, creates a new queue with node pool buckets of the
+   * specified number of nodes at every unit.
+   */
+  ListQueue(
+    size_type   nlbuf,
+    Team      & team  = dash::Team::All())
+  : _team(&team),
+    _myid(team.myid())
+  {
+    allocate(nlbuf, team);
+  }
+
+  ListQueue(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other)   = delete;
+
+  /**
+   * Destructor, deallocates the queue's node pool.
+   */
+  ~ListQueue()
+  {
+    deallocate();
+  }
+
+  /**
+   * Inserts a new element at the end of the queue, after its current last
+   * element. The content of \c value is copied to the inserted element.
+   * Increases the queue size by one.
+   *
+   * One-sided, lock-free operation: the element is immediately visible to
+   * all units. The element's node is allocated in the node pool of the
+   * calling unit, or of another unit if the local node pool is exhausted.
+   * Node pools are only extended in \c barrier(), nodes of removed
+   * elements are reclaimed in \c barrier() once the queue is empty.
+   *
+   * \throws  dash::exception::RuntimeError  if the node pools of all units
+   *          are exhausted
+   */
+  void push_back(const value_type & value)
+  {
+    DASH_LOG_TRACE("ListQueue.push_back()");
+    _modified = true;
+    auto node = create_node(value);
+    while (true) {
+      auto tail = atomic_node_ref(anchor_gptr(Tail)).get();
+      auto next = atomic_node_ref(link_gptr(tail)).get();
+      if (next == node_ref::nil()) {
+        if (atomic_node_ref(link_gptr(tail)).compare_exchange(
+              node_ref::nil(), node)) {
+          // Failure is harmless, another unit advanced the tail already:
+          atomic_node_ref(anchor_gptr(Tail)).compare_exchange(tail, node);
+          break;
+        }
+      } else {
+        // Tail is lagging behind or its node is being removed, move it to
+        // the successor or predecessor and retry:
+        atomic_node_ref(anchor_gptr(Tail)).compare_exchange(
+          tail, node_ref::strip(next));
+      }
+    }
+    ++_glob_size_diff;
+    DASH_LOG_TRACE("ListQueue.push_back >");
+  }
+
+  /**
+   * Removes and destroys the last element in the queue, reducing
+   * the queue size by one.
+   * Has no effect if the queue is empty.
+   *
+   * One-sided, lock-free operation.
+   * Locating the predecessor of the last element requires a traversal of
+   * the list, use \c pop_front to consume elements wherever possible.
+   */
+  void pop_back()
+  {
+    value_type value;
+    try_pop_back(value);
+  }
+
+  /**
+   * Removes the last element in the queue and copies its value to
+   * \c value.
+   *
+   * \return  \c false if the queue is empty, otherwise \c true
+   *
+   * \see pop_back
+   */
+  bool try_pop_back(value_type & value)
+  {
+    DASH_LOG_TRACE("ListQueue.try_pop_back()");
+    while (true) {
+      auto head = atomic_node_ref(anchor_gptr(Head)).get();
+      // Find last node and its predecessor:
+      auto pred = head;
+      auto last = head;
+      auto next = atomic_node_ref(link_gptr(last)).get();
+      if (node_ref::is_retired(next)) {
+        atomic_node_ref(anchor_gptr(Head)).compare_exchange(
+          head, node_ref::strip(next));
+        continue;
+      }
+      while (next != node_ref::nil() && !node_ref::is_frozen(next)) {
+        pred = last;
+        last = node_ref::strip(next);
+        next = atomic_node_ref(link_gptr(last)).get();
+      }
+      if (last == head) {
+        DASH_LOG_TRACE("ListQueue.try_pop_back >", "empty");
+        return false;
+      }
+      if (node_ref::is_frozen(next)) {
+        // Last node is being removed by another unit:
+        continue;
+      }
+      // Freeze the last node so no successor can be appended, then unlink
+      // it from its predecessor:
+      if (!atomic_node_ref(link_gptr(last)).compare_exchange(
+             node_ref::nil(), node_ref::frozen(pred))) {
+        continue;
+      }
+      if (atomic_node_ref(link_gptr(pred)).compare_exchange(
+            last, node_ref::nil())) {
+        value = static_cast<value_type>(reference(value_gptr(last)));
+        atomic_node_ref(anchor_gptr(Tail)).compare_exchange(last, pred);
+        break;
+      }
+      // Predecessor changed, last node has been removed at the front or an
+      // element has been inserted before it:
+      atomic_node_ref(link_gptr(last)).compare_exchange(
+        node_ref::frozen(pred), node_ref::nil());
+    }
+    _modified = true;
+    --_glob_size_diff;
+    DASH_LOG_TRACE("ListQueue.try_pop_back >");
+    return true;
+  }
+
+  /**
+   * Accesses the last element in the queue.
+   *
+   * \throws  dash::exception::OutOfRange  if the queue is empty
+   */
+  reference back()
+  {
+    while (true) {
+      auto head = atomic_node_ref(anchor_gptr(Head)).get();
+      auto tail = atomic_node_ref(anchor_gptr(Tail)).get();
+      auto next = atomic_node_ref(link_gptr(tail)).get();
+      if (next == node_ref::nil()) {
+        if (tail == head) {
+          DASH_THROW(dash::exception::OutOfRange,
+                     "dash::ListQueue.back: queue is empty");
+        }
+        return reference(value_gptr(tail));
+      }
+      atomic_node_ref(anchor_gptr(Tail)).compare_exchange(
+        tail, node_ref::strip(next));
+    }
+  }
+
+  /**
+   * Inserts a new element at the beginning of the queue, before its current
+   * first element. The content of \c value is copied to the inserted
+   * element.
+   * Increases the queue size by one.
+   *
+   * One-sided, lock-free operation, see \c push_back.
+   *
+   * \throws  dash::exception::RuntimeError  if the node pools of all units
+   *          are exhausted
+   */
+  void push_front(const value_type & value)
+  {
+    DASH_LOG_TRACE("ListQueue.push_front()");
+    _modified = true;
+    auto node = create_node(value);
+    while (true) {
+      auto head  = atomic_node_ref(anchor_gptr(Head)).get();
+      auto first = atomic_node_ref(link_gptr(head)).get();
+      if (node_ref::is_retired(first)) {
+        atomic_node_ref(anchor_gptr(Head)).compare_exchange(
+          head, node_ref::strip(first));
+        continue;
+      }
+      if (node_ref::is_frozen(first)) {
+        continue;
+      }
+      atomic_node_ref(link_gptr(node)).set(first);
+      if (atomic_node_ref(link_gptr(head)).compare_exchange(first, node)) {
+        break;
+      }
+    }
+    ++_glob_size_diff;
+    DASH_LOG_TRACE("ListQueue.push_front >");
+  }
+
+  /**
+   * Removes and destroys the first element in the queue, reducing
+   * the queue size by one.
+   * Has no effect if the queue is empty.
+   *
+   * One-sided, lock-free operation.
+   */
+  void pop_front()
+  {
+    value_type value;
+    try_pop_front(value);
+  }
+
+  /**
+   * Removes the first element in the queue and copies its value to
+   * \c value.
+   * Use instead of \c front and \c pop_front if elements are consumed by
+   * multiple units concurrently.
+   *
+   * \return  \c false if the queue is empty, otherwise \c true
+   *
+   * \see pop_front
+   */
+  bool try_pop_front(value_type & value)
+  {
+    DASH_LOG_TRACE("ListQueue.try_pop_front()");
+    while (true) {
+      auto head  = atomic_node_ref(anchor_gptr(Head)).get();
+      auto first = atomic_node_ref(link_gptr(head)).get();
+      if (node_ref::is_retired(first)) {
+        atomic_node_ref(anchor_gptr(Head)).compare_exchange(
+          head, node_ref::strip(first));
+        continue;
+      }
+      if (first == node_ref::nil() || node_ref::is_frozen(first)) {
+        DASH_LOG_TRACE("ListQueue.try_pop_front >", "empty");
+        return false;
+      }
+      // Element values are not modified after insertion:
+      value = static_cast<value_type>(reference(value_gptr(first)));
+      // The first element's node becomes the new sentinel node:
+      if (atomic_node_ref(link_gptr(head)).compare_exchange(
+            first, node_ref::retired(first))) {
+        atomic_node_ref(anchor_gptr(Head)).compare_exchange(head, first);
+        break;
+      }
+    }
+    _modified = true;
+    --_glob_size_diff;
+    DASH_LOG_TRACE("ListQueue.try_pop_front >");
+    return true;
+  }
+
+  /**
+   * Accesses the first element in the queue.
+   *
+   * \throws  dash::exception::OutOfRange  if the queue is empty
+   */
+  reference front()
+  {
+    while (true) {
+      auto head  = atomic_node_ref(anchor_gptr(Head)).get();
+      auto first = atomic_node_ref(link_gptr(head)).get();
+      if (node_ref::is_retired(first)) {
+        atomic_node_ref(anchor_gptr(Head)).compare_exchange(
+          head, node_ref::strip(first));
+        continue;
+      }
+      if (first == node_ref::nil() || node_ref::is_frozen(first)) {
+        DASH_THROW(dash::exception::OutOfRange,
+                   "dash::ListQueue.front: queue is empty");
+      }
+      return reference(value_gptr(first));
+    }
+  }
+
+
+  /**
+   * The size of the queue.
+   *
+   * \return  The number of elements in the queue at the last barrier,
+   *          including changes of the calling unit since then.
+   */
+  constexpr size_type size() const noexcept
+  {
+    return _glob_size + _glob_size_diff;
+  }
+
+  /**
+   * Whether the queue is empty.
+   *
+   * \return  true if \c size() is 0, otherwise false
+   */
+  constexpr bool empty() const noexcept
+  {
+    return size() == 0;
+  }
+
+  /**
+   * The team containing all units accessing this queue.
+   */
+  constexpr Team & team() const noexcept
+  {
+    return *_team;
+  }
+
+  /**
+   * Establish a barrier for all units operating on the queue.
+   * Publishes the size of the queue and extends or reclaims node pools if
+   * any unit modified the queue since the last barrier.
+   *
+   * Collective operation.
+   */
+  void barrier()
+  {
+    DASH_LOG_TRACE("ListQueue.barrier()");
+    if (_node_pool == nullptr) {
+      return;
+    }
+    int32_t modified = _modified ? 1 : 0;
+    int32_t modified_any;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&modified, &modified_any, 1,
+                     DART_TYPE_INT, DART_OP_MAX, _team->dart_id()),
+      DART_OK);
+    if (modified_any != 0) {
+      commit_nodes();
+    }
+    DASH_LOG_TRACE("ListQueue.barrier >");
+  }
+
+  /**
+   * Allocates the node pool and the sentinel node of the queue.
+   *
+   * Collective operation.
+   */
+  void allocate(
+    /// Number of node slots in a bucket of the node pool.
+    size_type    nlbuf,
+    /// Team containing all units associated with the queue.
+    dash::Team & team = dash::Team::All())
+  {
+    DASH_LOG_TRACE("ListQueue.allocate()", "nlbuf:", nlbuf);
+    DASH_ASSERT_GT(nlbuf, 0, "node pool bucket size must not be 0");
+    _team              = &team;
+    _myid              = team.myid();
+    _local_buffer_size = nlbuf;
+    _node_pool         = new glob_mem_type(_local_buffer_size, *_team);
+    _node_pool_lcap    = _local_buffer_size;
+    _node_pool_count.allocate(_team->size(), dash::BLOCKED, *_team);
+    _anchors.allocate(2, dash::BLOCKED, *_team);
+    reset_nodes();
+    _team->register_deallocator(
+             this, std::bind(&ListQueue::deallocate, this));
+    if (dash::is_initialized()) {
+      _team->barrier();
+    }
+    DASH_LOG_TRACE("ListQueue.allocate >");
+  }
+
+  /**
+   * Frees the node pool of the queue.
+   *
+   * Collective operation.
+   */
+  void deallocate()
+  {
+    DASH_LOG_TRACE("ListQueue.deallocate()");
+    if (_node_pool == nullptr) {
+      return;
+    }
+    _team->unregister_deallocator(
+      this, std::bind(&ListQueue::deallocate, this));
+    delete _node_pool;
+    _node_pool = nullptr;
+    _node_pool_count.deallocate();
+    _anchors.deallocate();
+    _glob_size      = 0;
+    _glob_size_diff = 0;
+    _modified       = false;
+    DASH_LOG_TRACE("ListQueue.deallocate >");
+  }
+
+private:
+  /**
+   * Releases all nodes in the node pool and resets the queue to a
+   * single sentinel node in the first slot of unit 0.
+   * Must only be called while no unit accesses the queue.
+   */
+  void reset_nodes()
+  {
+    auto sentinel = node_ref::make(0, 0);
+    if (_myid == 0) {
+      auto sentinel_node = static_cast<node_type *>(_node_pool->lbegin());
+      sentinel_node->gnext_ref = node_ref::nil();
+      _node_pool_count.local[0] = 1;
+    } else {
+      _node_pool_count.local[0] = 0;
+    }
+    std::fill(_anchors.lbegin(), _anchors.lend(), sentinel);
+    _glob_size      = 0;
+    _glob_size_diff = 0;
+  }
+
+  /**
+   * Publishes the size of the queue, reclaims the node pool if the
+   * queue is empty and extends the node pool of every unit if more than half
+   * of the node slots of any unit are in use.
+   *
+   * Collective operation.
+   */
+  void commit_nodes()
+  {
+    DASH_LOG_TRACE("ListQueue.commit_nodes()");
+    // Complete operations of all units on the queue:
+    _team->barrier();
+    _modified = false;
+    int64_t size_diff = _glob_size_diff;
+    int64_t size_sum;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&size_diff, &size_sum, 1,
+                     DART_TYPE_LONGLONG, DART_OP_SUM, _team->dart_id()),
+      DART_OK);
+    // Failed allocations also increment node counters, the maximum counter
+    // value is the largest demand of any unit:
+    int64_t node_count = _node_pool_count.local[0];
+    int64_t node_count_max;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&node_count, &node_count_max, 1,
+                     DART_TYPE_LONGLONG, DART_OP_MAX, _team->dart_id()),
+      DART_OK);
+    _glob_size     += size_sum;
+    _glob_size_diff = 0;
+    DASH_LOG_TRACE_VAR("ListQueue.commit_nodes", _glob_size);
+    DASH_LOG_TRACE_VAR("ListQueue.commit_nodes", node_count_max);
+    if (_glob_size == 0) {
+      // No node is referenced, all slots can be reused:
+      reset_nodes();
+    } else if (node_count > _node_pool_lcap) {
+      _node_pool_count.local[0] = _node_pool_lcap;
+    }
+    if (2 * node_count_max > _node_pool_lcap) {
+      // Node slots are mapped to buckets of identical size, all units grow
+      // their node pool by the same number of buckets:
+      node_ref_type lcap_new = std::max<node_ref_type>(
+                                 2 * _node_pool_lcap, 2 * node_count_max);
+      auto nbuckets = dash::math::div_ceil(
+                        lcap_new - _node_pool_lcap,
+                        static_cast<node_ref_type>(_local_buffer_size));
+      DASH_LOG_TRACE("ListQueue.commit_nodes", "growing node pool by",
+                     nbuckets, "buckets");
+      for (decltype(nbuckets) b = 0; b < nbuckets; ++b) {
+        _node_pool->grow(_local_buffer_size);
+      }
+      _node_pool->commit();
+      _node_pool_lcap += nbuckets * _local_buffer_size;
+    }
+    _team->barrier();
+    DASH_LOG_TRACE("ListQueue.commit_nodes >", "node pool capacity:",
+                   _node_pool_lcap);
+  }
+
+  /**
+   * Allocates a node in the queue and initializes it with the given
+   * value.
+   * Nodes are allocated in the calling unit's node pool or, if it is
+   * exhausted, in the node pool of the next unit with free node slots.
+   */
+  node_ref_type create_node(const value_type & value)
+  {
+    auto nunits = _team->size();
+    for (size_type u = 0; u < nunits; ++u) {
+      dart_unit_t unit = (_myid.id + u) % nunits;
+      auto slot = atomic_node_ref(
+                    (_node_pool_count.begin() + unit).dart_gptr()
+                  ).fetch_add(1);
+      if (slot < _node_pool_lcap) {
+        auto node = node_ref::make(unit, slot);
+        reference(value_gptr(node)) = value;
+        atomic_node_ref(link_gptr(node)).set(node_ref::nil());
+        return node;
+      }
+    }
+    DASH_THROW(dash::exception::RuntimeError,
+               "dash::ListQueue: node pools of all units exhausted, "
+               "call barrier() to extend node pools");
+  }
+
+  /**
+   * Global pointer to the node referenced by \c node, offset by the given
+   * number of bytes.
+   */
+  dart_gptr_t node_gptr(node_ref_type node, size_t offset) const
+  {
+    auto slot = node_ref::slot(node);
+    auto gptr = _node_pool->dart_gptr_at(
+                  team_unit_t(node_ref::unit(node)),
+                  slot / _local_buffer_size,
+                  slot % _local_buffer_size);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr, offset),
+      DART_OK);
+    return gptr;
+  }
+
+  /**
+   * Global pointer to the value of the node referenced by \c node.
+   */
+  dart_gptr_t value_gptr(node_ref_type node) const
+  {
+    return node_gptr(node, offsetof(node_type, value));
+  }
+
+  /**
+   * Global pointer to the link to the successor of the node referenced by
+   * \c node.
+   */
+  dart_gptr_t link_gptr(node_ref_type node) const
+  {
+    return node_gptr(node, offsetof(node_type, gnext_ref));
+  }
+
+  /**
+   * Global pointer to the head or tail reference of the queue.
+   */
+  dart_gptr_t anchor_gptr(anchor_index anchor) const
+  {
+    return (_anchors.begin() + static_cast<int>(anchor)).dart_gptr();
+  }
+};
+
+} // namespace dash
+
+#endif // DASH__LIST__LIST_QUEUE_H__INCLUDED
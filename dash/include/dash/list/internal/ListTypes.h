@@ -3,6 +3,8 @@
 
 #include <dash/dart/if/dart_types.h>
 
+#include <cstdint>
+
 namespace dash {
 namespace internal {
 
@@ -18,6 +20,76 @@ public:
   self_t     * lnext = nullptr;
   dart_gptr_t  gprev = DART_GPTR_NULL;
   dart_gptr_t  gnext = DART_GPTR_NULL;
+  /// Link to the successor of the node in the global list as packed
+  /// node reference, see \c ListNodeRef.
+  /// Only accessed in atomic operations.
+  int64_t      gnext_ref = 0;
+};
+
+/**
+ * Reference to a node of the global list, packed in a 64 bit integer so
+ * links between nodes can be modified in a single atomic compare-and-swap
+ * operation.
+ *
+ * A reference encodes the unit owning the node and the node's slot in the
+ * unit's node pool. Links of nodes removed from the list are flagged:
+ *
+ * - \c retired: the node has been removed at the front of the list, the
+ *   link refers to the node's successor which is the new list head.
+ * - \c frozen: the last node is being removed at the back of the list, the
+ *   link refers to the node's predecessor.
+ */
+struct ListNodeRef
+{
+  typedef int64_t value_type;
+
+  static constexpr value_type nil() noexcept
+  {
+    return 0;
+  }
+
+  static constexpr value_type make(dart_unit_t unit, value_type slot)
+  {
+    return ((static_cast<value_type>(unit) + 1) << 32) | slot;
+  }
+
+  static constexpr dart_unit_t unit(value_type ref)
+  {
+    return static_cast<dart_unit_t>((strip(ref) >> 32) - 1);
+  }
+
+  static constexpr value_type slot(value_type ref)
+  {
+    return ref & 0xffffffffLL;
+  }
+
+  static constexpr value_type retired(value_type ref)
+  {
+    return ref | (value_type(1) << 62);
+  }
+
+  static constexpr value_type frozen(value_type ref)
+  {
+    return ref | (value_type(1) << 61);
+  }
+
+  static constexpr bool is_retired(value_type link)
+  {
+    return (link & (value_type(1) << 62)) != 0;
+  }
+
+  static constexpr bool is_frozen(value_type link)
+  {
+    return (link & (value_type(1) << 61)) != 0;
+  }
+
+  /**
+   * Node reference in a link, without flags.
+   */
+  static constexpr value_type strip(value_type link)
+  {
+    return link & ~((value_type(1) << 62) | (value_type(1) << 61));
+  }
 };
 
 } // namespace internal
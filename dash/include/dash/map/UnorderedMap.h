@@ -21,6 +21,7 @@
 #include <utility>
 #include <limits>
 #include <vector>
+#include <unordered_set>
 #include <functional>
 #include <algorithm>
 #include <cstddef>
@@ -168,6 +169,26 @@ public:
             size_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
     local_sizes_map;
 
+private:
+  /**
+   * Slot in the open-addressing index of local elements.
+   */
+  typedef struct {
+    key_type  key;
+    /// Local offset of the element plus one, 0 if the slot is empty.
+    size_type lidx;
+  } index_slot_type;
+
+  typedef dash::Array<index_slot_type>                  index_table_type;
+
+  /**
+   * Unit and local offset of an element, index is -1 if not found.
+   */
+  typedef struct {
+    team_unit_t unit;
+    index_type  index;
+  } local_pos_type;
+
 private:
   /// Team containing all units interacting with the map.
   dash::Team           * _team            = nullptr;
@@ -189,9 +210,38 @@ private:
   local_sizes_map        _local_sizes;
   /// Cumulative (postfix sum) local sizes of all units.
   std::vector<size_type> _local_cumul_sizes;
-  /// Iterators to elements in local memory space that are marked for move
-  /// to remote unit in next commit.
-  std::vector<iterator>  _move_elements;
+  /// Local sizes of all units as exchanged in the last commit.
+  std::vector<size_type> _commit_local_sizes;
+  /// Open-addressing index of local elements, maps keys to local offsets.
+  std::vector<index_slot_type>  _lindex;
+  /// Number of occupied slots in the local index.
+  size_type                     _lindex_size     = 0;
+  /// Local indices of all units as published in the last commit, for
+  /// lookups of keys at remote units.
+  index_table_type              _gindex;
+  /// Number of slots of every unit's published index.
+  size_type                     _gindex_capacity = 0;
+  /// Bloom filters of keys of all units as published in the last commit,
+  /// containing the keys of elements that are not stored at the unit
+  /// mapped to the key by the hash function.
+  std::vector<uint64_t>         _gfilter;
+  /// Number of words of every unit's published key filter, 0 if no unit
+  /// stores elements outside of their hash unit.
+  size_type                     _gfilter_words   = 0;
+  /// Keys of elements staged at remote units by this unit since the last
+  /// commit.
+  std::unordered_set<key_type, std::hash<key_type>, key_equal>
+                                _pending_keys;
+  /// Staging buffers for elements inserted at this unit by remote units,
+  /// moved to local memory in next commit.
+  dart_gptr_t                   _inbox_gptr      = DART_GPTR_NULL;
+  /// Capacity of every unit's staging buffer.
+  size_type                     _inbox_capacity  = 0;
+  /// Number of elements in the staging buffer of every unit.
+  local_sizes_map               _inbox_sizes;
+  /// Elements inserted at remote units that did not fit into the remote
+  /// staging buffers, indexed by target unit.
+  std::vector<std::vector<value_type>> _inbox_overflow;
   /// Global pointer to local element in _local_sizes.
   dart_gptr_t            _local_size_gptr = DART_GPTR_NULL;
   /// Hash type for mapping of key to unit and local offset.
@@ -273,22 +323,41 @@ public:
   void barrier()
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.barrier()", _team->dart_id());
+    // Move elements inserted by remote units to local memory:
+    _commit_inbox();
+    _pending_keys.clear();
+    // Local size is final at this point, exchange local sizes and number
+    // of keys stored outside of their hash unit of all units while
+    // committing changes to global memory:
+    std::vector<size_type> local_sizes(2 * _team->size());
+    local_sizes[2 * _myid]     = _local_sizes.local[0];
+    local_sizes[2 * _myid + 1] = _lindex_nfiltered();
+    dart_handle_t sizes_handle;
+    DASH_ASSERT_RETURNS(
+      dart_iallgather(
+        local_sizes.data(),
+        local_sizes.data(),
+        2,
+        dash::dart_datatype<size_type>::value,
+        _team->dart_id(),
+        &sizes_handle),
+      DART_OK);
     // Apply changes in local memory spaces to global memory space:
     if (_globmem != nullptr) {
       _globmem->commit();
     }
+    DASH_ASSERT_RETURNS(dart_wait(sizes_handle), DART_OK);
     // Accumulate local sizes of remote units:
-    _local_sizes.barrier();
     _remote_size = 0;
+    size_type max_nfiltered = 0;
     for (int u = 0; u < _team->size(); ++u) {
-      size_type local_size_u;
+      size_type local_size_u = local_sizes[2 * u];
+      max_nfiltered = std::max(max_nfiltered, local_sizes[2 * u + 1]);
       if (u != _myid) {
-        local_size_u = _local_sizes[u];
         _remote_size += local_size_u;
-      } else {
-        local_size_u = _local_sizes.local[0];
       }
-      _local_cumul_sizes[u] = local_size_u;
+      _local_cumul_sizes[u]  = local_size_u;
+      _commit_local_sizes[u] = local_size_u;
       if (u > 0) {
         _local_cumul_sizes[u] += _local_cumul_sizes[u-1];
       }
@@ -302,6 +371,9 @@ public:
                    "invalid size after global commit");
     _begin = iterator(this, 0);
     _end   = iterator(this, new_size);
+    // Publish local index for key lookups of remote units:
+    _publish_index();
+    _publish_filter(max_nfiltered);
     DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
   }
 
@@ -324,7 +396,8 @@ public:
       DASH_LOG_TRACE("UnorderedMap.allocate",
                      "initializing with initial team");
     }
-    _local_cumul_sizes = std::vector<size_type>(_team->size(), 0);
+    _local_cumul_sizes  = std::vector<size_type>(_team->size(), 0);
+    _commit_local_sizes = std::vector<size_type>(_team->size(), 0);
     DASH_ASSERT_GT(_local_buffer_size, 0, "local buffer size must not be 0");
     if (nelem < _team->size() * _local_buffer_size) {
       nelem = _team->size() * _local_buffer_size;
@@ -346,6 +419,21 @@ public:
     _local_sizes.local[0] = 0;
     _local_size_gptr      = _local_sizes[_myid].dart_gptr();
 
+    // Staging buffers for remote insertion, capacity is increased in
+    // commit if exceeded:
+    _inbox_sizes.allocate(_team->size(), dash::BLOCKED, *_team);
+    _inbox_sizes.local[0] = 0;
+    _inbox_overflow       = std::vector<std::vector<value_type>>(
+                              _team->size());
+    _allocate_inbox(4096 / sizeof(value_type) + 1);
+
+    _lindex.clear();
+    _lindex_size          = 0;
+    _gindex_capacity      = 0;
+    _gfilter.clear();
+    _gfilter_words        = 0;
+    _pending_keys.clear();
+
     // Global iterators:
     _begin       = iterator(this, 0);
     _end         = _begin;
@@ -390,7 +478,18 @@ public:
       delete _globmem;
       _globmem = nullptr;
     }
+    if (!DART_GPTR_ISNULL(_inbox_gptr)) {
+      DASH_ASSERT_RETURNS(dart_team_memfree(_inbox_gptr), DART_OK);
+      _inbox_gptr = DART_GPTR_NULL;
+    }
+    _inbox_capacity       = 0;
+    _lindex.clear();
+    _lindex_size          = 0;
+    _gfilter.clear();
+    _gfilter_words        = 0;
+    _pending_keys.clear();
     _local_cumul_sizes    = std::vector<size_type>(_team->size(), 0);
+    _commit_local_sizes   = std::vector<size_type>(_team->size(), 0);
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
     _begin                = iterator();
@@ -506,12 +605,34 @@ public:
   // Element Access
   //////////////////////////////////////////////////////////////////////////
 
+  /**
+   * Reference to the mapped value of the element with the given key,
+   * inserts an element with default-constructed mapped value if the map
+   * does not contain an element with an equivalent key.
+   *
+   * New elements are inserted in local memory even if the hash function
+   * maps their key to a remote unit, as a reference to the element is
+   * required immediately. Remote units find these elements after the
+   * next commit (\c barrier).
+   *
+   * \throws  dash::exception::RuntimeError  if an element with the given
+   *          key has been staged at a remote unit by \c insert since the
+   *          last commit.
+   */
   mapped_type_reference operator[](const key_type & key)
   {
     DASH_LOG_TRACE("UnorderedMap.[]()", "key:", key);
-    iterator      git_value   = insert(
-                                   std::make_pair(key, mapped_type()))
-                                .first;
+    iterator      git_value   = find(key);
+    if (git_value == _end) {
+      if (_pending_keys.count(key) > 0) {
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "Element for key " << key << " is inserted at remote unit " <<
+          "in next commit");
+      }
+      git_value = _insert_at(_myid, std::make_pair(key, mapped_type()))
+                  .first;
+    }
     DASH_LOG_TRACE_VAR("UnorderedMap.[]", git_value);
     dart_gptr_t   gptr_mapped = git_value.dart_gptr();
     value_type  * lptr_value  = static_cast<value_type *>(
@@ -581,14 +702,26 @@ public:
     return nelem;
   }
 
+  /**
+   * Finds the element with the given key.
+   *
+   * Keys are looked up in the local index first. Keys mapped to a remote
+   * unit by the hash function are then looked up in the index of that
+   * unit as published in the last commit, requiring a single remote read
+   * per probed slot.
+   * Elements stored outside of the unit mapped to their key, like all
+   * elements for \c dash::HashLocal, are registered in a key filter of
+   * their unit that is exchanged in every commit. The published index of
+   * a unit is only probed for these keys if its key filter contains the
+   * key.
+   */
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    auto     lpos  = _find_lpos(key);
+    iterator found = (lpos.index < 0)
+                     ? _end
+                     : iterator(this, lpos.unit, lpos.index);
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
@@ -596,19 +729,60 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
+    auto           lpos  = _find_lpos(key);
+    const_iterator found = (lpos.index < 0)
+                           ? _end
+                           : const_iterator(const_cast<self_t *>(this),
+                                            lpos.unit, lpos.index);
     DASH_LOG_TRACE("UnorderedMap.find const >", found);
     return found;
   }
 
+  /**
+   * Finds the elements with the keys in the range \c [first, last) and
+   * writes an iterator to every element, or \c end() if the key is not
+   * found, to \c out.
+   *
+   * Keys are looked up in the local index first. Probes of the remaining
+   * keys in the published indices of remote units are combined in a
+   * single indexed transfer per unit and probing round.
+   *
+   * \return  Output iterator past the last iterator written.
+   */
+  template<class KeyInputIterator, class OutputIterator>
+  OutputIterator find_many(
+    KeyInputIterator first,
+    KeyInputIterator last,
+    OutputIterator   out)
+  {
+    DASH_LOG_TRACE("UnorderedMap.find_many()");
+    std::vector<key_type>       keys(first, last);
+    std::vector<local_pos_type> lpos(keys.size());
+    _find_lpos_many(keys, lpos);
+    for (const auto & pos : lpos) {
+      *out = (pos.index < 0) ? _end : iterator(this, pos.unit, pos.index);
+      ++out;
+    }
+    DASH_LOG_TRACE("UnorderedMap.find_many >", "keys:", keys.size());
+    return out;
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // Modifiers
   //////////////////////////////////////////////////////////////////////////
 
+  /**
+   * Inserts an element if the map does not contain an element with an
+   * equivalent key.
+   *
+   * Elements mapped to a remote unit by the hash function are staged at
+   * the remote unit and inserted there in the next commit (\c barrier).
+   * In this case, no iterator to the element exists before the next
+   * commit and the returned iterator is \c end(). The returned flag is
+   * \c false if an element with an equivalent key has already been
+   * staged by this unit since the last commit, elements with equivalent
+   * keys staged by different units are discarded in the next commit.
+   */
   std::pair<iterator, bool> insert(
     /// The element to insert.
     const value_type & value)
@@ -635,7 +809,13 @@ public:
       auto unit = _key_hash(key);
       DASH_LOG_TRACE("UnorderedMap.insert", "target unit:", unit);
       // No element with specified key exists, insert new value.
-      result = _insert_at(unit, value);
+      if (unit == _myid) {
+        result = _insert_at(unit, value);
+      } else if (_pending_keys.insert(key).second) {
+        // Element is moved to target unit in next commit:
+        _insert_remote(unit, value);
+        result.second = true;
+      }
     }
     DASH_LOG_DEBUG("UnorderedMap.insert >",
                    (result.second ? "inserted" : "existing"), ":",
@@ -643,6 +823,17 @@ public:
     return result;
   }
 
+  /**
+   * Inserts elements in the range \c [first, last) for which the map
+   * does not contain an element with an equivalent key.
+   *
+   * Elements are grouped by the unit mapped to their key by the hash
+   * function. Every group of elements mapped to a remote unit is staged
+   * at the remote unit in a single transfer, elements mapped to the
+   * local unit are inserted while these transfers are in flight.
+   * As for \c insert(value), remote elements are inserted in the next
+   * commit (\c barrier).
+   */
   template<class InputIterator>
   void insert(
     // Iterator at first value in the range to insert.
@@ -650,13 +841,38 @@ public:
     // Iterator past the last value in the range to insert.
     InputIterator last)
   {
-    // TODO: Calling insert() on every single element in the range could cause
-    //       multiple calls of globmem.grow(_local_buffer_size).
-    //       Could be optimized to allocate additional memory in a single call
-    //       of globmem.grow(std::distance(first,last)).
+    DASH_LOG_TRACE("UnorderedMap.insert(first,last)");
+    DASH_ASSERT(_globmem != nullptr);
+    auto nunits = _team->size();
+    std::vector<std::vector<value_type>> buckets(nunits);
     for (auto it = first; it != last; ++it) {
-      insert(*it);
+      const value_type & value = *it;
+      auto unit = _key_hash(value.first);
+      if (unit == _myid || _pending_keys.insert(value.first).second) {
+        buckets[unit].push_back(value);
+      }
+    }
+    size_type nstaged = 0;
+    for (size_type u = 1; u < nunits; ++u) {
+      // Start with the succeeding unit to spread concurrent transfers of
+      // all units:
+      team_unit_t unit((_myid.id + u) % nunits);
+      if (!buckets[unit].empty()) {
+        nstaged += _insert_remote_async(
+                     unit, buckets[unit].data(), buckets[unit].size());
+      }
+    }
+    // Insert local elements while transfers to remote units are in flight:
+    for (const auto & value : buckets[_myid]) {
+      if (_lindex_find(value.first) < 0) {
+        _insert_at(_myid, value);
+      }
     }
+    if (nstaged > 0) {
+      DASH_ASSERT_RETURNS(dart_flush_all(_inbox_gptr), DART_OK);
+    }
+    DASH_LOG_TRACE("UnorderedMap.insert(first,last) >",
+                   "staged:", nstaged);
   }
 
   iterator erase(
@@ -696,10 +912,17 @@ public:
     return _key_hash(key);
   }
 
+  /**
+   * Number of elements in the bucket with the given index, i.e. at the
+   * unit with the given id. Sizes of remote buckets are the sizes as of
+   * the last commit (\c barrier).
+   */
   inline size_type bucket_size(size_type bucket_index) const
   {
-    size_type   bsize = _local_sizes[bucket_index];
-    return bsize;
+    if (bucket_index == static_cast<size_type>(_myid.id)) {
+      return lsize();
+    }
+    return _commit_local_sizes[bucket_index];
   }
 
   //////////////////////////////////////////////////////////////////////////
@@ -781,7 +1004,593 @@ private:
   }
 
   /**
-   * Insert value at specified unit.
+   * Hash value of a key for slot positions in the local index.
+   * Bits are mixed as hash functions like \c std::hash<int> are
+   * identities and keys mapped to the same unit often share their
+   * lower bits.
+   */
+  static size_type _slot_hash(const key_type & key)
+  {
+    uint64_t h = std::hash<key_type>()(key);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<size_type>(h);
+  }
+
+  /**
+   * Rebuilds the local index with the given number of slots, must be a
+   * power of two.
+   */
+  void _lindex_rehash(size_type capacity)
+  {
+    DASH_LOG_TRACE("UnorderedMap._lindex_rehash()", "capacity:", capacity);
+    std::vector<index_slot_type> slots(capacity);
+    size_type mask = capacity - 1;
+    for (auto & slot : slots) {
+      slot.lidx = 0;
+    }
+    for (const auto & slot : _lindex) {
+      if (slot.lidx == 0) {
+        continue;
+      }
+      size_type pos = _slot_hash(slot.key) & mask;
+      while (slots[pos].lidx != 0) {
+        pos = (pos + 1) & mask;
+      }
+      slots[pos] = slot;
+    }
+    _lindex.swap(slots);
+  }
+
+  /**
+   * Adds a local element to the local index, load factor is kept at or
+   * below 0.5.
+   */
+  void _lindex_insert(const key_type & key, size_type lidx)
+  {
+    if (2 * (_lindex_size + 1) > _lindex.size()) {
+      _lindex_rehash(std::max<size_type>(16, 2 * _lindex.size()));
+    }
+    size_type mask = _lindex.size() - 1;
+    size_type pos  = _slot_hash(key) & mask;
+    while (_lindex[pos].lidx != 0) {
+      pos = (pos + 1) & mask;
+    }
+    index_slot_type slot;
+    slot.key     = key;
+    slot.lidx    = lidx + 1;
+    _lindex[pos] = slot;
+    ++_lindex_size;
+  }
+
+  /**
+   * Local offset of the local element with the given key, -1 if not found.
+   */
+  index_type _lindex_find(const key_type & key) const
+  {
+    if (_lindex_size == 0) {
+      return -1;
+    }
+    size_type mask = _lindex.size() - 1;
+    for (size_type pos = _slot_hash(key) & mask; ;
+         pos = (pos + 1) & mask) {
+      const index_slot_type & slot = _lindex[pos];
+      if (slot.lidx == 0) {
+        return -1;
+      }
+      if (_key_equal(slot.key, key)) {
+        return static_cast<index_type>(slot.lidx - 1);
+      }
+    }
+  }
+
+  /**
+   * Local offset of the element with the given key at the specified
+   * remote unit as published in the last commit, -1 if not found.
+   * Every probed slot is a single remote read.
+   */
+  index_type _gindex_find(team_unit_t unit, const key_type & key) const
+  {
+    if (_gindex_capacity == 0) {
+      return -1;
+    }
+    size_type mask   = _gindex_capacity - 1;
+    size_type offset = unit.id * _gindex_capacity;
+    size_type pos    = _slot_hash(key) & mask;
+    for (size_type probe = 0; probe < _gindex_capacity; ++probe) {
+      index_slot_type slot = _gindex[offset + pos];
+      if (slot.lidx == 0) {
+        return -1;
+      }
+      if (_key_equal(slot.key, key)) {
+        return static_cast<index_type>(slot.lidx - 1);
+      }
+      pos = (pos + 1) & mask;
+    }
+    return -1;
+  }
+
+  /**
+   * Whether elements are stored at the unit that inserted them.
+   */
+  static constexpr bool _is_hash_local()
+  {
+    return std::is_same< hasher, dash::HashLocal<key_type> >::value;
+  }
+
+  /**
+   * Whether the local element with the given key is registered in the
+   * key filter, i.e. cannot be found at the unit mapped to the key by
+   * the hash function.
+   */
+  bool _is_filtered(const key_type & key) const
+  {
+    if (_is_hash_local()) {
+      return true;
+    }
+    hasher key_hash = _key_hash;
+    return key_hash(key) != _myid;
+  }
+
+  /**
+   * Number of local elements registered in the key filter.
+   */
+  size_type _lindex_nfiltered() const
+  {
+    size_type nfiltered = 0;
+    for (const auto & slot : _lindex) {
+      if (slot.lidx != 0 && _is_filtered(slot.key)) {
+        ++nfiltered;
+      }
+    }
+    return nfiltered;
+  }
+
+  /**
+   * Bit positions of a key in a key filter with the given number of bits,
+   * must be a power of two.
+   */
+  static std::pair<size_type, size_type> _filter_bits(
+    const key_type & key,
+    size_type        nbits)
+  {
+    // Lower bits of the slot hash determine the index slot, use upper
+    // bits for filter positions:
+    uint64_t h  = _slot_hash(key);
+    uint64_t h2 = h * 0x9e3779b97f4a7c15ULL;
+    return std::make_pair(static_cast<size_type>(h  >> 32) & (nbits - 1),
+                          static_cast<size_type>(h2 >> 32) & (nbits - 1));
+  }
+
+  /**
+   * Whether the key filter of the given unit as published in the last
+   * commit contains the key. False positives are possible.
+   */
+  bool _gfilter_contains(team_unit_t unit, const key_type & key) const
+  {
+    const uint64_t * words = _gfilter.data() + unit.id * _gfilter_words;
+    auto bits = _filter_bits(key, _gfilter_words * 64);
+    return (words[bits.first  / 64] & (1ULL << (bits.first  % 64))) &&
+           (words[bits.second / 64] & (1ULL << (bits.second % 64)));
+  }
+
+  /**
+   * Unit and local offset of the element with the given key.
+   */
+  local_pos_type _find_lpos(const key_type & key) const
+  {
+    local_pos_type lpos;
+    lpos.unit  = _myid;
+    lpos.index = _lindex_find(key);
+    if (lpos.index >= 0) {
+      return lpos;
+    }
+    hasher      key_hash = _key_hash;
+    team_unit_t owner    = _is_hash_local() ? _myid : key_hash(key);
+    if (owner != _myid) {
+      lpos.unit  = owner;
+      lpos.index = _gindex_find(owner, key);
+      if (lpos.index >= 0) {
+        return lpos;
+      }
+    }
+    if (_gfilter_words == 0) {
+      return lpos;
+    }
+    // Key might be stored outside of its hash unit:
+    auto nunits = _team->size();
+    for (size_type u = 1; u < nunits; ++u) {
+      team_unit_t unit((_myid.id + u) % nunits);
+      if (unit != owner && _gfilter_contains(unit, key)) {
+        lpos.unit  = unit;
+        lpos.index = _gindex_find(unit, key);
+        if (lpos.index >= 0) {
+          return lpos;
+        }
+      }
+    }
+    return lpos;
+  }
+
+  /**
+   * Units to probe for a key that is not contained in the local index,
+   * in probing order.
+   */
+  void _probe_units(
+    const key_type           & key,
+    std::vector<team_unit_t> & units) const
+  {
+    units.clear();
+    hasher      key_hash = _key_hash;
+    team_unit_t owner    = _is_hash_local() ? _myid : key_hash(key);
+    if (owner != _myid) {
+      units.push_back(owner);
+    }
+    if (_gfilter_words == 0) {
+      return;
+    }
+    auto nunits = _team->size();
+    for (size_type u = 1; u < nunits; ++u) {
+      team_unit_t unit((_myid.id + u) % nunits);
+      if (unit != owner && _gfilter_contains(unit, key)) {
+        units.push_back(unit);
+      }
+    }
+  }
+
+  /**
+   * Unit and local offset of the elements with the given keys.
+   * Keys not found in the local index are probed in the published index
+   * of remote units in rounds, with one indexed transfer per unit and
+   * round.
+   */
+  void _find_lpos_many(
+    const std::vector<key_type>   & keys,
+    std::vector<local_pos_type>   & lpos)
+  {
+    typedef struct {
+      /// Offset of the key in keys.
+      size_type kidx;
+      /// Slot in the published index of the probed unit.
+      size_type pos;
+      /// Number of slots probed at the unit.
+      size_type nprobes;
+      /// Offset of the probed unit in the key's probe units.
+      size_type nunit;
+    } probe_type;
+
+    auto nunits     = _team->size();
+    size_type mask  = _gindex_capacity - 1;
+    std::vector<std::vector<probe_type>>  probes(nunits);
+    std::vector<std::vector<team_unit_t>> probe_units(keys.size());
+    for (size_type k = 0; k < keys.size(); ++k) {
+      lpos[k].unit  = _myid;
+      lpos[k].index = _lindex_find(keys[k]);
+      if (lpos[k].index >= 0 || _gindex_capacity == 0) {
+        continue;
+      }
+      _probe_units(keys[k], probe_units[k]);
+      if (!probe_units[k].empty()) {
+        probes[probe_units[k][0]].push_back(
+          { k, _slot_hash(keys[k]) & mask, 0, 0 });
+      }
+    }
+    std::vector<std::vector<index_slot_type>> slots(nunits);
+    std::vector<std::vector<size_t>>          displs(nunits);
+    std::vector<size_t>                       blocklens;
+    std::vector<dart_handle_t>                handles;
+    for (;;) {
+      handles.clear();
+      size_type max_probes = 0;
+      for (size_type u = 0; u < nunits; ++u) {
+        max_probes = std::max<size_type>(max_probes, probes[u].size());
+      }
+      if (max_probes == 0) {
+        break;
+      }
+      blocklens.resize(max_probes, sizeof(index_slot_type));
+      for (size_type u = 0; u < nunits; ++u) {
+        auto nprobes = probes[u].size();
+        if (nprobes == 0) {
+          continue;
+        }
+        slots[u].resize(nprobes);
+        displs[u].resize(nprobes);
+        for (size_type p = 0; p < nprobes; ++p) {
+          displs[u][p] = probes[u][p].pos * sizeof(index_slot_type);
+        }
+        dart_gptr_t gptr = (_gindex.begin() + u * _gindex_capacity)
+                             .dart_gptr();
+        dart_handle_t handle;
+        DASH_ASSERT_RETURNS(
+          dart_get_indexed_handle(
+            slots[u].data(),
+            gptr,
+            nprobes,
+            blocklens.data(),
+            displs[u].data(),
+            DART_TYPE_BYTE,
+            &handle),
+          DART_OK);
+        handles.push_back(handle);
+      }
+      DASH_ASSERT_RETURNS(
+        dart_waitall(handles.data(), handles.size()),
+        DART_OK);
+      // Keys that are neither found nor known to be absent are probed at
+      // the next slot, or at the next of their probe units:
+      std::vector<std::vector<probe_type>> next_probes(nunits);
+      for (size_type u = 0; u < nunits; ++u) {
+        for (size_type p = 0; p < probes[u].size(); ++p) {
+          const auto            & probe = probes[u][p];
+          const index_slot_type & slot  = slots[u][p];
+          if (slot.lidx != 0 && _key_equal(slot.key, keys[probe.kidx])) {
+            lpos[probe.kidx].unit  = team_unit_t(u);
+            lpos[probe.kidx].index = static_cast<index_type>(slot.lidx - 1);
+          } else if (slot.lidx != 0 &&
+                     probe.nprobes + 1 < _gindex_capacity) {
+            next_probes[u].push_back(
+              { probe.kidx, (probe.pos + 1) & mask, probe.nprobes + 1,
+                probe.nunit });
+          } else if (probe.nunit + 1 < probe_units[probe.kidx].size()) {
+            team_unit_t unit = probe_units[probe.kidx][probe.nunit + 1];
+            next_probes[unit].push_back(
+              { probe.kidx, _slot_hash(keys[probe.kidx]) & mask, 0,
+                probe.nunit + 1 });
+          }
+        }
+      }
+      probes.swap(next_probes);
+    }
+  }
+
+  /**
+   * Publishes the local index in global memory. Collective operation,
+   * expects local sizes of all units to be synchronized.
+   */
+  void _publish_index()
+  {
+    DASH_LOG_TRACE("UnorderedMap._publish_index()");
+    size_type max_lsize = 0;
+    for (size_type u = 0; u < _team->size(); ++u) {
+      size_type lsize_u = _local_cumul_sizes[u] -
+                          (u > 0 ? _local_cumul_sizes[u-1] : 0);
+      max_lsize = std::max(max_lsize, lsize_u);
+    }
+    // Capacity of published index tables is identical at all units:
+    size_type capacity = 16;
+    while (capacity < 2 * max_lsize) {
+      capacity *= 2;
+    }
+    if (capacity > _gindex_capacity) {
+      DASH_LOG_TRACE("UnorderedMap._publish_index", "reallocate",
+                     "capacity:", capacity);
+      if (_gindex_capacity > 0) {
+        _gindex.deallocate();
+      }
+      _gindex.allocate(capacity * _team->size(), dash::BLOCKED, *_team);
+      _gindex_capacity = capacity;
+    }
+    if (_lindex.size() != _gindex_capacity) {
+      _lindex_rehash(_gindex_capacity);
+    }
+    std::copy(_lindex.begin(), _lindex.end(), _gindex.lbegin());
+    _gindex.barrier();
+    DASH_LOG_TRACE("UnorderedMap._publish_index >");
+  }
+
+  /**
+   * Exchanges the key filters of all units. Collective operation,
+   * expects the maximum number of filtered keys at any unit.
+   */
+  void _publish_filter(size_type max_nfiltered)
+  {
+    DASH_LOG_TRACE("UnorderedMap._publish_filter()",
+                   "max. keys:", max_nfiltered);
+    _gfilter_words = 0;
+    _gfilter.clear();
+    if (max_nfiltered == 0) {
+      return;
+    }
+    // At least 16 bits per key for a false positive rate below 2%:
+    size_type nwords = 1;
+    while (nwords * 64 < 16 * max_nfiltered) {
+      nwords *= 2;
+    }
+    _gfilter.resize(nwords * _team->size(), 0);
+    uint64_t * lwords = _gfilter.data() + _myid.id * nwords;
+    for (const auto & slot : _lindex) {
+      if (slot.lidx != 0 && _is_filtered(slot.key)) {
+        auto bits = _filter_bits(slot.key, nwords * 64);
+        lwords[bits.first  / 64] |= (1ULL << (bits.first  % 64));
+        lwords[bits.second / 64] |= (1ULL << (bits.second % 64));
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        _gfilter.data(),
+        _gfilter.data(),
+        nwords * sizeof(uint64_t),
+        DART_TYPE_BYTE,
+        _team->dart_id()),
+      DART_OK);
+    _gfilter_words = nwords;
+    DASH_LOG_TRACE("UnorderedMap._publish_filter >", "words:", nwords);
+  }
+
+  /**
+   * Allocates staging buffers for remote insertion with the given
+   * capacity at every unit. Collective operation.
+   */
+  void _allocate_inbox(size_type capacity)
+  {
+    DASH_LOG_TRACE("UnorderedMap._allocate_inbox()", "capacity:", capacity);
+    if (!DART_GPTR_ISNULL(_inbox_gptr)) {
+      DASH_ASSERT_RETURNS(dart_team_memfree(_inbox_gptr), DART_OK);
+    }
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(
+        _team->dart_id(),
+        capacity * sizeof(value_type),
+        DART_TYPE_BYTE,
+        &_inbox_gptr),
+      DART_OK);
+    _inbox_capacity = capacity;
+  }
+
+  /**
+   * Native pointer to the local staging buffer.
+   */
+  value_type * _inbox_lbegin() const
+  {
+    dart_gptr_t gptr = _inbox_gptr;
+    DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, _myid), DART_OK);
+    void * addr = nullptr;
+    DASH_ASSERT_RETURNS(dart_gptr_getaddr(gptr, &addr), DART_OK);
+    return static_cast<value_type *>(addr);
+  }
+
+  /**
+   * Stages elements in the staging buffer of the specified remote unit.
+   * Elements that exceed the buffer's capacity are retained until the
+   * next commit.
+   * The transfer is not completed before the next flush of the staging
+   * buffers, \c values must not be modified until then.
+   *
+   * \return  The number of elements transferred to the remote unit.
+   */
+  size_type _insert_remote_async(
+    team_unit_t        unit,
+    const value_type * values,
+    size_type          nvalues)
+  {
+    DASH_LOG_TRACE("UnorderedMap._insert_remote_async()",
+                   "unit:", unit, "nvalues:", nvalues);
+    // Reserve slots in staging buffer of target unit:
+    size_type offset  = GlobRef<Atomic<size_type>>(
+                          _inbox_sizes[unit].dart_gptr()
+                        ).fetch_add(nvalues);
+    size_type nstaged = 0;
+    if (offset < _inbox_capacity) {
+      nstaged = std::min(nvalues, _inbox_capacity - offset);
+      dart_gptr_t gptr = _inbox_gptr;
+      DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, unit), DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_gptr_incaddr(&gptr, offset * sizeof(value_type)),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_put(
+          gptr,
+          values,
+          nstaged * sizeof(value_type),
+          DART_TYPE_BYTE),
+        DART_OK);
+    }
+    for (size_type i = nstaged; i < nvalues; ++i) {
+      _inbox_overflow[unit].push_back(values[i]);
+    }
+    return nstaged;
+  }
+
+  /**
+   * Stages elements in the staging buffer of the specified remote unit
+   * and waits for completion of the transfer.
+   */
+  void _insert_remote(
+    team_unit_t        unit,
+    const value_type * values,
+    size_type          nvalues)
+  {
+    if (_insert_remote_async(unit, values, nvalues) > 0) {
+      dart_gptr_t gptr = _inbox_gptr;
+      DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, unit), DART_OK);
+      DASH_ASSERT_RETURNS(dart_flush(gptr), DART_OK);
+    }
+  }
+
+  void _insert_remote(
+    team_unit_t        unit,
+    const value_type & value)
+  {
+    _insert_remote(unit, &value, 1);
+  }
+
+  /**
+   * Moves elements in the local staging buffer to local memory, skipping
+   * elements with keys already contained in the local index.
+   */
+  void _integrate_inbox()
+  {
+    size_type nstaged = std::min<size_type>(_inbox_sizes.local[0],
+                                            _inbox_capacity);
+    DASH_LOG_TRACE("UnorderedMap._integrate_inbox()", "staged:", nstaged);
+    const value_type * inbox = _inbox_lbegin();
+    for (size_type i = 0; i < nstaged; ++i) {
+      if (_lindex_find(inbox[i].first) < 0) {
+        _insert_at(_myid, inbox[i]);
+      }
+    }
+    _inbox_sizes.local[0] = 0;
+  }
+
+  /**
+   * Moves elements staged by remote units to local memory.
+   * Collective operation.
+   */
+  void _commit_inbox()
+  {
+    DASH_LOG_TRACE("UnorderedMap._commit_inbox()");
+    // Wait for completion of staging at all units:
+    _team->barrier();
+    _integrate_inbox();
+    // Number of elements every unit failed to stage due to insufficient
+    // capacity of staging buffers:
+    auto nunits = _team->size();
+    std::vector<size_type> l_overflow(nunits);
+    std::vector<size_type> g_overflow(nunits);
+    for (size_type u = 0; u < nunits; ++u) {
+      l_overflow[u] = _inbox_overflow[u].size();
+    }
+    dart_storage_t ds = dash::dart_storage<size_type>(nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        l_overflow.data(),
+        g_overflow.data(),
+        ds.nelem,
+        ds.dtype,
+        DART_OP_SUM,
+        _team->dart_id()),
+      DART_OK);
+    size_type max_overflow = *std::max_element(g_overflow.begin(),
+                                               g_overflow.end());
+    if (max_overflow == 0) {
+      return;
+    }
+    DASH_LOG_TRACE("UnorderedMap._commit_inbox", "resizing staging buffers",
+                   "overflow:", max_overflow);
+    _allocate_inbox(std::max(max_overflow, 2 * _inbox_capacity));
+    _team->barrier();
+    std::vector<std::vector<value_type>> overflow(nunits);
+    overflow.swap(_inbox_overflow);
+    size_type nstaged = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      if (!overflow[u].empty()) {
+        nstaged += _insert_remote_async(
+                     team_unit_t(u), overflow[u].data(), overflow[u].size());
+      }
+    }
+    if (nstaged > 0) {
+      DASH_ASSERT_RETURNS(dart_flush_all(_inbox_gptr), DART_OK);
+    }
+    _team->barrier();
+    _integrate_inbox();
+  }
+
+  /**
+   * Insert value in local memory.
    */
   std::pair<iterator, bool> _insert_at(
     team_unit_t        unit,
@@ -831,12 +1640,8 @@ private:
                    "unit:", unit, "lidx:", old_local_size);
     result.first  = iterator(this, unit, old_local_size);
     result.second = true;
-
-    if (unit != _myid) {
-      DASH_LOG_TRACE("UnorderedMap.insert", "remote insertion");
-      // Mark inserted element for move to remote unit in next commit:
-      _move_elements.push_back(result.first);
-    }
+    // Add element to local index:
+    _lindex_insert(value.first, old_local_size);
 
     // Update iterators as global memory space has been changed for the
     // active unit:
@@ -8,14 +8,11 @@
 #include <dash/GlobSharedRef.h>
 #include <dash/Allocator.h>
 #include <dash/Team.h>
-#include <dash/Array.h>
 #include <dash/Onesided.h>
 
-#include <dash/algorithm/MinMax.h>
-#include <dash/algorithm/Copy.h>
-
 #include <dash/memory/GlobHeapPtr.h>
 #include <dash/memory/GlobHeapLocalPtr.h>
+#include <dash/memory/internal/GlobHeapMemTypes.h>
 
 #include <dash/internal/Logging.h>
 
@@ -235,11 +232,8 @@ private:
   typedef typename std::list<bucket_type>                       bucket_list;
   typedef typename bucket_list::iterator                    bucket_iterator;
 
-  typedef dash::Array<
-            size_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
-    local_sizes_map;
-
-  typedef std::vector<std::vector<size_type> >       bucket_cumul_sizes_map;
+  typedef dash::internal::glob_dynamic_mem_bucket_cumul_sizes<size_type>
+    bucket_cumul_sizes_map;
 
   template<typename T_, class GMem_>
   friend class dash::GlobPtr;
@@ -252,6 +246,8 @@ private:
   local_pointer              _lbegin = nullptr;
   local_pointer              _lend   = nullptr;
   team_unit_t                _myid   { DART_UNDEFINED_UNIT_ID };
+  /// Global pointer to the segment all units attach their buckets to.
+  dart_gptr_t                _segment_gptr = DART_GPTR_NULL;
   /// Buckets in local memory space, partitioned by allocated state:
   ///   [ attached buckets, ... , unattached buckets, ... ]
   /// Buckets in this list represent the local iteration- and memory space.
@@ -260,21 +256,19 @@ private:
   bucket_list                _detach_buckets;
   /// Iterator to first unattached bucket.
   bucket_iterator            _attach_buckets_first;
-  /// Mapping unit id to number of elements in the unit's attached local
-  /// memory space.
-  local_sizes_map            _local_sizes;
-  /// An array mapping units to a list of their cumulative bucket sizes
-  /// (i.e. postfix sum) which is required to iterate over the
-  /// non-contigous global dynamic memory space.
+  /// Number of elements in the local memory space, including unattached
+  /// buckets.
+  size_type                  _local_size = 0;
+  /// Mapping units to a list of their cumulative bucket sizes (i.e.
+  /// postfix sum) which is required to iterate over the non-contigous
+  /// global dynamic memory space, and the addresses of remote buckets.
   /// For example, if unit 2 allocated buckets with sizes 1,3,5, the
   /// list at _bucket_cumul_sizes[2] has values 1,4,9.
   bucket_cumul_sizes_map     _bucket_cumul_sizes;
-  /// Mapping unit id to number of buckets marked for attach in the unit's
-  /// memory space.
-  local_sizes_map            _num_attach_buckets;
-  /// Mapping unit id to number of buckets marked for detach in the unit's
-  /// memory space.
-  local_sizes_map            _num_detach_buckets;
+  /// Number of buckets marked for attach in the local memory space.
+  size_type                  _num_attach_buckets = 0;
+  /// Number of buckets marked for detach in the local memory space.
+  size_type                  _num_detach_buckets = 0;
   /// Total number of elements in attached memory space of remote units.
   size_type                  _remote_size = 0;
   /// Global pointer referencing start of global memory space.
@@ -301,18 +295,16 @@ public:
     _nunits(team.size()),
     _myid(team.myid()),
     _attach_buckets_first(_buckets.end()),
-    _local_sizes(team.size(), team),
-    _bucket_cumul_sizes(team.size()),
-    _num_attach_buckets(team.size(), team),
-    _num_detach_buckets(team.size(), team),
+    _bucket_cumul_sizes(team.size(), team.myid()),
     _remote_size(0)
   {
     DASH_LOG_TRACE("GlobHeapMem.(ninit,nunits)",
                    n_local_elem, team.size());
 
-    _local_sizes.local[0]        = 0;
-    _num_attach_buckets.local[0] = 0;
-    _num_detach_buckets.local[0] = 0;
+    DASH_ASSERT_RETURNS(
+      dart_team_memregister_dynamic(_teamid, &_segment_gptr),
+      DART_OK);
+    DASH_LOG_TRACE_VAR("GlobHeapMem.GlobHeapMem", _segment_gptr);
 
     DASH_LOG_TRACE("GlobHeapMem.GlobHeapMem",
                    "allocating initial memory space");
@@ -328,19 +320,34 @@ public:
   ~GlobHeapMem()
   {
     DASH_LOG_TRACE("GlobHeapMem.~GlobHeapMem()");
+    // If DASH has been finalized, global memory has already been freed by
+    // dart_exit() and only local memory must be deallocated:
+    bool detach = dash::is_initialized();
+    for (auto buckets : { &_buckets, &_detach_buckets }) {
+      for (auto & bucket : *buckets) {
+        if (detach && bucket.attached) {
+          dart_memdetach(bucket.gptr);
+        }
+        _allocator.deallocate_local(bucket.lptr);
+      }
+    }
+    if (detach) {
+      dart_team_memderegister(_segment_gptr);
+    }
+    DASH_LOG_TRACE("GlobHeapMem.~GlobHeapMem >");
   }
 
   GlobHeapMem()                        = delete;
 
   /**
-   * Copy constructor.
+   * Copy constructor, deleted as instances own their buckets.
    */
-  GlobHeapMem(const self_t & other)    = default;
+  GlobHeapMem(const self_t & other)    = delete;
 
   /**
-   * Assignment operator.
+   * Assignment operator, deleted as instances own their buckets.
    */
-  self_t & operator=(const self_t & rhs)  = default;
+  self_t & operator=(const self_t & rhs)  = delete;
 
   /**
    * Equality comparison operator.
@@ -377,7 +384,7 @@ public:
    */
   constexpr size_type local_size() const noexcept
   {
-    return _local_sizes.local[0];
+    return _local_size;
   }
 
   /**
@@ -394,9 +401,9 @@ public:
                        _bucket_cumul_sizes[unit]);
     size_type unit_local_size;
     if (unit == _myid) {
-      // Value of _local_sizes[u] is the local size as visible by the unit,
+      // Value of _local_size is the local size as visible by the unit,
       // i.e. including size of unattached buckets.
-      unit_local_size = _local_sizes.local[0];
+      unit_local_size = _local_size;
     } else {
       unit_local_size = _bucket_cumul_sizes[unit].back();
     }
@@ -433,7 +440,7 @@ public:
   local_pointer grow(size_type num_elements)
   {
     DASH_LOG_DEBUG_VAR("GlobHeapMem.grow()", num_elements);
-    size_type local_size_old = _local_sizes.local[0];
+    size_type local_size_old = _local_size;
     DASH_LOG_TRACE("GlobHeapMem.grow",
                    "current local size:", local_size_old);
     if (num_elements == 0) {
@@ -441,9 +448,9 @@ public:
       return _lend;
     }
     // Update size of local memory space:
-    _local_sizes.local[0]        += num_elements;
+    _local_size         += num_elements;
     // Update number of local buckets marked for attach:
-    _num_attach_buckets.local[0] += 1;
+    _num_attach_buckets += 1;
 
     // Create new unattached bucket:
     DASH_LOG_TRACE("GlobHeapMem.grow", "creating new unattached bucket:",
@@ -460,20 +467,20 @@ public:
       _attach_buckets_first = _buckets.begin();
       std::advance(_attach_buckets_first,  _buckets.size() - 1);
     }
-    _bucket_cumul_sizes[_myid].push_back(_local_sizes.local[0]);
+    _bucket_cumul_sizes.local().push_back(_local_size);
     DASH_LOG_TRACE("GlobHeapMem.grow", "added unattached bucket:",
                    "size:", bucket.size,
                    "lptr:", bucket.lptr);
     // Update local iteration space:
     update_lbegin();
     update_lend();
-    DASH_ASSERT_EQ(_local_sizes.local[0], _lend - _lbegin,
+    DASH_ASSERT_EQ(_local_size, _lend - _lbegin,
                    "local size differs from local iteration space size");
     DASH_LOG_TRACE("GlobHeapMem.grow",
-                   "new local size:",     _local_sizes.local[0]);
+                   "new local size:",     _local_size);
     DASH_LOG_TRACE("GlobHeapMem.grow",
                    "local buckets:",      _buckets.size(),
-                   "unattached buckets:", _num_attach_buckets.local[0]);
+                   "unattached buckets:", _num_attach_buckets);
     DASH_LOG_TRACE("GlobHeapMem.grow >");
     // Return local iterator to start of allocated memory:
     return _lbegin + local_size_old;
@@ -503,7 +510,7 @@ public:
     // calling unit u.
     // The following members are updated:
     //
-    // _local_sizes[u]:
+    // _local_size:
     //   Size of local memory space as visible to unit u.
     //
     // _bucket_cumul_sizes:
@@ -520,13 +527,13 @@ public:
     // Notes:
     //
     // It must be ensured that the updated cumulative bucket sizes of a
-    // remote unit can be resolved in \c update_local_size() after any
-    // possible combination of grow- and shrink-operations at the remote unit
-    // from the following information:
+    // remote unit can be resolved in \c commit() after any possible
+    // combination of grow- and shrink-operations at the remote unit from
+    // the following information:
     //
     // - the cumulative bucket sizes of the remote unit at the time of the
     //   last commit
-    // - the remote unit's local size at the time of the last commit
+    // - the number of buckets detached by the remote unit
     // - the remote unit's current local size (including unattached buckets)
     // - the number of the remote unit's unattached buckets and their size
 
@@ -539,7 +546,7 @@ public:
       return;
     }
     DASH_LOG_TRACE("GlobHeapMem.shrink",
-                   "current local size:", _local_sizes.local[0]);
+                   "current local size:", _local_size);
     DASH_LOG_TRACE("GlobHeapMem.shrink",
                    "current local buckets:", _buckets.size());
     // Position of iterator to first unattached bucket:
@@ -559,9 +566,9 @@ public:
         DASH_LOG_TRACE("GlobHeapMem.shrink", "remove unattached bucket:",
                        "size:", bucket_last.size);
         // Mark entire bucket for deallocation below:
-        num_dealloc           -= bucket_last.size;
-        _local_sizes.local[0] -= bucket_last.size;
-        _bucket_cumul_sizes[_myid].pop_back();
+        num_dealloc -= bucket_last.size;
+        _local_size -= bucket_last.size;
+        _bucket_cumul_sizes.local().pop_back();
         // End iterator of _buckets about to change, update iterator to first
         // unattached bucket if it references the removed bucket:
         auto attach_buckets_first_it = _attach_buckets_first;
@@ -579,18 +586,18 @@ public:
           _attach_buckets_first = _buckets.end();
         }
         // Update number of local buckets marked for attach:
-        DASH_ASSERT_GT(_num_attach_buckets.local[0], 0,
+        DASH_ASSERT_GT(_num_attach_buckets, 0,
                        "Last bucket unattached but number of buckets marked "
                        "for attach is 0");
-        _num_attach_buckets.local[0] -= 1;
+        _num_attach_buckets -= 1;
       } else if (bucket_last.size > num_dealloc) {
         // TODO: Clarify if shrinking unattached buckets is allowed
         DASH_LOG_TRACE("GlobHeapMem.shrink", "shrink unattached bucket:",
                        "old size:", bucket_last.size,
                        "new size:", bucket_last.size - num_dealloc);
-        bucket_last.size                  -= num_dealloc;
-        _local_sizes.local[0]             -= num_dealloc;
-        _bucket_cumul_sizes[_myid].back() -= num_dealloc;
+        bucket_last.size                   -= num_dealloc;
+        _local_size                        -= num_dealloc;
+        _bucket_cumul_sizes.local().back() -= num_dealloc;
         num_dealloc = 0;
       }
     }
@@ -610,17 +617,17 @@ public:
       if (bucket_it->size <= num_dealloc) {
         // mark entire bucket for deallocation:
         num_dealloc_gbuckets++;
-        _num_detach_buckets.local[0]      += 1;
-        _local_sizes.local[0]             -= bucket_it->size;
-        _bucket_cumul_sizes[_myid].back() -= bucket_it->size;
-        num_dealloc                       -= bucket_it->size;
+        _num_detach_buckets += 1;
+        _local_size         -= bucket_it->size;
+        num_dealloc         -= bucket_it->size;
+        _bucket_cumul_sizes.local().pop_back();
       } else if (bucket_it->size > num_dealloc) {
         DASH_LOG_TRACE("GlobHeapMem.shrink", "shrink attached bucket:",
                        "old size:", bucket_it->size,
                        "new size:", bucket_it->size - num_dealloc);
-        bucket_it->size                   -= num_dealloc;
-        _local_sizes.local[0]             -= num_dealloc;
-        _bucket_cumul_sizes[_myid].back() -= num_dealloc;
+        bucket_it->size                    -= num_dealloc;
+        _local_size                        -= num_dealloc;
+        _bucket_cumul_sizes.local().back() -= num_dealloc;
         num_dealloc = 0;
       }
     }
@@ -642,9 +649,9 @@ public:
     update_lend();
 
     DASH_LOG_TRACE("GlobHeapMem.shrink",
-                   "cumulative bucket sizes:",  _bucket_cumul_sizes[_myid]);
+                   "cumulative bucket sizes:",  _bucket_cumul_sizes.local());
     DASH_LOG_TRACE("GlobHeapMem.shrink",
-                   "new local size:",           _local_sizes.local[0],
+                   "new local size:",           _local_size,
                    "new iteration space size:", std::distance(
                                                   _lbegin, _lend));
     DASH_LOG_TRACE("GlobHeapMem.shrink",
@@ -676,18 +683,16 @@ public:
     DASH_LOG_DEBUG("GlobHeapMem.commit()");
     DASH_LOG_TRACE_VAR("GlobHeapMem.commit", _buckets.size());
 
-    // First detach, then attach to minimize number of elements allocated
-    // at the same time:
-    size_type num_detached_elem = commit_detach();
-    size_type num_attached_elem = commit_attach();
-
-    if (num_detached_elem > 0 || num_attached_elem > 0) {
-      // Update _begin iterator:
-      DASH_LOG_TRACE("GlobHeapMem.commit", "updating _begin");
-      _begin_idx = 0;
-      DASH_LOG_TRACE("GlobHeapMem.commit", "updating _end");
-      _end_idx   = size();
-    }
+    // Buckets marked for detach are released after all units published
+    // their changes in commit_attach, so remote units completed their
+    // accesses to the buckets before they are freed:
+    commit_attach();
+    commit_detach();
+
+    DASH_LOG_TRACE("GlobHeapMem.commit", "updating _begin");
+    _begin_idx = 0;
+    DASH_LOG_TRACE("GlobHeapMem.commit", "updating _end");
+    _end_idx   = size();
     // Update local iterators as bucket iterators might have changed:
     DASH_LOG_TRACE("GlobHeapMem.commit", "updating _lbegin");
     update_lbegin();
@@ -930,295 +935,133 @@ private:
 
 
   /**
-   * Commit global deallocation of buffers marked for detach.
+   * Detach and deallocate buckets marked for detach.
+   * Local operation, remote units must have updated their bucket lists in
+   * \c commit_attach() before.
    */
   size_type commit_detach()
   {
     DASH_LOG_TRACE("GlobHeapMem.commit_detach()");
     DASH_LOG_TRACE("GlobHeapMem.commit_detach",
-                   "local buckets to detach:", _num_detach_buckets.local[0]);
-    // Number of elements successfully deallocated from global memory in
-    // this commit:
+                   "local buckets to detach:", _num_detach_buckets);
+    // Number of elements deallocated from global memory in this commit:
     size_type num_detached_elem = 0;
-    for (auto bucket_it = _detach_buckets.begin();
-         bucket_it != _detach_buckets.cend(); ++bucket_it) {
+    for (auto & bucket : _detach_buckets) {
       DASH_LOG_TRACE("GlobHeapMem.commit_detach", "detaching bucket:",
-                     "size:", bucket_it->size,
-                     "lptr:", bucket_it->lptr,
-                     "gptr:", bucket_it->gptr);
-      // Detach bucket from global memory region and deallocate its local
-      // memory segment:
-      if (bucket_it->attached) {
-        _allocator.deallocate(bucket_it->gptr);
-        num_detached_elem   += bucket_it->size;
-        bucket_it->attached  = false;
+                     "size:", bucket.size,
+                     "lptr:", bucket.lptr,
+                     "gptr:", bucket.gptr);
+      if (bucket.attached) {
+        DASH_ASSERT_RETURNS(
+          dart_memdetach(bucket.gptr),
+          DART_OK);
+        num_detached_elem += bucket.size;
+        bucket.attached    = false;
       }
+      _allocator.deallocate_local(bucket.lptr);
     }
     _detach_buckets.clear();
+    _num_detach_buckets = 0;
     DASH_LOG_TRACE("GlobHeapMem.commit_detach >",
                    "globally deallocated elements:", num_detached_elem);
     return num_detached_elem;
   }
 
   /**
-   * Commit global allocation of buffers marked for attach.
+   * Attach buckets marked for attach and update the cumulative bucket
+   * sizes of all remote units.
+   *
+   * Collective operation.
+   * Attaching buckets is a local operation, the number of detached and
+   * attached buckets and the local size of all units are exchanged in a
+   * single allgather, followed by a single allgatherv of the
+   * (address, size) tuples of all attached buckets.
    */
   size_type commit_attach()
   {
+    typedef typename bucket_cumul_sizes_map::commit_info commit_info;
+
     DASH_LOG_TRACE("GlobHeapMem.commit_attach()");
     DASH_LOG_TRACE("GlobHeapMem.commit_attach",
-                   "local buckets to attach:", _num_attach_buckets.local[0]);
-    // Unregister buckets marked for detach in global memory:
-    _num_attach_buckets.barrier();
-    // Minumum and maximum number of buckets to be attached by any unit:
-    auto min_max_attach     = gather_min_max(_num_attach_buckets.begin(),
-                                             _num_attach_buckets.end());
-    auto min_attach_buckets = min_max_attach.first;
-    auto max_attach_buckets = min_max_attach.second;
-    DASH_LOG_TRACE("GlobHeapMem.commit_attach",
-                   "min. attach buckets:",  min_attach_buckets);
-    DASH_LOG_TRACE("GlobHeapMem.commit_attach",
-                   "max. attach buckets:",  max_attach_buckets);
-    // Number of buckets successfully attached in this commit:
-    size_type num_attached_buckets = 0;
+                   "local buckets to attach:", _num_attach_buckets);
+    // Interleaved (address, size) tuples of buckets attached in this
+    // commit:
+    std::vector<size_type> attached_buckets;
+    attached_buckets.reserve(2 * _num_attach_buckets);
     // Number of elements allocated in global memory in this commit:
-    size_type num_attached_elem    = 0;
-    // Number of elements at remote units before the commit:
-    size_type old_remote_size      = _remote_size;
-    _remote_size                   = update_remote_size();
-    // Whether at least one remote unit needs to attach additional global
-    // memory:
-    bool has_remote_attach         = _remote_size > old_remote_size;
-    DASH_LOG_TRACE_VAR("GlobHeapMem.commit_attach", old_remote_size);
-    DASH_LOG_TRACE_VAR("GlobHeapMem.commit_attach", _remote_size);
-    DASH_LOG_TRACE_VAR("GlobHeapMem.commit_attach", size());
-    DASH_LOG_TRACE_VAR("GlobHeapMem.commit_attach", has_remote_attach);
-    // Plausibility check:
-    DASH_ASSERT(!has_remote_attach || max_attach_buckets > 0);
-
-    // Attach local unattached buckets in global memory space.
-    // As bucket sizes differ between units, units must collect gptr's
-    // (dart_gptr_t) and size of buckets attached by other units and store
-    // them locally so a remote unit's local index can be mapped to the
-    // remote unit's bucket.
-    if (min_attach_buckets == 0 && max_attach_buckets == 0) {
-      DASH_LOG_TRACE("GlobHeapMem.commit_attach", "no attach");
-      DASH_ASSERT(_attach_buckets_first == _buckets.end());
-      DASH_ASSERT(_buckets.empty() || _buckets.back().attached);
-    }
-    DASH_LOG_TRACE("GlobHeapMem.commit_attach", "attaching",
-                   std::distance(_attach_buckets_first, _buckets.end()),
-                   "buckets");
+    size_type num_attached_elem = 0;
     for (; _attach_buckets_first != _buckets.end(); ++_attach_buckets_first) {
       bucket_type & bucket = *_attach_buckets_first;
       DASH_ASSERT(!bucket.attached);
-      DASH_LOG_TRACE("GlobHeapMem.commit_attach", "attaching bucket");
-      DASH_LOG_TRACE_VAR("GlobHeapMem.commit_attach", bucket.size);
-      DASH_LOG_TRACE_VAR("GlobHeapMem.commit_attach", bucket.lptr);
-      // Attach bucket's local memory segment in global memory:
-      bucket.gptr     = _allocator.attach(bucket.lptr, bucket.size);
+      dart_storage_t ds = dash::dart_storage<value_type>(bucket.size);
+      DASH_ASSERT_RETURNS(
+        dart_memattach(
+          _segment_gptr, ds.nelem, ds.dtype, bucket.lptr, &bucket.gptr),
+        DART_OK);
       bucket.attached = true;
       DASH_LOG_TRACE("GlobHeapMem.commit_attach", "attached bucket:",
+                     "size:", bucket.size,
+                     "lptr:", bucket.lptr,
                      "gptr:", bucket.gptr);
-      num_attached_elem            += bucket.size;
-      _num_attach_buckets.local[0] -= 1;
-      num_attached_buckets++;
+      attached_buckets.push_back(bucket.gptr.addr_or_offs.offset);
+      attached_buckets.push_back(bucket.size);
+      num_attached_elem += bucket.size;
     }
-    DASH_ASSERT(_attach_buckets_first == _buckets.end());
-    // All units must attach the same number of buckets collectively.
-    // Attach empty buckets if this unit attached less than the maximum
-    // number of buckets attached by any other unit in this commit:
-    DASH_LOG_TRACE("GlobHeapMem.commit_attach",
-                   "local buckets attached:", num_attached_buckets);
-    DASH_LOG_TRACE("GlobHeapMem.commit_attach",
-                   "buckets required to attach:", max_attach_buckets);
-    while (num_attached_buckets < max_attach_buckets) {
-      DASH_LOG_TRACE("GlobHeapMem.commit_attach", "attaching null bucket");
-      bucket_type bucket;
-      bucket.size     = 0;
-      bucket.lptr     = nullptr;
-      bucket.attached = true;
-      bucket.gptr     = _allocator.attach(bucket.lptr, bucket.size);
-      DASH_ASSERT(!DART_GPTR_ISNULL(bucket.gptr));
-      _buckets.push_back(bucket);
-      num_attached_buckets++;
-      DASH_LOG_TRACE("GlobHeapMem.commit_attach", "attached null bucket:",
-                     "gptr:", bucket.gptr,
-                     "left:", max_attach_buckets - num_attached_buckets);
-    }
-    DASH_LOG_TRACE("GlobHeapMem.commit_attach >",
-                   "globally allocated elements:", num_attached_elem);
-    return num_attached_elem;
-  }
-
-  template<
-    typename GlobalIt,
-    typename ValueType = typename GlobalIt::value_type >
-  std::pair<ValueType, ValueType> gather_min_max(
-    const GlobalIt & first,
-    const GlobalIt & last)
-  {
-    // TODO: Unoptimized, use dash::min_max_element once it is available
-    //
-    DASH_LOG_TRACE("GlobHeapMem.gather_min_max()");
-    std::vector<ValueType> lcopy(dash::distance(first, last));
-    auto lcopy_end = dash::copy(first, last, lcopy.data());
-    auto min_lptr  = std::min_element(lcopy.data(), lcopy_end);
-    auto max_lptr  = std::max_element(lcopy.data(), lcopy_end);
-    std::pair<ValueType, ValueType> min_max;
-    min_max.first  = *min_lptr;
-    min_max.second = *max_lptr;
-    DASH_LOG_TRACE("GlobHeapMem.gather_min_max >",
-                   "min:", min_max.first,
-                   "max:", min_max.second);
-    return min_max;
-  }
+    DASH_ASSERT_EQ(attached_buckets.size(), 2 * _num_attach_buckets,
+                   "number of attached buckets differs from number of "
+                   "buckets marked for attach");
+
+    // Exchange number of detached and attached buckets and local size of
+    // all units:
+    auto        dtype = dash::dart_punned_datatype<size_type>::value;
+    commit_info local_info { _num_detach_buckets,
+                             _num_attach_buckets,
+                             _local_size };
+    std::vector<commit_info> unit_infos(_nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        &local_info, unit_infos.data(),
+        sizeof(commit_info) / sizeof(size_type), dtype,
+        _teamid),
+      DART_OK);
 
-  /**
-   * Request the size of all units' local memory, including unattached memory
-   * regions, and update the capacity of global memory space.
-   */
-  size_type update_remote_size()
-  {
-    // This function updates local snapshots of the remote unit's local
-    // sizes.
-    // The following members are updated:
-    //
-    // _remote_size:
-    //    The sum of all remote units' local size, including the sizes of
-    //    unattached buckets.
-    //
-    // _bucket_cumul_sizes:
-    //    An array mapping units to a list of their cumulative bucket sizes
-    //    (i.e. postfix sum) which is required to iterate over the
-    //    non-contigous global dynamic memory space.
-    //    For example, if unit 2 allocated buckets with sizes 1, 3 and 5,
-    //    _bucket_cumul_sizes[2] is a list { 1, 4, 9 }.
-    //
-    // Outline:
-    //
-    // 1. Create local copy of the distributed array _num_attach_buckets that
-    //    contains the number of unattached buckets of every unit.
-    // 2. Temporarily attach an array attach_bucket_sizes in global memory
-    //    that contains the sizes of this unit's unattached buckets.
-    // 3. At this point, every unit published the number of buckets it will
-    //    attach in the next commit, and their sizes.
-    //    The current local size Lu of every unit, including its unattached
-    //    buckets, is stored in _local_sizes.
-    // 4. For every remote unit u:
-    //    - If unit u has one unattached bucket, append the unit's current
-    //      local size Lu to the unit's list of cumulative bucket sizes.
-    //    - If unit u has more than one unattached bucket, the sizes of the
-    //      single buckets must be retrieved from the vector
-    //      attach_bucket_sizes temporarily attached by u in step 1.
-    // 5. Detach vector attach_bucket_sizes.
-
-    DASH_LOG_TRACE("GlobHeapMem.update_remote_size()");
-    size_type new_remote_size = 0;
-    // Number of unattached buckets of every unit:
-    std::vector<size_type> num_unattached_buckets(_nunits, 0);
-    _num_attach_buckets.barrier();
-    dash::copy(_num_attach_buckets.begin(),
-               _num_attach_buckets.end(),
-               num_unattached_buckets.data());
-    // Attach array of local unattached bucket sizes to allow remote units to
-    // query the sizes of this unit's unattached buckets.
-    std::vector<size_type> attach_buckets_sizes;
-    for (auto bit = _attach_buckets_first; bit != _buckets.end(); ++bit) {
-      attach_buckets_sizes.push_back((*bit).size);
+    // Exchange (address, size) tuples of buckets attached by all units:
+    std::vector<size_t> unit_nelems(_nunits);
+    std::vector<size_t> unit_displs(_nunits);
+    size_t              nelems_total = 0;
+    for (size_type u = 0; u < _nunits; ++u) {
+      unit_displs[u]  = nelems_total;
+      unit_nelems[u]  = 2 * unit_infos[u].num_attach;
+      nelems_total   += unit_nelems[u];
     }
-    DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
-                       attach_buckets_sizes);
-    // Use same allocator type as used for values in global memory:
-    typedef typename allocator_type::template rebind<size_type>::other
-      size_type_allocator_t;
-    size_type_allocator_t attach_buckets_sizes_allocator(_allocator.team());
-    auto attach_buckets_sizes_gptr = attach_buckets_sizes_allocator.attach(
-                                       &attach_buckets_sizes[0],
-                                       attach_buckets_sizes.size());
-    _team->barrier();
-    // Implicit barrier in allocator.attach
-    DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
-                       attach_buckets_sizes_gptr);
-    for (int u = 0; u < _nunits; ++u) {
-      if (u == _myid) {
-        continue;
-      }
-      DASH_LOG_TRACE("GlobHeapMem.update_remote_size",
-                     "collecting local bucket sizes of unit", u);
-      // Last known local attached capacity of remote unit:
-      auto & u_bucket_cumul_sizes = _bucket_cumul_sizes[u];
-      // Request current locally allocated capacity of remote unit:
-      size_type u_local_size_old  = u_bucket_cumul_sizes.size() == 0
-                                    ? 0
-                                    : u_bucket_cumul_sizes.back();
-      size_type u_local_size_new  = _local_sizes[u];
-      DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
-                         u_local_size_old);
-      DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
-                         u_local_size_old);
-      int u_local_size_diff  = u_local_size_new - u_local_size_old;
-      new_remote_size       += u_local_size_new;
-      // Number of unattached buckets of unit u:
-      size_type u_num_attach_buckets = num_unattached_buckets[u];
-      DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
-                         u_num_attach_buckets);
-      if (u_num_attach_buckets == 0) {
-        // No unattached buckets at unit u.
-      } else if (u_num_attach_buckets == 1) {
-        // One unattached bucket at unit u, no need to request single bucket
-        // sizes:
-        u_bucket_cumul_sizes.push_back(u_local_size_new);
-      } else {
-        // Unit u has multiple unattached buckets.
-        // Request sizes of single unattached buckets of unit u:
-        std::vector<size_type> u_attach_buckets_sizes(
-                                 u_num_attach_buckets, 0);
-        dart_gptr_t u_attach_buckets_sizes_gptr = attach_buckets_sizes_gptr;
-        dart_gptr_setunit(&u_attach_buckets_sizes_gptr, u);
-        dart_storage_t ds = dash::dart_storage<size_type>(u_num_attach_buckets);
-        DASH_ASSERT_RETURNS(
-          dart_get_blocking(
-            // local dest:
-            u_attach_buckets_sizes.data(),
-            // global source:
-            u_attach_buckets_sizes_gptr,
-            // request bytes (~= number of sizes) from unit u:
-            ds.nelem, ds.dtype),
-          DART_OK);
-        // Update local snapshot of cumulative bucket sizes at unit u:
-        for (int bi = 0; bi < u_num_attach_buckets; ++bi) {
-          size_type single_bkt_size = u_attach_buckets_sizes[bi];
-          size_type cumul_bkt_size  = single_bkt_size;
-          DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
-                             single_bkt_size);
-          if (u_bucket_cumul_sizes.size() > 0) {
-            cumul_bkt_size += u_bucket_cumul_sizes.back();
-          }
-          u_bucket_cumul_sizes.push_back(cumul_bkt_size);
-        }
-      }
-      // Local memory space of unit shrunk:
-      if (u_local_size_diff < 0 && u_bucket_cumul_sizes.size() > 0) {
-        u_bucket_cumul_sizes.back() += u_local_size_diff;
-      }
+    std::vector<size_type> unit_attached_buckets(nelems_total);
+    if (nelems_total > 0) {
+      DASH_ASSERT_RETURNS(
+        dart_allgatherv(
+          attached_buckets.data(), attached_buckets.size(), dtype,
+          unit_attached_buckets.data(),
+          unit_nelems.data(), unit_displs.data(),
+          _teamid),
+        DART_OK);
     }
-    // Detach array of local unattached bucket sizes, implicit barrier:
-    attach_buckets_sizes_allocator.detach(attach_buckets_sizes_gptr);
-    // Implicit barrier in allocator.detach
-    _team->barrier();
+    _bucket_cumul_sizes.update(unit_infos.data(),
+                               unit_attached_buckets.data());
+    _remote_size        = _bucket_cumul_sizes.remote_size();
+    _num_attach_buckets = 0;
 #if DASH_ENABLE_TRACE_LOGGING
-    for (int u = 0; u < _nunits; ++u) {
-      DASH_LOG_TRACE("GlobHeapMem.update_remote_size",
+    for (size_type u = 0; u < _nunits; ++u) {
+      DASH_LOG_TRACE("GlobHeapMem.commit_attach",
                      "unit", u,
                      "cumulative bucket sizes:", _bucket_cumul_sizes[u]);
     }
 #endif
-    DASH_LOG_TRACE("GlobHeapMem.update_remote_size >", new_remote_size);
-    _remote_size = new_remote_size;
-    return _remote_size;
+    DASH_LOG_TRACE_VAR("GlobHeapMem.commit_attach", _remote_size);
+    DASH_LOG_TRACE("GlobHeapMem.commit_attach >",
+                   "globally allocated elements:", num_attached_elem);
+    return num_attached_elem;
   }
 
+public:
   /**
    * Global pointer referencing an element position in a unit's bucket.
    */
@@ -1235,33 +1078,41 @@ private:
     if (_nunits == 0) {
       DASH_THROW(dash::exception::RuntimeError, "No units in team");
     }
-    // Get the referenced bucket's dart_gptr:
-    auto bucket_it = _buckets.begin();
-    std::advance(bucket_it, bucket_index);
-    auto dart_gptr = bucket_it->gptr;
-    DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->attached);
-    DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->gptr);
+    dart_gptr_t dart_gptr;
     if (unit == _myid) {
+      // Get the referenced bucket's dart_gptr:
+      auto bucket_it = _buckets.begin();
+      std::advance(bucket_it, bucket_index);
+      DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->attached);
+      DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->gptr);
       DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->lptr);
       DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->size);
       DASH_ASSERT_LT(bucket_phase, bucket_it->size,
                      "bucket phase out of bounds");
-    }
-    if (DART_GPTR_ISNULL(dart_gptr)) {
-      DASH_LOG_TRACE("GlobHeapMem.dart_gptr_at",
-                     "bucket.gptr is DART_GPTR_NULL");
-      dart_gptr = DART_GPTR_NULL;
+      dart_gptr = bucket_it->gptr;
+      if (DART_GPTR_ISNULL(dart_gptr)) {
+        DASH_LOG_TRACE("GlobHeapMem.dart_gptr_at",
+                       "bucket.gptr is DART_GPTR_NULL");
+        return DART_GPTR_NULL;
+      }
     } else {
-      // Move dart_gptr to unit and local offset:
+      // Bucket offsets in the segment are the bucket's address at the
+      // remote unit:
+      DASH_ASSERT_LT(bucket_index, _bucket_cumul_sizes[unit].size(),
+                     "bucket index out of bounds");
+      dart_gptr = _segment_gptr;
       DASH_ASSERT_RETURNS(
         dart_gptr_setunit(&dart_gptr, unit),
         DART_OK);
-      DASH_ASSERT_RETURNS(
-        dart_gptr_incaddr(
-          &dart_gptr,
-          bucket_phase * sizeof(value_type)),
-        DART_OK);
+      dart_gptr.addr_or_offs.offset =
+        _bucket_cumul_sizes.address(unit, bucket_index);
     }
+    // Move dart_gptr to local offset:
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(
+        &dart_gptr,
+        bucket_phase * sizeof(value_type)),
+      DART_OK);
     DASH_LOG_DEBUG("GlobHeapMem.dart_gptr_at >", dart_gptr);
     return dart_gptr;
   }
@@ -84,7 +84,7 @@ public:
   };
 
 private:
-  typedef std::vector<std::vector<size_type> >
+  typedef typename GlobHeapMemType::bucket_cumul_sizes_map
     bucket_cumul_sizes_map;
 
 private:
@@ -148,7 +148,8 @@ public:
     _idx_bucket_phase(0)
   {
     DASH_LOG_TRACE("GlobPtr(gmem,idx)", "gidx:", position);
-    for (auto unit_bucket_cumul_sizes : *_bucket_cumul_sizes) {
+    for (size_type unit = 0; unit < _bucket_cumul_sizes->size(); ++unit) {
+      auto unit_bucket_cumul_sizes = (*_bucket_cumul_sizes)[unit];
       DASH_LOG_TRACE_VAR("GlobPtr(gmem,idx)",
                          unit_bucket_cumul_sizes);
       size_type bucket_cumul_size_prev = 0;
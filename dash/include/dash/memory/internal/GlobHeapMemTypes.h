@@ -1,6 +1,11 @@
 #ifndef DASH__MEMORY__INTERNAL__GLOB_HEAP_TYPES_H__INCLUDED
 #define DASH__MEMORY__INTERNAL__GLOB_HEAP_TYPES_H__INCLUDED
 
+#include <dash/dart/if/dart_types.h>
+
+#include <vector>
+#include <iostream>
+
 namespace dash {
 namespace internal {
 
@@ -15,6 +20,210 @@ struct glob_dynamic_mem_bucket_type
   bool          attached;
 };
 
+/**
+ * Cumulative bucket sizes (i.e. postfix sums) of the buckets of all units
+ * in a global dynamic memory space, together with the addresses of the
+ * attached buckets of remote units.
+ *
+ * For example, if unit 2 allocated buckets with sizes 1, 3 and 5, the row
+ * of unit 2 has values 1, 4, 9.
+ *
+ * Rows of remote units are stored in a single contiguous table and only
+ * change in a commit. The row of the active unit also includes unattached
+ * buckets and is modified in every local resize operation, it is stored
+ * separately.
+ */
+template<typename SizeType>
+class glob_dynamic_mem_bucket_cumul_sizes
+{
+public:
+  typedef SizeType size_type;
+
+  /**
+   * View on the cumulative bucket sizes of a single unit.
+   */
+  class row_type
+  {
+  public:
+    constexpr row_type(const size_type * first, const size_type * last)
+    : _first(first), _last(last)
+    { }
+
+    constexpr const size_type * begin() const noexcept { return _first; }
+    constexpr const size_type * end()   const noexcept { return _last;  }
+
+    constexpr size_type size() const noexcept {
+      return static_cast<size_type>(_last - _first);
+    }
+
+    constexpr bool empty() const noexcept {
+      return _first == _last;
+    }
+
+    constexpr size_type operator[](size_type bucket) const noexcept {
+      return _first[bucket];
+    }
+
+    /**
+     * Total size of the unit's buckets, 0 if the unit has no buckets.
+     */
+    constexpr size_type back() const noexcept {
+      return empty() ? 0 : *(_last - 1);
+    }
+
+    friend std::ostream & operator<<(std::ostream & os, const row_type & row)
+    {
+      os << "{ ";
+      for (auto cumul_size : row) {
+        os << cumul_size << " ";
+      }
+      return os << "}";
+    }
+
+  private:
+    const size_type * _first;
+    const size_type * _last;
+  };
+
+  /**
+   * Metadata of a unit's buckets exchanged in a commit.
+   */
+  struct commit_info
+  {
+    /// Number of buckets detached in the commit.
+    size_type num_detach;
+    /// Number of buckets attached in the commit.
+    size_type num_attach;
+    /// Size of the unit's local memory space after the commit.
+    size_type local_size;
+  };
+
+public:
+  glob_dynamic_mem_bucket_cumul_sizes(
+    size_type  nunits,
+    size_type  myid)
+  : _myid(myid),
+    _row_offsets(nunits + 1, 0)
+  { }
+
+  /**
+   * Number of units.
+   */
+  constexpr size_type size() const noexcept
+  {
+    return _row_offsets.size() - 1;
+  }
+
+  row_type operator[](size_type unit) const noexcept
+  {
+    return (unit == _myid)
+           ? row_type(_local.data(), _local.data() + _local.size())
+           : row_type(_cumul_sizes.data() + _row_offsets[unit],
+                      _cumul_sizes.data() + _row_offsets[unit+1]);
+  }
+
+  /**
+   * Cumulative bucket sizes of the active unit, including unattached
+   * buckets.
+   */
+  std::vector<size_type> & local() noexcept
+  {
+    return _local;
+  }
+
+  const std::vector<size_type> & local() const noexcept
+  {
+    return _local;
+  }
+
+  /**
+   * Address of an attached bucket at a remote unit.
+   */
+  size_type address(size_type unit, size_type bucket) const noexcept
+  {
+    return _addresses[_row_offsets[unit] + bucket];
+  }
+
+  /**
+   * Total size of the buckets of all remote units.
+   */
+  size_type remote_size() const noexcept
+  {
+    size_type nremote = 0;
+    for (size_type u = 0; u < size(); ++u) {
+      if (u != _myid) {
+        nremote += (*this)[u].back();
+      }
+    }
+    return nremote;
+  }
+
+  /**
+   * Applies the buckets detached and attached by all remote units in a
+   * commit.
+   * Detached buckets are removed from the end of a unit's row, the
+   * (address, size) tuples of attached buckets are appended.
+   */
+  void update(
+    /// Commit metadata of every unit.
+    const commit_info * infos,
+    /// Interleaved (address, size) tuples of the attached buckets of all
+    /// units, ordered by unit.
+    const size_type   * attached)
+  {
+    auto nunits = size();
+    std::vector<size_type> cumul_sizes;
+    std::vector<size_type> addresses;
+    std::vector<size_type> row_offsets(nunits + 1, 0);
+    cumul_sizes.reserve(_cumul_sizes.size());
+    addresses.reserve(_addresses.size());
+    for (size_type u = 0; u < nunits; ++u) {
+      const commit_info & info = infos[u];
+      if (u != _myid) {
+        size_type first = _row_offsets[u];
+        size_type nkeep = _row_offsets[u+1] - first - info.num_detach;
+        cumul_sizes.insert(cumul_sizes.end(),
+                           _cumul_sizes.begin() + first,
+                           _cumul_sizes.begin() + first + nkeep);
+        addresses.insert(addresses.end(),
+                         _addresses.begin() + first,
+                         _addresses.begin() + first + nkeep);
+        size_type nattach_elem = 0;
+        for (size_type b = 0; b < info.num_attach; ++b) {
+          nattach_elem += attached[2 * b + 1];
+        }
+        // Buckets retained at unit u might have been shrunk:
+        size_type cumul_size = info.local_size - nattach_elem;
+        if (nkeep > 0) {
+          cumul_sizes.back() = cumul_size;
+        }
+        for (size_type b = 0; b < info.num_attach; ++b) {
+          cumul_size += attached[2 * b + 1];
+          addresses.push_back(attached[2 * b]);
+          cumul_sizes.push_back(cumul_size);
+        }
+      }
+      attached          += 2 * info.num_attach;
+      row_offsets[u+1]   = cumul_sizes.size();
+    }
+    _cumul_sizes.swap(cumul_sizes);
+    _addresses.swap(addresses);
+    _row_offsets.swap(row_offsets);
+  }
+
+private:
+  size_type              _myid;
+  /// Offsets of the units' rows in the remote table, the row of the active
+  /// unit is empty.
+  std::vector<size_type> _row_offsets;
+  /// Cumulative bucket sizes of remote units.
+  std::vector<size_type> _cumul_sizes;
+  /// Addresses of attached buckets of remote units.
+  std::vector<size_type> _addresses;
+  /// Cumulative bucket sizes of the active unit.
+  std::vector<size_type> _local;
+};
+
 } // namespace internal
 } // namespace dash
 
@@ -123,6 +123,10 @@ private:
   MemoryLayout_t              _memory_layout;
   /// Maximum extents of a block in this pattern
   BlockSizeSpec_t             _blocksize_spec;
+  /// Precomputed divisors by the number of units in every dimension
+  std::array<dash::math::Divisor<SizeType>, NumDimensions> _teamspec_div;
+  /// Precomputed divisors by the maximum block extent in every dimension
+  std::array<dash::math::Divisor<SizeType>, NumDimensions> _blocksize_div;
   /// Number of blocks in all dimensions
   BlockSpec_t                 _blockspec;
   /// A projected view of the global memory layout representing the
@@ -243,6 +247,8 @@ public:
         sizespec,
         _distspec,
         _teamspec)),
+    _teamspec_div(initialize_divisors(_teamspec.extents())),
+    _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
     _blockspec(initialize_blockspec(
         sizespec,
         _distspec,
@@ -311,6 +317,8 @@ public:
         sizespec,
         _distspec,
         _teamspec)),
+    _teamspec_div(initialize_divisors(_teamspec.extents())),
+    _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
     _blockspec(initialize_blockspec(
         sizespec,
         _distspec,
@@ -337,6 +345,8 @@ public:
     _nunits(other._nunits),
     _memory_layout(other._memory_layout),
     _blocksize_spec(other._blocksize_spec),
+    _teamspec_div(other._teamspec_div),
+    _blocksize_div(other._blocksize_div),
     _blockspec(other._blockspec),
     _local_memory_layout(other._local_memory_layout),
     _local_blockspec(other._local_blockspec),
@@ -404,6 +414,8 @@ public:
       _memory_layout       = other._memory_layout;
       _local_memory_layout = other._local_memory_layout;
       _blocksize_spec      = other._blocksize_spec;
+      _teamspec_div        = other._teamspec_div;
+      _blocksize_div       = other._blocksize_div;
       _blockspec           = other._blockspec;
       _local_blockspec     = other._local_blockspec;
       _local_capacity      = other._local_capacity;
@@ -469,8 +481,8 @@ public:
     std::array<IndexType, NumDimensions> unit_coords;
     // Coord to block coord to unit coord:
     for (auto d = 0; d < NumDimensions; ++d) {
-      unit_coords[d] = (coords[d] / _blocksize_spec.extent(d))
-                         % _teamspec.extent(d);
+      unit_coords[d] = _teamspec_div[d].mod(
+                         _blocksize_div[d].div(coords[d]));
     }
     // Unit coord to unit id:
     team_unit_t unit_id(_teamspec.at(unit_coords));
@@ -635,8 +647,6 @@ public:
    * Converts global coordinates to their associated unit and its respective
    * local coordinates.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
   local_coords_t local(
@@ -651,18 +661,13 @@ public:
   /**
    * Converts global index to its associated unit and respective local index.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
   local_index_t local(
     IndexType g_index) const
   {
     DASH_LOG_TRACE_VAR("BlockPattern.local()", g_index);
-    // TODO: Implement dedicated method for this, conversion to/from
-    //       global coordinates is expensive.
-    auto l_coords = coords(g_index);
-    return local_index(l_coords);
+    return local_index(coords(g_index));
   }
 
   /**
@@ -677,9 +682,10 @@ public:
     std::array<IndexType, NumDimensions> local_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto block_size_d     = _blocksize_spec.extent(d);
-      auto b_offset_d       = global_coords[d] % block_size_d;
-      auto g_block_offset_d = global_coords[d] / block_size_d;
-      auto l_block_offset_d = g_block_offset_d / _teamspec.extent(d);
+      auto g_block_offset_d = _blocksize_div[d].div(global_coords[d]);
+      auto b_offset_d       = global_coords[d]
+                              - (g_block_offset_d * block_size_d);
+      auto l_block_offset_d = _teamspec_div[d].div(g_block_offset_d);
       local_coords[d]       = b_offset_d +
                               (l_block_offset_d * block_size_d);
     }
@@ -695,14 +701,21 @@ public:
     const std::array<IndexType, NumDimensions> & global_coords) const
   {
     DASH_LOG_TRACE_VAR("BlockPattern.local_index()", global_coords);
-    // Local offset of the element within all of the unit's local
-    // elements:
-    SizeType local_elem_offset = 0;
-    auto unit = unit_at(global_coords);
+    // Resolve unit coordinates in the team spec and local coordinates
+    // in a single pass, sharing the block coordinate in every dimension:
+    std::array<IndexType, NumDimensions> unit_ts_coords;
+    std::array<IndexType, NumDimensions> l_coords;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      auto block_size_d     = _blocksize_spec.extent(d);
+      auto g_block_offset_d = _blocksize_div[d].div(global_coords[d]);
+      unit_ts_coords[d]     = _teamspec_div[d].mod(g_block_offset_d);
+      l_coords[d]           = (_teamspec_div[d].div(g_block_offset_d)
+                               * block_size_d)
+                              + (global_coords[d]
+                                 - (g_block_offset_d * block_size_d));
+    }
+    team_unit_t unit(_teamspec.at(unit_ts_coords));
     DASH_LOG_TRACE_VAR("BlockPattern.local_index", unit);
-    // Global coords to local coords:
-    std::array<IndexType, NumDimensions> l_coords =
-      local_coords(global_coords);
     DASH_LOG_TRACE_VAR("BlockPattern.local_index", l_coords);
     if (unit == _team->myid()) {
       // Coords are local to this unit, use pre-generated local memory
@@ -713,7 +726,7 @@ public:
       // active unit but does not specify local memory of other units.
       // Generate local memory layout for unit assigned to coords:
       auto l_mem_layout =
-        LocalMemoryLayout_t(initialize_local_extents(unit));
+        LocalMemoryLayout_t(initialize_local_extents(unit_ts_coords));
       return local_index_t { unit, l_mem_layout.at(l_coords) };
     }
   }
@@ -875,26 +888,7 @@ public:
   IndexType at(
     const std::array<IndexType, NumDimensions> & global_coords) const
   {
-    // Local offset of the element within all of the unit's local
-    // elements:
-    SizeType local_elem_offset = 0;
-    auto unit = unit_at(global_coords);
-    // Global coords to local coords:
-    std::array<IndexType, NumDimensions> l_coords =
-      local_coords(global_coords);
-    DASH_LOG_TRACE_VAR("BlockPattern.at", l_coords);
-    if (unit == _team->myid()) {
-      // Coords are local to this unit, use pre-generated local memory
-      // layout
-      return _local_memory_layout.at(l_coords);
-    } else {
-      // Cannot use _local_memory_layout as it is only defined for the
-      // active unit but does not specify local memory of other units.
-      // Generate local memory layout for unit assigned to coords:
-      auto l_mem_layout =
-        LocalMemoryLayout_t(initialize_local_extents(unit));
-      return l_mem_layout.at(l_coords);
-    }
+    return local_index(global_coords).index;
   }
 
   /**
@@ -1224,12 +1218,14 @@ public:
    *
    * \see  DashPatternConcept
    */
-  constexpr SizeType local_size(
+  SizeType local_size(
     team_unit_t unit = UNDEFINED_TEAM_UNIT_ID) const noexcept
   {
-    return (unit == UNDEFINED_TEAM_UNIT_ID)
+    return (unit == UNDEFINED_TEAM_UNIT_ID || unit == _team->myid())
            ? _local_memory_layout.size()
-           : initialize_local_extents(unit).size();
+           // Non-local query, requires to construct local memory layout
+           // of remote unit:
+           : LocalMemoryLayout_t(initialize_local_extents(unit)).size();
   }
 
   /**
@@ -1391,6 +1387,8 @@ private:
          arguments.sizespec(),
          _distspec,
          _teamspec)),
+     _teamspec_div(initialize_divisors(_teamspec.extents())),
+     _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
      _blockspec(initialize_blockspec(
          arguments.sizespec(),
          _distspec,
@@ -1403,6 +1401,20 @@ private:
      _local_capacity(initialize_local_capacity())
   {}
 
+  /**
+   * Precompute divisors by the given extents in every dimension.
+   */
+  template<typename Extents>
+  static std::array<dash::math::Divisor<SizeType>, NumDimensions>
+  initialize_divisors(const Extents & extents)
+  {
+    std::array<dash::math::Divisor<SizeType>, NumDimensions> divisors;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      divisors[d] = dash::math::Divisor<SizeType>(extents[d]);
+    }
+    return divisors;
+  }
+
   /**
    * Initialize block size specs from memory layout, team spec and
    * distribution spec.
@@ -1542,7 +1554,16 @@ private:
       return ::std::array<SizeType, NumDimensions> {{ }};
     }
     // Coordinates of local unit id in team spec:
-    auto unit_ts_coords = _teamspec.coords(unit);
+    return initialize_local_extents(_teamspec.coords(unit));
+  }
+
+  /**
+   * Resolve extents of local memory layout for the unit at the specified
+   * coordinates in the team spec.
+   */
+  std::array<SizeType, NumDimensions> initialize_local_extents(
+      const std::array<IndexType, NumDimensions> & unit_ts_coords) const
+  {
     DASH_LOG_TRACE_VAR("BlockPattern.init_local_extents", unit_ts_coords);
     ::std::array<SizeType, NumDimensions> l_extents;
     for (auto d = 0; d < NumDimensions; ++d) {
@@ -117,6 +117,10 @@ private:
   SizeType                    _nunits          = 0;
   /// Maximum extents of a block in this pattern
   SizeType                    _blocksize       = 0;
+  /// Precomputed divisor by the number of units
+  dash::math::Divisor<SizeType> _nunits_div;
+  /// Precomputed divisor by the maximum block extent
+  dash::math::Divisor<SizeType> _blocksize_div;
   /// Number of blocks in all dimensions
   SizeType                    _nblocks         = 0;
   /// Actual number of local elements.
@@ -214,6 +218,8 @@ public:
         _size,
         _distspec,
         _nunits)),
+    _nunits_div(_nunits),
+    _blocksize_div(_blocksize),
     _nblocks(initialize_num_blocks(
         _size,
         _blocksize,
@@ -271,6 +277,8 @@ public:
         _size,
         _distspec,
         _nunits)),
+    _nunits_div(_nunits),
+    _blocksize_div(_blocksize),
     _nblocks(initialize_num_blocks(
         _size,
         _blocksize,
@@ -381,8 +389,9 @@ public:
     const std::array<IndexType, NumDimensions> & coords,
     /// View specification (offsets) to apply on \c coords
     const ViewSpec_t & viewspec) const {
-    return team_unit_t (((coords[0] + viewspec[0].offset) / _blocksize)
-                        % _nunits);
+    return team_unit_t(
+             _nunits_div.mod(
+               _blocksize_div.div(coords[0] + viewspec[0].offset)));
   }
 
   /**
@@ -392,7 +401,7 @@ public:
    */
   constexpr team_unit_t unit_at(
     const std::array<IndexType, NumDimensions> & coords) const {
-    return team_unit_t((coords[0] / _blocksize) % _nunits);
+    return team_unit_t(_nunits_div.mod(_blocksize_div.div(coords[0])));
   }
 
   /**
@@ -406,8 +415,9 @@ public:
     /// View to apply global position
     const ViewSpec_t & viewspec
   ) const {
-    return team_unit_t(((global_pos + viewspec[0].offset) / _blocksize)
-                       % _nunits);
+    return team_unit_t(
+             _nunits_div.mod(
+               _blocksize_div.div(global_pos + viewspec[0].offset)));
   }
 
   /**
@@ -419,7 +429,7 @@ public:
     /// Global linear element offset
     IndexType global_pos
   ) const {
-    return team_unit_t((global_pos / _blocksize) % _nunits);
+    return team_unit_t(_nunits_div.mod(_blocksize_div.div(global_pos)));
   }
 
   ////////////////////////////////////////////////////////////////////////////
@@ -568,8 +578,6 @@ public:
    * Converts global coordinates to their associated unit and its respective
    * local coordinates.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
   constexpr local_coords_t local(
@@ -583,13 +591,11 @@ public:
   /**
    * Converts global index to its associated unit and respective local index.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
   constexpr local_index_t local(
     IndexType g_index) const {
-    return local_index(coords(g_index));
+    return local_block_index(g_index, _blocksize_div.div(g_index));
   }
 
   /**
@@ -603,8 +609,9 @@ public:
   ) const noexcept {
     return std::array<IndexType, 1> {{
              static_cast<IndexType>(
-               (((global_coords[0] / _blocksize) / _nunits) * _blocksize)
-               + (global_coords[0] % _blocksize)
+               (_nunits_div.div(_blocksize_div.div(global_coords[0]))
+                * _blocksize)
+               + _blocksize_div.mod(global_coords[0])
              )
            }};
   }
@@ -616,10 +623,7 @@ public:
    */
   constexpr local_index_t local_index(
     const std::array<IndexType, NumDimensions> & g_coords) const {
-    return local_index_t {
-             team_unit_t(unit_at(g_coords[0])),
-             at(g_coords)
-           };
+    return local_block_index(g_coords[0], _blocksize_div.div(g_coords[0]));
   }
 
   ////////////////////////////////////////////////////////////////////////////
@@ -643,7 +647,7 @@ public:
                        local_coords[0],
                        _nunits)
                    ) * _blocksize)
-                  + (local_coords[0] % _blocksize)
+                  + _blocksize_div.mod(local_coords[0])
                 )
               }};
   }
@@ -812,7 +816,7 @@ public:
   constexpr index_type block_at(
     /// Global coordinates of element
     const std::array<index_type, NumDimensions> & g_coords) const {
-    return g_coords[0] / _blocksize;
+    return _blocksize_div.div(g_coords[0]);
   }
 
   /**
@@ -826,10 +830,10 @@ public:
     return local_index_t {
              // unit id:
              static_cast<team_unit_t>(
-                (g_coords[0] / _blocksize) % _teamspec.size()),
+                _nunits_div.mod(_blocksize_div.div(g_coords[0]))),
              // local block index:
              static_cast<index_type>(
-                (g_coords[0] / _blocksize) / _teamspec.size())
+                _nunits_div.div(_blocksize_div.div(g_coords[0])))
            };
   }
 
@@ -1091,6 +1095,21 @@ public:
 
 private:
 
+  /**
+   * Resolves the unit and the local index of the element at the given
+   * global index in the given global block.
+   */
+  constexpr local_index_t local_block_index(
+    IndexType g_index,
+    IndexType g_block) const {
+    return local_index_t {
+             team_unit_t(_nunits_div.mod(g_block)),
+             static_cast<IndexType>(
+               (_nunits_div.div(g_block) * _blocksize)
+               + (g_index - (g_block * _blocksize)))
+           };
+  }
+
   BlockPattern(const PatternArguments_t & arguments)
   :  _size(arguments.sizespec().size()),
      _memory_layout(std::array<SizeType, 1> {{ _size }}),
@@ -1102,6 +1121,8 @@ private:
          _size,
          _distspec,
          _nunits)),
+     _nunits_div(_nunits),
+     _blocksize_div(_blocksize),
      _nblocks(initialize_num_blocks(
          _size,
          _blocksize,
@@ -14,6 +14,7 @@
 #include <dash/internal/Math.h>
 #include <dash/internal/Logging.h>
 
+#include <algorithm>
 #include <functional>
 #include <array>
 #include <vector>
@@ -514,18 +515,15 @@ public:
     IndexType g_index) const
   {
     DASH_LOG_TRACE_VAR("CSRPattern.unit_at()", g_index);
-
-    for (team_unit_t unit_idx{0}; unit_idx < _nunits; ++unit_idx) {
-      if (g_index < _local_sizes[unit_idx]) {
-        DASH_LOG_TRACE_VAR("CSRPattern.unit_at >", unit_idx);
-        return unit_idx;
-      }
-      g_index -= _local_sizes[unit_idx];
+    if (g_index >= static_cast<IndexType>(_size)) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "CSRPattern.unit_at: " <<
+        "global index " << g_index << " is out of bounds");
     }
-    DASH_THROW(
-      dash::exception::InvalidArgument,
-      "CSRPattern.unit_at: " <<
-      "global index " << g_index << " is out of bounds");
+    team_unit_t unit_idx = block_unit_at(g_index);
+    DASH_LOG_TRACE_VAR("CSRPattern.unit_at >", unit_idx);
+    return unit_idx;
   }
 
   ////////////////////////////////////////////////////////////////////////
@@ -663,23 +661,19 @@ public:
     IndexType g_index) const
   {
     DASH_LOG_TRACE_VAR("CSRPattern.local()", g_index);
-    local_index_t l_index;
-
-    for (team_unit_t unit_idx{0}; unit_idx < _nunits; ++unit_idx) {
-      if (g_index < _local_sizes[unit_idx]) {
-        l_index.unit  = unit_idx;
-        l_index.index = g_index;
-        DASH_LOG_TRACE("CSRPattern.local >",
-                       "unit:",  l_index.unit,
-                       "index:", l_index.index);
-        return l_index;
-      }
-      g_index -= _local_sizes[unit_idx];
+    if (g_index >= static_cast<IndexType>(_size)) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "CSRPattern.local: " <<
+        "global index " << g_index << " is out of bounds");
     }
-    DASH_THROW(
-      dash::exception::InvalidArgument,
-      "CSRPattern.local: " <<
-      "global index " << g_index << " is out of bounds");
+    local_index_t l_index;
+    l_index.unit  = block_unit_at(g_index);
+    l_index.index = g_index - _block_offsets[l_index.unit];
+    DASH_LOG_TRACE("CSRPattern.local >",
+                   "unit:",  l_index.unit,
+                   "index:", l_index.index);
+    return l_index;
   }
 
   /**
@@ -1167,6 +1161,22 @@ private:
     _local_capacity(initialize_local_capacity(_local_sizes))
   {}
 
+  /**
+   * Resolve the unit mapped to the block containing the given global
+   * index by binary search in the block offsets.
+   */
+  inline team_unit_t block_unit_at(
+    IndexType g_index) const
+  {
+    // Units with empty blocks share their offset with the succeeding
+    // unit, upper bound resolves the last unit at an offset:
+    auto it = std::upper_bound(_block_offsets.begin(),
+                               _block_offsets.end(),
+                               static_cast<size_type>(g_index));
+    return team_unit_t(
+             static_cast<dart_unit_t>(it - _block_offsets.begin()) - 1);
+  }
+
   /**
    * Initialize the size (number of mapped elements) of the Pattern.
    */
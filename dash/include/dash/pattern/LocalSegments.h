@@ -0,0 +1,356 @@
+#ifndef DASH__PATTERN__LOCAL_SEGMENTS_H__INCLUDED
+#define DASH__PATTERN__LOCAL_SEGMENTS_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Contiguous run of elements in the local memory of a single unit,
+ * resolved from a sequence of global indices.
+ *
+ * \see dash::local_segments
+ *
+ * \ingroup DashPatternConcept
+ */
+template<typename IndexType>
+struct local_segment
+{
+  /// Unit the elements in the segment are mapped to
+  team_unit_t unit;
+  /// Global index of the first element in the segment
+  IndexType   gindex;
+  /// Local offset of the first element in the unit's local memory
+  IndexType   lindex;
+  /// Position of the first element in the translated sequence
+  IndexType   pos;
+  /// Number of elements in the segment
+  IndexType   size;
+};
+
+template<typename IndexType>
+std::ostream & operator<<(
+  std::ostream                    & os,
+  const local_segment<IndexType>  & seg)
+{
+  os << "dash::local_segment("
+     << "unit:"   << seg.unit   << " "
+     << "gindex:" << seg.gindex << " "
+     << "lindex:" << seg.lindex << " "
+     << "pos:"    << seg.pos    << " "
+     << "size:"   << seg.size   << ")";
+  return os;
+}
+
+namespace internal {
+
+/**
+ * Appends a run of elements to the segment list, extending the last
+ * segment if the run continues it in both global and local index space.
+ */
+template<typename IndexType>
+inline void append_local_segment(
+  std::vector<local_segment<IndexType>> & segments,
+  team_unit_t                             unit,
+  IndexType                               gindex,
+  IndexType                               lindex,
+  IndexType                               pos,
+  IndexType                               size)
+{
+  if (!segments.empty()) {
+    auto & last = segments.back();
+    if (last.unit == unit &&
+        last.gindex + last.size == gindex &&
+        last.lindex + last.size == lindex &&
+        last.pos    + last.size == pos) {
+      last.size += size;
+      return;
+    }
+  }
+  segments.push_back(
+    local_segment<IndexType> { unit, gindex, lindex, pos, size });
+}
+
+/**
+ * Orders segments by unit, preserving the order of segments of the same
+ * unit.
+ */
+template<typename IndexType>
+inline void sort_local_segments(
+  std::vector<local_segment<IndexType>> & segments)
+{
+  std::stable_sort(
+    segments.begin(), segments.end(),
+    [](const local_segment<IndexType> & a,
+       const local_segment<IndexType> & b) {
+      return a.unit < b.unit;
+    });
+}
+
+/**
+ * Resolves local segments of a global index range block by block.
+ * Elements in a block of a one-dimensional pattern are contiguous in
+ * the local memory of the block's unit, so translation of a single
+ * global index per block is sufficient.
+ */
+template<class PatternType>
+void local_segments_in_range(
+  const PatternType                                          & pattern,
+  typename PatternType::index_type                             g_begin,
+  typename PatternType::index_type                             g_end,
+  std::vector<local_segment<typename PatternType::index_type>> & segments,
+  std::integral_constant<bool, true>)
+{
+  typedef typename PatternType::index_type index_t;
+  for (index_t g = g_begin; g < g_end;) {
+    auto    l_pos   = pattern.local(g);
+    auto    block   = pattern.block(
+                        pattern.block_at(std::array<index_t, 1> {{ g }}));
+    index_t b_end   = block.offset(0) + block.extent(0);
+    index_t size    = std::min(b_end, g_end) - g;
+    if (size <= 0) {
+      // Empty or underfilled block, fall back to single element:
+      size = 1;
+    }
+    append_local_segment<index_t>(
+      segments, l_pos.unit, g, l_pos.index, g - g_begin, size);
+    g += size;
+  }
+}
+
+/**
+ * Resolves local segments of a global index range element by element,
+ * for multidimensional patterns.
+ */
+template<class PatternType>
+void local_segments_in_range(
+  const PatternType                                          & pattern,
+  typename PatternType::index_type                             g_begin,
+  typename PatternType::index_type                             g_end,
+  std::vector<local_segment<typename PatternType::index_type>> & segments,
+  std::integral_constant<bool, false>)
+{
+  typedef typename PatternType::index_type index_t;
+  for (index_t g = g_begin; g < g_end; ++g) {
+    auto l_pos = pattern.local(g);
+    append_local_segment<index_t>(
+      segments, l_pos.unit, g, l_pos.index, g - g_begin, 1);
+  }
+}
+
+/**
+ * Resolves segments of the calling unit's local elements in a global index
+ * range block by block, for one-dimensional patterns.
+ */
+template<class PatternType>
+void unit_local_segments_in_range(
+  const PatternType                                          & pattern,
+  typename PatternType::index_type                             g_begin,
+  typename PatternType::index_type                             g_end,
+  std::vector<local_segment<typename PatternType::index_type>> & segments,
+  std::integral_constant<bool, true>)
+{
+  typedef typename PatternType::index_type index_t;
+  auto    myid  = pattern.team().myid();
+  index_t lsize = pattern.local_size();
+  for (index_t l = 0; l < lsize;) {
+    // Local elements of a block are contiguous in global index space:
+    index_t g       = pattern.global(l);
+    auto    block   = pattern.block(
+                        pattern.block_at(std::array<index_t, 1> {{ g }}));
+    index_t b_end   = block.offset(0) + block.extent(0);
+    index_t size    = std::min(b_end - g, lsize - l);
+    if (size <= 0) {
+      // Empty or underfilled block, fall back to single element:
+      size = 1;
+    }
+    index_t begin   = std::max(g, g_begin);
+    index_t end     = std::min(g + size, g_end);
+    if (begin < end) {
+      append_local_segment<index_t>(
+        segments, myid, begin, l + (begin - g), begin - g_begin,
+        end - begin);
+    }
+    l += size;
+  }
+}
+
+/**
+ * Resolves segments of the calling unit's local elements in a global index
+ * range element by element, for multidimensional patterns.
+ */
+template<class PatternType>
+void unit_local_segments_in_range(
+  const PatternType                                          & pattern,
+  typename PatternType::index_type                             g_begin,
+  typename PatternType::index_type                             g_end,
+  std::vector<local_segment<typename PatternType::index_type>> & segments,
+  std::integral_constant<bool, false>)
+{
+  typedef typename PatternType::index_type index_t;
+  auto    myid  = pattern.team().myid();
+  index_t lsize = pattern.local_size();
+  for (index_t l = 0; l < lsize; ++l) {
+    index_t g = pattern.global(l);
+    if (g >= g_begin && g < g_end) {
+      append_local_segment<index_t>(
+        segments, myid, g, l, g - g_begin, 1);
+    }
+  }
+}
+
+} // namespace internal
+
+/**
+ * Translates the global index range \c [g_begin, g_end) of a pattern to
+ * contiguous segments in the local memory of units.
+ *
+ * Segments are ordered by unit and, for every unit, by global index.
+ * Subsequent elements that are contiguous in both global and local index
+ * space are coalesced to a single segment, so a transfer of the range
+ * requires a single operation per segment instead of per element.
+ *
+ * \returns  List of segments, ordered by unit.
+ *
+ * \complexity  O(b) pattern queries for \c b blocks in the range of
+ *              one-dimensional patterns, O(n) for \c n elements in the
+ *              range of multidimensional patterns.
+ *
+ * \ingroup DashPatternConcept
+ */
+template<class PatternType>
+std::vector<local_segment<typename PatternType::index_type>>
+local_segments(
+  /// Pattern to resolve local segments from
+  const PatternType                & pattern,
+  /// Global index of the first element in the range
+  typename PatternType::index_type   g_begin,
+  /// Global index past the last element in the range
+  typename PatternType::index_type   g_end)
+{
+  typedef typename PatternType::index_type index_t;
+  DASH_LOG_TRACE("dash::local_segments()", "range:", g_begin, g_end);
+  std::vector<local_segment<index_t>> segments;
+  internal::local_segments_in_range(
+    pattern, g_begin, g_end, segments,
+    std::integral_constant<bool, PatternType::ndim() == 1>());
+  internal::sort_local_segments(segments);
+  DASH_LOG_TRACE("dash::local_segments >", "segments:", segments.size());
+  return segments;
+}
+
+/**
+ * Translates the elements of the global index range \c [g_begin, g_end)
+ * of a pattern that are local to the calling unit to contiguous segments
+ * in its local memory.
+ *
+ * Unlike \c dash::local_segments, only the calling unit's local blocks or
+ * elements are visited, so the cost does not depend on the size of the
+ * global range.
+ *
+ * \returns  List of segments of the calling unit, ordered by local index.
+ *
+ * \complexity  O(b) pattern queries for \c b local blocks of
+ *              one-dimensional patterns, O(n) for \c n local elements of
+ *              multidimensional patterns.
+ *
+ * \ingroup DashPatternConcept
+ */
+template<class PatternType>
+std::vector<local_segment<typename PatternType::index_type>>
+unit_local_segments(
+  /// Pattern to resolve local segments from
+  const PatternType                & pattern,
+  /// Global index of the first element in the range
+  typename PatternType::index_type   g_begin,
+  /// Global index past the last element in the range
+  typename PatternType::index_type   g_end)
+{
+  typedef typename PatternType::index_type index_t;
+  DASH_LOG_TRACE("dash::unit_local_segments()", "range:", g_begin, g_end);
+  std::vector<local_segment<index_t>> segments;
+  internal::unit_local_segments_in_range(
+    pattern, g_begin, g_end, segments,
+    std::integral_constant<bool, PatternType::ndim() == 1>());
+  DASH_LOG_TRACE("dash::unit_local_segments >",
+                 "segments:", segments.size());
+  return segments;
+}
+
+/**
+ * Translates a sequence of global indices of a pattern to contiguous
+ * segments in the local memory of units.
+ *
+ * Indices are translated in a first pass into separate arrays of units
+ * and local offsets, subsequent indices that are contiguous in both global
+ * and local index space are then coalesced to a single segment.
+ * The position of a segment's first index in the input sequence is
+ * stored in \c local_segment::pos, e.g. to gather and scatter values of
+ * an index list.
+ *
+ * \returns  List of segments, ordered by unit.
+ *
+ * \complexity  O(n) pattern queries for \c n indices
+ *
+ * \ingroup DashPatternConcept
+ */
+template<
+  class PatternType,
+  class InputIt,
+  typename = typename std::enable_if<
+               !std::is_integral<InputIt>::value >::type >
+std::vector<local_segment<typename PatternType::index_type>>
+local_segments(
+  /// Pattern to resolve local segments from
+  const PatternType & pattern,
+  /// Iterator to the first global index in the sequence
+  InputIt             g_first,
+  /// Iterator past the last global index in the sequence
+  InputIt             g_last)
+{
+  typedef typename PatternType::index_type index_t;
+  std::vector<index_t>     g_indices(g_first, g_last);
+  auto                     num_indices = g_indices.size();
+  std::vector<dart_unit_t> units(num_indices);
+  std::vector<index_t>     l_indices(num_indices);
+  DASH_LOG_TRACE("dash::local_segments()", "indices:", num_indices);
+  for (size_t i = 0; i < num_indices; ++i) {
+    auto l_pos   = pattern.local(g_indices[i]);
+    units[i]     = l_pos.unit.id;
+    l_indices[i] = l_pos.index;
+  }
+  std::vector<local_segment<index_t>> segments;
+  for (size_t i = 0; i < num_indices;) {
+    size_t n = 1;
+    while (i + n < num_indices &&
+           units[i + n]     == units[i] &&
+           g_indices[i + n] == g_indices[i] + static_cast<index_t>(n) &&
+           l_indices[i + n] == l_indices[i] + static_cast<index_t>(n)) {
+      ++n;
+    }
+    segments.push_back(
+      local_segment<index_t> {
+        team_unit_t(units[i]),
+        g_indices[i],
+        l_indices[i],
+        static_cast<index_t>(i),
+        static_cast<index_t>(n) });
+    i += n;
+  }
+  internal::sort_local_segments(segments);
+  DASH_LOG_TRACE("dash::local_segments >", "segments:", segments.size());
+  return segments;
+}
+
+} // namespace dash
+
+#endif // DASH__PATTERN__LOCAL_SEGMENTS_H__INCLUDED
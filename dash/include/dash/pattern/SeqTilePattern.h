@@ -136,6 +136,10 @@ private:
   SizeType                    _nunits          = dash::Team::All().size();
   /// Maximum extents of a block in this pattern
   BlockSizeSpec_t             _blocksize_spec;
+  /// Precomputed divisor by the number of units
+  dash::math::Divisor<SizeType> _nunits_div;
+  /// Precomputed divisors by the maximum block extent in every dimension
+  std::array<dash::math::Divisor<SizeType>, NumDimensions> _blocksize_div;
   /// Arrangement of blocks in all dimensions
   BlockSpec_t                 _blockspec;
   /// Arrangement of local blocks in all dimensions
@@ -259,6 +263,8 @@ public:
         sizespec,
         _distspec,
         _teamspec)),
+    _nunits_div(_nunits),
+    _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
     _blockspec(initialize_blockspec(
         sizespec,
         _blocksize_spec,
@@ -325,6 +331,8 @@ public:
         sizespec,
         _distspec,
         _teamspec)),
+    _nunits_div(_nunits),
+    _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
     _blockspec(initialize_blockspec(
         sizespec,
         _blocksize_spec,
@@ -350,6 +358,8 @@ public:
     _memory_layout(other._memory_layout),
     _nunits(other._nunits),
     _blocksize_spec(other._blocksize_spec),
+    _nunits_div(other._nunits_div),
+    _blocksize_div(other._blocksize_div),
     _blockspec(other._blockspec),
     _local_blockspec(other._local_blockspec),
     _local_memory_layout(other._local_memory_layout),
@@ -411,6 +421,8 @@ public:
       _memory_layout       = other._memory_layout;
       _local_memory_layout = other._local_memory_layout;
       _blocksize_spec      = other._blocksize_spec;
+      _nunits_div          = other._nunits_div;
+      _blocksize_div       = other._blocksize_div;
       _blockspec           = other._blockspec;
       _local_blockspec     = other._local_blockspec;
       _local_capacity      = other._local_capacity;
@@ -461,11 +473,11 @@ public:
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord      = coords[d] + viewspec.offset(d);
       // Global block coordinate:
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
     }
     auto block_idx = _blockspec.at(block_coords);
 
-    team_unit_t unit_id(block_idx % _nunits);
+    team_unit_t unit_id(_nunits_div.mod(block_idx));
     DASH_LOG_TRACE_VAR("SeqTilePattern.unit_at", block_coords);
     DASH_LOG_TRACE_VAR("SeqTilePattern.unit_at", block_idx);
     DASH_LOG_TRACE_VAR("SeqTilePattern.unit_at >", unit_id);
@@ -487,10 +499,10 @@ public:
     // e.g (x + y + z) % nunits
     for (auto d = 0; d < NumDimensions; ++d) {
       // Global block coordinate:
-      block_coords[d]   = coords[d] / _blocksize_spec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(coords[d]);
     }
     auto block_idx = _blockspec.at(block_coords);
-    team_unit_t unit_id(block_idx % _nunits);
+    team_unit_t unit_id(_nunits_div.mod(block_idx));
     DASH_LOG_TRACE_VAR("SeqTilePattern.unit_at", block_coords);
     DASH_LOG_TRACE_VAR("SeqTilePattern.unit_at", block_idx);
     DASH_LOG_TRACE_VAR("SeqTilePattern.unit_at >", unit_id);
@@ -623,8 +635,8 @@ public:
       auto vs_offset_d  = viewspec.offset(d);
       auto vs_coord_d   = local_coords[d] + vs_offset_d;
       auto block_size_d = _blocksize_spec.extent(d);
-      phase_coords[d]   = vs_coord_d % block_size_d;
-      block_coords_l[d] = vs_coord_d / block_size_d;
+      block_coords_l[d] = _blocksize_div[d].div(vs_coord_d);
+      phase_coords[d]   = vs_coord_d - (block_coords_l[d] * block_size_d);
     }
     DASH_LOG_TRACE("SeqTilePattern.local_at",
                    "local_coords:",       local_coords,
@@ -660,8 +672,8 @@ public:
     for (auto d = 0; d < NumDimensions; ++d) {
       auto gcoord_d     = local_coords[d];
       auto block_size_d = _blocksize_spec.extent(d);
-      phase_coords[d]   = gcoord_d % block_size_d;
-      block_coords_l[d] = gcoord_d / block_size_d;
+      block_coords_l[d] = _blocksize_div[d].div(gcoord_d);
+      phase_coords[d]   = gcoord_d - (block_coords_l[d] * block_size_d);
     }
     DASH_LOG_TRACE("SeqTilePattern.local_at",
                    "local_coords:",       local_coords,
@@ -693,12 +705,12 @@ public:
     std::array<IndexType, NumDimensions> phase;
     for (dim_t d = 0; d < NumDimensions; ++d) {
       auto blocksize_d  = _blocksize_spec.extent(d);
-      g_block_coords[d] = global_coords[d] / blocksize_d;
-      phase[d]          = global_coords[d] % blocksize_d;
+      g_block_coords[d] = _blocksize_div[d].div(global_coords[d]);
+      phase[d]          = global_coords[d] - (g_block_coords[d] * blocksize_d);
     }
     auto g_block_index = _blockspec.at(g_block_coords);
-    l_coords.unit      = g_block_index % _nunits;
-    auto l_block_index = g_block_index / _nunits;
+    l_coords.unit      = _nunits_div.mod(g_block_index);
+    auto l_block_index = _nunits_div.div(g_block_index);
     local_coords[0]    = l_block_index * _blocksize_spec.extent(0) +
                          phase[0];
     for (dim_t d = 1; d < NumDimensions; ++d) {
@@ -712,16 +724,12 @@ public:
    * Converts global index to its associated unit and respective local
    * index.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
   local_index_t local(
     IndexType g_index) const
   {
     DASH_LOG_TRACE_VAR("SeqTilePattern.local()", g_index);
-    // TODO: Implement dedicated method for this, conversion to/from
-    //       global coordinates is expensive.
     return local_index(coords(g_index));
   }
 
@@ -738,8 +746,8 @@ public:
     for (dim_t d = 0; d < NumDimensions; ++d) {
       auto nunits_d        = _teamspec.extent(d);
       auto blocksize_d     = _blocksize_spec.extent(d);
-      auto block_coord_d   = global_coords[d] / blocksize_d;
-      auto phase_d         = global_coords[d] % blocksize_d;
+      auto block_coord_d   = _blocksize_div[d].div(global_coords[d]);
+      auto phase_d         = global_coords[d] - (block_coord_d * blocksize_d);
       auto l_block_coord_d = block_coord_d / nunits_d;
       local_coords[d]      = (l_block_coord_d * blocksize_d) + phase_d;
     }
@@ -764,12 +772,13 @@ public:
     std::array<IndexType, NumDimensions> l_block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord     = global_coords[d];
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      phase_coords[d]   = vs_coord
+                          - (block_coords[d] * _blocksize_spec.extent(d));
     }
     index_type g_block_index = _blockspec.at(block_coords);
-    team_unit_t unit(g_block_index % _nunits);
-    auto l_block_index       = g_block_index / _nunits;
+    team_unit_t unit(_nunits_div.mod(g_block_index));
+    auto l_block_index       = _nunits_div.div(g_block_index);
     DASH_LOG_TRACE("SeqTilePattern.at",
                    "block_coords:",   block_coords,
                    "g_block_index:",  g_block_index,
@@ -919,8 +928,9 @@ public:
     std::array<IndexType, NumDimensions> block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord   = global_coords[d] + viewspec.offset(d);
-      phase_coords[d] = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d] = vs_coord / _blocksize_spec.extent(d);
+      block_coords[d] = _blocksize_div[d].div(vs_coord);
+      phase_coords[d] = vs_coord
+                        - (block_coords[d] * _blocksize_spec.extent(d));
     }
     DASH_LOG_TRACE("SeqTilePattern.global_at",
                    "block coords:", block_coords,
@@ -960,8 +970,9 @@ public:
     std::array<IndexType, NumDimensions> block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord   = global_coords[d];
-      phase_coords[d] = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d] = vs_coord / _blocksize_spec.extent(d);
+      block_coords[d] = _blocksize_div[d].div(vs_coord);
+      phase_coords[d] = vs_coord
+                        - (block_coords[d] * _blocksize_spec.extent(d));
     }
     DASH_LOG_TRACE("SeqTilePattern.global_at",
                    "block coords:", block_coords,
@@ -1003,11 +1014,12 @@ public:
     std::array<IndexType, NumDimensions> l_block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord     = global_coords[d] + viewspec.offset(d);
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      phase_coords[d]   = vs_coord
+                          - (block_coords[d] * _blocksize_spec.extent(d));
     }
     index_type g_block_index = _blockspec.at(block_coords);
-    auto l_block_index       = g_block_index / _nunits;
+    auto l_block_index       = _nunits_div.div(g_block_index);
     DASH_LOG_TRACE("SeqTilePattern.at",
                    "block_coords:",   block_coords,
                    "g_block_index:",  g_block_index,
@@ -1040,11 +1052,12 @@ public:
     std::array<IndexType, NumDimensions> l_block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord     = global_coords[d];
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      phase_coords[d]   = vs_coord
+                          - (block_coords[d] * _blocksize_spec.extent(d));
     }
     index_type g_block_index = _blockspec.at(block_coords);
-    auto l_block_index       = g_block_index / _nunits;
+    auto l_block_index       = _nunits_div.div(g_block_index);
     DASH_LOG_TRACE("SeqTilePattern.at",
                    "block_coords:",   block_coords,
                    "g_block_index:",  g_block_index,
@@ -1102,7 +1115,7 @@ public:
     // Apply viewspec offset in dimension to given position
     dim_offset += viewspec[dim].offset;
     // Offset to block offset
-    IndexType block_coord_d    = dim_offset / _blocksize_spec.extent(dim);
+    IndexType block_coord_d    = _blocksize_div[dim].div(dim_offset);
     DASH_LOG_TRACE_VAR("SeqTilePattern.has_local_elements", block_coord_d);
     // Coordinate of unit in team spec in given dimension
     IndexType teamspec_coord_d = block_coord_d % _teamspec.extent(dim);
@@ -1158,7 +1171,7 @@ public:
     std::array<index_type, NumDimensions> block_coords;
     // Coord to block coord to unit coord:
     for (auto d = 0; d < NumDimensions; ++d) {
-      block_coords[d] = g_coords[d] / _blocksize_spec.extent(d);
+      block_coords[d] = _blocksize_div[d].div(g_coords[d]);
     }
     // Block coord to block index:
     auto block_idx = _blockspec.at(block_coords);
@@ -1474,6 +1487,8 @@ private:
         arguments.sizespec(),
         _distspec,
         _teamspec)),
+    _nunits_div(_nunits),
+    _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
     _blockspec(initialize_blockspec(
         arguments.sizespec(),
         _blocksize_spec,
@@ -1486,6 +1501,20 @@ private:
         initialize_local_capacity(_local_memory_layout))
   {}
 
+  /**
+   * Precompute divisors by the given extents in every dimension.
+   */
+  template<typename Extents>
+  static std::array<dash::math::Divisor<SizeType>, NumDimensions>
+  initialize_divisors(const Extents & extents)
+  {
+    std::array<dash::math::Divisor<SizeType>, NumDimensions> divisors;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      divisors[d] = dash::math::Divisor<SizeType>(extents[d]);
+    }
+    return divisors;
+  }
+
   /**
    * Initialize block size specs from memory layout, team spec and
    * distribution spec.
@@ -134,6 +134,10 @@ private:
   dim_t                       _minor_tiled_dim;
   /// Maximum extents of a block in this pattern
   BlockSizeSpec_t             _blocksize_spec;
+  /// Precomputed divisor by the number of units
+  dash::math::Divisor<SizeType> _nunits_div;
+  /// Precomputed divisors by the maximum block extent in every dimension
+  std::array<dash::math::Divisor<SizeType>, NumDimensions> _blocksize_div;
   /// Arrangement of blocks in all dimensions
   BlockSpec_t                 _blockspec;
   /// Arrangement of local blocks in all dimensions
@@ -259,6 +263,8 @@ public:
         sizespec,
         _distspec,
         _teamspec)),
+    _nunits_div(_nunits),
+    _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
     _blockspec(initialize_blockspec(
         sizespec,
         _blocksize_spec,
@@ -327,6 +333,8 @@ public:
         sizespec,
         _distspec,
         _teamspec)),
+    _nunits_div(_nunits),
+    _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
     _blockspec(initialize_blockspec(
         sizespec,
         _blocksize_spec,
@@ -354,6 +362,8 @@ public:
     _major_tiled_dim(other._major_tiled_dim),
     _minor_tiled_dim(other._minor_tiled_dim),
     _blocksize_spec(other._blocksize_spec),
+    _nunits_div(other._nunits_div),
+    _blocksize_div(other._blocksize_div),
     _blockspec(other._blockspec),
     _local_blockspec(other._local_blockspec),
     _local_memory_layout(other._local_memory_layout),
@@ -415,6 +425,8 @@ public:
       _memory_layout       = other._memory_layout;
       _local_memory_layout = other._local_memory_layout;
       _blocksize_spec      = other._blocksize_spec;
+      _nunits_div          = other._nunits_div;
+      _blocksize_div       = other._blocksize_div;
       _blockspec           = other._blockspec;
       _local_blockspec     = other._local_blockspec;
       _local_capacity      = other._local_capacity;
@@ -469,10 +481,10 @@ public:
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord     = coords[d] + viewspec.offset(d);
       // Global block coordinate:
-      auto block_coord  = vs_coord / _blocksize_spec.extent(d);
+      auto block_coord  = _blocksize_div[d].div(vs_coord);
       unit_id          += block_coord;
     }
-    unit_id %= _nunits;
+    unit_id = team_unit_t(_nunits_div.mod(unit_id.id));
     DASH_LOG_TRACE_VAR("ShiftTilePattern.unit_at >", unit_id);
     return unit_id;
   }
@@ -493,10 +505,10 @@ public:
     team_unit_t unit_id{0};
     for (auto d = 0; d < NumDimensions; ++d) {
       // Global block coordinate:
-      auto block_coord  = coords[d] / _blocksize_spec.extent(d);
+      auto block_coord  = _blocksize_div[d].div(coords[d]);
       unit_id          += block_coord;
     }
-    unit_id %= _nunits;
+    unit_id = team_unit_t(_nunits_div.mod(unit_id.id));
     DASH_LOG_TRACE_VAR("ShiftTilePattern.unit_at >", unit_id);
     return unit_id;
   }
@@ -618,8 +630,8 @@ public:
       auto vs_offset_d  = viewspec.offset(d);
       auto vs_coord_d   = local_coords[d] + vs_offset_d;
       auto block_size_d = _blocksize_spec.extent(d);
-      phase_coords[d]   = vs_coord_d % block_size_d;
-      block_coords_l[d] = vs_coord_d / block_size_d;
+      block_coords_l[d] = _blocksize_div[d].div(vs_coord_d);
+      phase_coords[d]   = vs_coord_d - (block_coords_l[d] * block_size_d);
     }
     DASH_LOG_TRACE("ShiftTilePattern.local_at",
                    "local block coords:", block_coords_l,
@@ -651,8 +663,8 @@ public:
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord_d   = local_coords[d];
       auto block_size_d = _blocksize_spec.extent(d);
-      phase_coords[d]   = vs_coord_d % block_size_d;
-      block_coords_l[d] = vs_coord_d / block_size_d;
+      block_coords_l[d] = _blocksize_div[d].div(vs_coord_d);
+      phase_coords[d]   = vs_coord_d - (block_coords_l[d] * block_size_d);
     }
     DASH_LOG_TRACE("ShiftTilePattern.local_at",
                    "local block coords:", block_coords_l,
@@ -670,8 +682,6 @@ public:
    * Converts global coordinates to their associated unit and its respective
    * local coordinates.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
   local_coords_t local(
@@ -686,18 +696,13 @@ public:
   /**
    * Converts global index to its associated unit and respective local index.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
   local_index_t local(
     IndexType g_index) const
   {
     DASH_LOG_TRACE_VAR("ShiftTilePattern.local()", g_index);
-    // TODO: Implement dedicated method for this, conversion to/from
-    //       global coordinates is expensive.
-    auto g_coords = coords(g_index);
-    return local_index(g_coords);
+    return local_index(coords(g_index));
   }
 
   /**
@@ -712,11 +717,12 @@ public:
     std::array<IndexType, NumDimensions> local_coords = global_coords;
     auto blocksize_d = _blocksize_spec.extent(_major_tiled_dim);
     auto coord_d     = global_coords[_major_tiled_dim];
+    auto block_d     = _blocksize_div[_major_tiled_dim].div(coord_d);
     local_coords[_major_tiled_dim] =
       // Local block offset
-      (coord_d / (blocksize_d * _nunits)) * blocksize_d +
+      _nunits_div.div(block_d) * blocksize_d +
       // Phase
-      (coord_d % blocksize_d);
+      (coord_d - (block_d * blocksize_d));
     return local_coords;
   }
 
@@ -729,20 +735,28 @@ public:
     const std::array<IndexType, NumDimensions> & global_coords) const
   {
     DASH_LOG_TRACE_VAR("Pattern.local_index()", global_coords);
-    // Local offset of the element within all of the unit's local
-    // elements:
-    auto unit = unit_at(global_coords);
-#ifdef __OLD__
-    // Global coords to local coords:
-    std::array<IndexType, NumDimensions> l_coords =
-      local_coords(global_coords);
-    // Local coords to local offset:
-    auto l_index = local_at(l_coords);
-#endif
-    auto l_index = at(global_coords);
+    // Resolve block and phase coordinates once for both the unit and the
+    // local offset of the element:
+    std::array<IndexType, NumDimensions> phase_coords;
+    std::array<IndexType, NumDimensions> block_coords;
+    IndexType block_coords_sum = 0;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      auto coord        = global_coords[d];
+      block_coords[d]   = _blocksize_div[d].div(coord);
+      phase_coords[d]   = coord
+                          - (block_coords[d] * _blocksize_spec.extent(d));
+      block_coords_sum += block_coords[d];
+    }
+    // Unit id from diagonals in cartesian index space:
+    team_unit_t unit(_nunits_div.mod(block_coords_sum));
+    // Number of blocks preceeding the coordinates' block, equivalent
+    // to linear global block offset divided by team size:
+    auto block_offset_l = _nunits_div.div(_blockspec.at(block_coords));
+    IndexType l_index   = block_offset_l * _blocksize_spec.size() +
+                          _blocksize_spec.at(phase_coords);
     DASH_LOG_TRACE_VAR("Pattern.local_index >", l_index);
 
-    return local_index_t { team_unit_t(unit), l_index };
+    return local_index_t { unit, l_index };
   }
 
   ////////////////////////////////////////////////////////////////////////////
@@ -889,8 +903,9 @@ public:
     std::array<IndexType, NumDimensions> block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord     = global_coords[d] + viewspec.offset(d);
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      phase_coords[d]   = vs_coord
+                          - (block_coords[d] * _blocksize_spec.extent(d));
     }
     DASH_LOG_TRACE("ShiftTilePattern.global_at",
                    "block coords:", block_coords,
@@ -929,8 +944,9 @@ public:
     std::array<IndexType, NumDimensions> block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord     = global_coords[d];
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      phase_coords[d]   = vs_coord
+                          - (block_coords[d] * _blocksize_spec.extent(d));
     }
     DASH_LOG_TRACE("ShiftTilePattern.global_at",
                    "block coords:", block_coords,
@@ -974,8 +990,9 @@ public:
     std::array<IndexType, NumDimensions> block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord     = global_coords[d] + viewspec.offset(d);
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      phase_coords[d]   = vs_coord
+                          - (block_coords[d] * _blocksize_spec.extent(d));
     }
     DASH_LOG_TRACE("ShiftTilePattern.at",
                    "block_coords:", block_coords,
@@ -984,7 +1001,7 @@ public:
     // to linear global block offset divided by team size:
     DASH_LOG_TRACE_VAR("ShiftTilePattern.at", _blockspec.extents());
     auto block_index   = _blockspec.at(block_coords);
-    auto block_index_l = block_index / _nunits;
+    auto block_index_l = _nunits_div.div(block_index);
     DASH_LOG_TRACE("ShiftTilePattern.at",
                    "global block index:",block_index,
                    "nunits:",            _nunits,
@@ -1016,8 +1033,8 @@ public:
     std::array<IndexType, NumDimensions> block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto coord      = global_coords[d];
-      phase_coords[d] = coord % _blocksize_spec.extent(d);
-      block_coords[d] = coord / _blocksize_spec.extent(d);
+      block_coords[d] = _blocksize_div[d].div(coord);
+      phase_coords[d] = coord - (block_coords[d] * _blocksize_spec.extent(d));
     }
     DASH_LOG_TRACE_VAR("ShiftTilePattern.at", block_coords);
     DASH_LOG_TRACE_VAR("ShiftTilePattern.at", phase_coords);
@@ -1025,7 +1042,7 @@ public:
     // to linear global block offset divided by team size:
     DASH_LOG_TRACE_VAR("ShiftTilePattern.at", _blockspec.extents());
     auto block_offset   = _blockspec.at(block_coords);
-    auto block_offset_l = block_offset / _nunits;
+    auto block_offset_l = _nunits_div.div(block_offset);
     DASH_LOG_TRACE_VAR("ShiftTilePattern.at", block_offset);
     DASH_LOG_TRACE_VAR("ShiftTilePattern.at", _nunits);
     DASH_LOG_TRACE_VAR("ShiftTilePattern.at", block_offset_l);
@@ -1079,7 +1096,7 @@ public:
     // Apply viewspec offset in dimension to given position
     dim_offset += viewspec[dim].offset;
     // Offset to block offset
-    IndexType block_coord_d    = dim_offset / _blocksize_spec.extent(dim);
+    IndexType block_coord_d    = _blocksize_div[dim].div(dim_offset);
     DASH_LOG_TRACE_VAR("ShiftTilePattern.has_local_elements", block_coord_d);
     // Coordinate of unit in team spec in given dimension
     IndexType teamspec_coord_d = block_coord_d % _teamspec.extent(dim);
@@ -1135,7 +1152,7 @@ public:
     std::array<index_type, NumDimensions> block_coords;
     // Coord to block coord to unit coord:
     for (auto d = 0; d < NumDimensions; ++d) {
-      block_coords[d] = g_coords[d] / _blocksize_spec.extent(d);
+      block_coords[d] = _blocksize_div[d].div(g_coords[d]);
     }
     // Block coord to block index:
     auto block_idx = _blockspec.at(block_coords);
@@ -1453,6 +1470,8 @@ private:
         arguments.sizespec(),
         _distspec,
         _teamspec)),
+    _nunits_div(_nunits),
+    _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
     _blockspec(initialize_blockspec(
         arguments.sizespec(),
         _blocksize_spec,
@@ -1465,6 +1484,20 @@ private:
         initialize_local_extents(_team->myid())),
     _local_capacity(initialize_local_capacity())
   {}
+  /**
+   * Precompute divisors by the given extents in every dimension.
+   */
+  template<typename Extents>
+  static std::array<dash::math::Divisor<SizeType>, NumDimensions>
+  initialize_divisors(const Extents & extents)
+  {
+    std::array<dash::math::Divisor<SizeType>, NumDimensions> divisors;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      divisors[d] = dash::math::Divisor<SizeType>(extents[d]);
+    }
+    return divisors;
+  }
+
   /**
    * Initialize block size specs from memory layout, team spec and
    * distribution spec.
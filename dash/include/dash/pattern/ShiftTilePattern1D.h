@@ -121,6 +121,10 @@ private:
   SizeType                    _nunits          = 0;
   /// Maximum extents of a block in this pattern
   SizeType                    _blocksize       = 0;
+  /// Precomputed divisor by the number of units
+  dash::math::Divisor<SizeType> _nunits_div;
+  /// Precomputed divisor by the maximum block extent
+  dash::math::Divisor<SizeType> _blocksize_div;
   /// Number of blocks in all dimensions
   SizeType                    _nblocks         = 0;
   /// Actual number of local elements.
@@ -219,6 +223,8 @@ public:
         _size,
         _distspec,
         _nunits)),
+    _nunits_div(_nunits),
+    _blocksize_div(_blocksize),
     _nblocks(initialize_num_blocks(
         _size,
         _blocksize,
@@ -278,6 +284,8 @@ public:
         _size,
         _distspec,
         _nunits)),
+    _nunits_div(_nunits),
+    _blocksize_div(_blocksize),
     _nblocks(initialize_num_blocks(
         _size,
         _blocksize,
@@ -305,6 +313,8 @@ public:
     _teamspec(other._teamspec),
     _nunits(other._nunits),
     _blocksize(other._blocksize),
+    _nunits_div(other._nunits_div),
+    _blocksize_div(other._blocksize_div),
     _nblocks(other._nblocks),
     _nlblocks(other._nlblocks),
     _local_size(other._local_size),
@@ -373,6 +383,8 @@ public:
       _local_size          = other._local_size;
       _local_memory_layout = other._local_memory_layout;
       _blocksize           = other._blocksize;
+      _nunits_div          = other._nunits_div;
+      _blocksize_div       = other._blocksize_div;
       _nblocks             = other._nblocks;
       _nlblocks            = other._nlblocks;
       _local_capacity      = other._local_capacity;
@@ -418,8 +430,9 @@ public:
     const ViewSpec_t & viewspec) const {
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.unit_at()", coords);
     // Apply viewspec offsets to coordinates:
-    team_unit_t unit_id(((coords[0] + viewspec[0].offset) / _blocksize)
-                          % _nunits);
+    team_unit_t unit_id(
+                  _nunits_div.mod(
+                    _blocksize_div.div(coords[0] + viewspec[0].offset)));
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.unit_at >", unit_id);
     return unit_id;
   }
@@ -432,7 +445,7 @@ public:
   team_unit_t unit_at(
     const std::array<IndexType, NumDimensions> & coords) const {
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.unit_at()", coords);
-    team_unit_t unit_id((coords[0] / _blocksize) % _nunits);
+    team_unit_t unit_id(_nunits_div.mod(_blocksize_div.div(coords[0])));
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.unit_at >", unit_id);
     return unit_id;
   }
@@ -450,8 +463,9 @@ public:
   ) const {
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.unit_at()", global_pos);
     // Apply viewspec offsets to coordinates:
-    team_unit_t unit_id(((global_pos + viewspec[0].offset) / _blocksize)
-                          % _nunits);
+    team_unit_t unit_id(
+                  _nunits_div.mod(
+                    _blocksize_div.div(global_pos + viewspec[0].offset)));
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.unit_at >", unit_id);
     return unit_id;
   }
@@ -466,7 +480,7 @@ public:
     IndexType global_pos
   ) const {
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.unit_at()", global_pos);
-    team_unit_t unit_id((global_pos / _blocksize) % _nunits);
+    team_unit_t unit_id(_nunits_div.mod(_blocksize_div.div(global_pos)));
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.unit_at >", unit_id);
     return unit_id;
   }
@@ -562,8 +576,6 @@ public:
    * Converts global coordinates to their associated unit and its respective
    * local coordinates.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
   local_coords_t local(
@@ -577,17 +589,15 @@ public:
   /**
    * Converts global index to its associated unit and respective local index.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
   local_index_t local(
     IndexType g_index) const {
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.local()", g_index);
-    index_type  g_block_index = g_index / _blocksize;
-    index_type  l_phase       = g_index % _blocksize;
-    index_type  l_block_index = g_block_index / _nunits;
-    team_unit_t unit(g_block_index % _nunits);
+    index_type  g_block_index = _blocksize_div.div(g_index);
+    index_type  l_phase       = g_index - (g_block_index * _blocksize);
+    index_type  l_block_index = _nunits_div.div(g_block_index);
+    team_unit_t unit(_nunits_div.mod(g_block_index));
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.local >", unit);
     index_type  l_index       = (l_block_index * _blocksize) + l_phase;
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.local >", l_index);
@@ -604,9 +614,9 @@ public:
     const std::array<IndexType, NumDimensions> & global_coords) const {
     IndexType local_coord;
     auto g_index        = global_coords[0];
-    auto elem_phase     = g_index % _blocksize;
-    auto g_block_offset = g_index / _blocksize;
-    auto l_block_offset = g_block_offset / _nunits;
+    auto g_block_offset = _blocksize_div.div(g_index);
+    auto elem_phase     = g_index - (g_block_offset * _blocksize);
+    auto l_block_offset = _nunits_div.div(g_block_offset);
     local_coord         = (l_block_offset * _blocksize) + elem_phase;
     return std::array<IndexType, 1> { local_coord };
   }
@@ -620,10 +630,10 @@ public:
   local_index_t local_index(
     const std::array<IndexType, NumDimensions> & g_coords) const {
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.local_index()", g_coords);
-    index_type  g_block_index = g_coords[0] / _blocksize;
-    index_type  l_phase       = g_coords[0] % _blocksize;
-    index_type  l_block_index = g_block_index / _nunits;
-    team_unit_t unit(g_block_index % _nunits);
+    index_type  g_block_index = _blocksize_div.div(g_coords[0]);
+    index_type  l_phase       = g_coords[0] - (g_block_index * _blocksize);
+    index_type  l_block_index = _nunits_div.div(g_block_index);
+    team_unit_t unit(_nunits_div.mod(g_block_index));
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.local_index >", unit);
     // Global coords to local coords:
     index_type  l_index       = (l_block_index * _blocksize) + l_phase;
@@ -652,7 +662,7 @@ public:
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.global", _nblocks);
     const Distribution & dist = _distspec[0];
     IndexType local_index     = local_coords[0];
-    IndexType elem_phase      = local_index % _blocksize;
+    IndexType elem_phase      = _blocksize_div.mod(local_index);
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.global", local_index);
     DASH_LOG_TRACE_VAR("ShiftTilePattern<1>.global", elem_phase);
     // Global coords of the element's block within all blocks:
@@ -839,7 +849,7 @@ public:
     /// Global coordinates of element
     const std::array<index_type, 1> & g_coords) const
   {
-    index_type block_idx = g_coords[0] / _blocksize;
+    index_type block_idx = _blocksize_div.div(g_coords[0]);
     DASH_LOG_TRACE("ShiftTilePattern<1>.block_at",
                    "coords", g_coords,
                    "> block index", block_idx);
@@ -1085,6 +1095,8 @@ private:
         _size,
         _distspec,
         _nunits)),
+    _nunits_div(_nunits),
+    _blocksize_div(_blocksize),
     _nblocks(initialize_num_blocks(
         _size,
         _blocksize,
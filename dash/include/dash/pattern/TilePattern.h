@@ -131,6 +131,10 @@ private:
   SizeType                    _nunits          = dash::Team::All().size();
   /// Maximum extents of a block in this pattern
   BlockSizeSpec_t             _blocksize_spec;
+  /// Precomputed divisors by the number of units in every dimension
+  std::array<dash::math::Divisor<SizeType>, NumDimensions> _teamspec_div;
+  /// Precomputed divisors by the maximum block extent in every dimension
+  std::array<dash::math::Divisor<SizeType>, NumDimensions> _blocksize_div;
   /// Arrangement of blocks in all dimensions
   BlockSpec_t                 _blockspec;
   /// Arrangement of local blocks in all dimensions
@@ -253,6 +257,8 @@ public:
         sizespec,
         _distspec,
         _teamspec)),
+    _teamspec_div(initialize_divisors(_teamspec.extents())),
+    _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
     _blockspec(initialize_blockspec(
         sizespec,
         _blocksize_spec,
@@ -322,6 +328,8 @@ public:
         sizespec,
         _distspec,
         _teamspec)),
+    _teamspec_div(initialize_divisors(_teamspec.extents())),
+    _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
     _blockspec(initialize_blockspec(
         sizespec,
         _blocksize_spec,
@@ -432,8 +440,8 @@ public:
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord      = coords[d] + viewspec.offset(d);
       // Global block coordinate:
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
-      unit_ts_coords[d] = block_coords[d] % _teamspec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      unit_ts_coords[d] = _teamspec_div[d].mod(block_coords[d]);
     }
     team_unit_t unit_id(_teamspec.at(unit_ts_coords));
     DASH_LOG_TRACE_VAR("TilePattern.unit_at", block_coords);
@@ -458,8 +466,8 @@ public:
     // e.g (x + y + z) % nunits
     for (auto d = 0; d < NumDimensions; ++d) {
       // Global block coordinate:
-      block_coords[d]   = coords[d] / _blocksize_spec.extent(d);
-      unit_ts_coords[d] = block_coords[d] % _teamspec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(coords[d]);
+      unit_ts_coords[d] = _teamspec_div[d].mod(block_coords[d]);
     }
     team_unit_t unit_id(_teamspec.at(unit_ts_coords));
     DASH_LOG_TRACE_VAR("TilePattern.unit_at", block_coords);
@@ -591,8 +599,8 @@ public:
       auto vs_offset_d  = viewspec.offset(d);
       auto vs_coord_d   = local_coords[d] + vs_offset_d;
       auto block_size_d = _blocksize_spec.extent(d);
-      phase_coords[d]   = vs_coord_d % block_size_d;
-      block_coords_l[d] = vs_coord_d / block_size_d;
+      block_coords_l[d] = _blocksize_div[d].div(vs_coord_d);
+      phase_coords[d]   = vs_coord_d - (block_coords_l[d] * block_size_d);
     }
     DASH_LOG_TRACE("TilePattern.local_at",
                    "local_coords:",       local_coords);
@@ -634,8 +642,8 @@ public:
     for (auto d = 0; d < NumDimensions; ++d) {
       auto gcoord_d     = local_coords[d];
       auto block_size_d = _blocksize_spec.extent(d);
-      phase_coords[d]   = gcoord_d % block_size_d;
-      block_coords_l[d] = gcoord_d / block_size_d;
+      block_coords_l[d] = _blocksize_div[d].div(gcoord_d);
+      phase_coords[d]   = gcoord_d - (block_coords_l[d] * block_size_d);
     }
     DASH_LOG_TRACE("TilePattern.local_at",
                    "local_coords:",       local_coords,
@@ -665,12 +673,11 @@ public:
     std::array<IndexType, NumDimensions> local_coords;
     std::array<IndexType, NumDimensions> unit_ts_coords;
     for (dim_t d = 0; d < NumDimensions; ++d) {
-      auto nunits_d        = _teamspec.extent(d);
       auto blocksize_d     = _blocksize_spec.extent(d);
-      auto block_coord_d   = global_coords[d] / blocksize_d;
-      auto phase_d         = global_coords[d] % blocksize_d;
-      auto l_block_coord_d = block_coord_d / nunits_d;
-      unit_ts_coords[d]    = block_coord_d % nunits_d;
+      auto block_coord_d   = _blocksize_div[d].div(global_coords[d]);
+      auto phase_d         = global_coords[d] - (block_coord_d * blocksize_d);
+      auto l_block_coord_d = _teamspec_div[d].div(block_coord_d);
+      unit_ts_coords[d]    = _teamspec_div[d].mod(block_coord_d);
       local_coords[d]      = (l_block_coord_d * blocksize_d) + phase_d;
     }
     l_coords.unit   = _teamspec.at(unit_ts_coords);
@@ -682,15 +689,11 @@ public:
    * Converts global index to its associated unit and respective local
    * index.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
-  constexpr local_index_t local(
+  local_index_t local(
     IndexType g_index) const
   {
-    // TODO: Implement dedicated method for this, conversion to/from
-    //       global coordinates is expensive.
     return local_index(coords(g_index));
   }
 
@@ -705,11 +708,10 @@ public:
   {
     std::array<IndexType, NumDimensions> local_coords;
     for (dim_t d = 0; d < NumDimensions; ++d) {
-      auto nunits_d        = _teamspec.extent(d);
       auto blocksize_d     = _blocksize_spec.extent(d);
-      auto block_coord_d   = global_coords[d] / blocksize_d;
-      auto phase_d         = global_coords[d] % blocksize_d;
-      auto l_block_coord_d = block_coord_d / nunits_d;
+      auto block_coord_d   = _blocksize_div[d].div(global_coords[d]);
+      auto phase_d         = global_coords[d] - (block_coord_d * blocksize_d);
+      auto l_block_coord_d = _teamspec_div[d].div(block_coord_d);
       local_coords[d]      = (l_block_coord_d * blocksize_d) + phase_d;
     }
     return local_coords;
@@ -724,45 +726,38 @@ public:
     const std::array<IndexType, NumDimensions> & global_coords) const
   {
     DASH_LOG_TRACE_VAR("TilePattern.local_index()", global_coords);
-    // Global coordinates to unit and local offset:
-    auto       l_pos_coords  = local(global_coords);
-    auto       l_coords      = l_pos_coords.coords;
-    auto       unit          = l_pos_coords.unit;
-    index_type l_index       = -1;
-    DASH_LOG_TRACE_VAR("TilePattern.local_index", l_coords);
+    // Resolve unit, local block and phase coordinates in a single pass
+    // instead of a round trip over local coordinates:
+    std::array<IndexType, NumDimensions> unit_ts_coords;
+    // Phase coordinates of element:
+    std::array<IndexType, NumDimensions> phase_coords;
+    // Coordinates of the local block containing the element:
+    std::array<IndexType, NumDimensions> block_coords_l;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      auto block_size_d  = _blocksize_spec.extent(d);
+      auto block_coord_d = _blocksize_div[d].div(global_coords[d]);
+      unit_ts_coords[d]  = _teamspec_div[d].mod(block_coord_d);
+      block_coords_l[d]  = _teamspec_div[d].div(block_coord_d);
+      phase_coords[d]    = global_coords[d] - (block_coord_d * block_size_d);
+    }
+    team_unit_t unit(_teamspec.at(unit_ts_coords));
     DASH_LOG_TRACE_VAR("TilePattern.local_index", unit);
-
+    // Number of blocks preceeding the coordinates' block:
+    index_type block_offset_l;
     if (unit == _myid) {
-      // Local coords to local offset:
-      l_index = local_at(l_coords);
+      block_offset_l = _local_blockspec.at(block_coords_l);
     } else {
       // Global coordinates point to remote location, requires to construct
       // _local_blockspec of remote unit:
-      auto remote_l_blockspec = initialize_local_blockspec(
-                                  _blockspec, _blocksize_spec, _teamspec,
-                                  unit);
-
-      // Phase coordinates of element:
-      std::array<IndexType, NumDimensions> phase_coords;
-      // Coordinates of the local block containing the element:
-      std::array<IndexType, NumDimensions> block_coords_l;
-      for (auto d = 0; d < NumDimensions; ++d) {
-        auto gcoord_d     = l_coords[d];
-        auto block_size_d = _blocksize_spec.extent(d);
-        phase_coords[d]   = gcoord_d % block_size_d;
-        block_coords_l[d] = gcoord_d / block_size_d;
-      }
-      DASH_LOG_TRACE("TilePattern.local_index",
-                     "local_coords:",       l_coords,
-                     "local blocks:",       remote_l_blockspec.extents(),
-                     "local block coords:", block_coords_l,
-                     "block size:",         _blocksize_spec.extents(),
-                     "phase coords:",       phase_coords);
-      // Number of blocks preceeding the coordinates' block:
-      auto block_offset_l = remote_l_blockspec.at(block_coords_l);
-      l_index = block_offset_l * _blocksize_spec.size() + // prec. blocks
-                _blocksize_spec.at(phase_coords);         // elem. phase
+      block_offset_l = initialize_local_blockspec(
+                         _blockspec, _blocksize_spec, _teamspec,
+                         unit_ts_coords).at(block_coords_l);
     }
+    DASH_LOG_TRACE("TilePattern.local_index",
+                   "local block coords:", block_coords_l,
+                   "phase coords:",       phase_coords);
+    index_type l_index = block_offset_l * _blocksize_spec.size() + // prec.
+                         _blocksize_spec.at(phase_coords);         // phase
     DASH_LOG_TRACE_VAR("TilePattern.local_index >", l_index);
 
     return local_index_t { unit, l_index };
@@ -791,8 +786,9 @@ public:
     for (dim_t d = 0; d < NumDimensions; ++d) {
       auto blocksize_d     = _blocksize_spec.extent(d);
       auto nunits_d        = _teamspec.extent(d);
-      auto phase           = local_coords[d] % blocksize_d;
-      auto l_block_coord_d = local_coords[d] / blocksize_d;
+      auto l_block_coord_d = _blocksize_div[d].div(local_coords[d]);
+      auto phase           = local_coords[d]
+                             - (l_block_coord_d * blocksize_d);
       auto g_block_coord_d = (l_block_coord_d * nunits_d) +
                              unit_ts_coords[d];
       global_coords[d]     = (g_block_coord_d * blocksize_d) + phase;
@@ -898,8 +894,9 @@ public:
     std::array<IndexType, NumDimensions> block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord     = global_coords[d] + viewspec.offset(d);
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      phase_coords[d]   = vs_coord
+                          - (block_coords[d] * _blocksize_spec.extent(d));
     }
     DASH_LOG_TRACE("TilePattern.global_at",
                    "block coords:", block_coords,
@@ -939,8 +936,9 @@ public:
     std::array<IndexType, NumDimensions> block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord     = global_coords[d];
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      phase_coords[d]   = vs_coord
+                          - (block_coords[d] * _blocksize_spec.extent(d));
     }
     DASH_LOG_TRACE("TilePattern.global_at",
                    "block coords:", block_coords,
@@ -981,11 +979,11 @@ public:
     // Local coordinates of the block containing the element:
     std::array<IndexType, NumDimensions> l_block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
-      auto nunits_d     = _teamspec.extent(d);
       auto vs_coord     = global_coords[d] + viewspec.offset(d);
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
-      l_block_coords[d] = block_coords[d] / nunits_d;
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      phase_coords[d]   = vs_coord
+                          - (block_coords[d] * _blocksize_spec.extent(d));
+      l_block_coords[d] = _teamspec_div[d].div(block_coords[d]);
     }
     index_type l_block_index = _local_blockspec.at(l_block_coords);
     DASH_LOG_TRACE("TilePattern.at",
@@ -1018,11 +1016,11 @@ public:
     // Local coordinates of the block containing the element:
     std::array<IndexType, NumDimensions> l_block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
-      auto nunits_d     = _teamspec.extent(d);
       auto gcoord_d     = global_coords[d];
-      phase_coords[d]   = gcoord_d % _blocksize_spec.extent(d);
-      block_coords[d]   = gcoord_d / _blocksize_spec.extent(d);
-      l_block_coords[d] = block_coords[d] / nunits_d;
+      block_coords[d]   = _blocksize_div[d].div(gcoord_d);
+      phase_coords[d]   = gcoord_d
+                          - (block_coords[d] * _blocksize_spec.extent(d));
+      l_block_coords[d] = _teamspec_div[d].div(block_coords[d]);
     }
     index_type l_block_index = _local_blockspec.at(l_block_coords);
     DASH_LOG_TRACE("TilePattern.at",
@@ -1082,10 +1080,10 @@ public:
     // Apply viewspec offset in dimension to given position
     dim_offset += viewspec[dim].offset;
     // Offset to block offset
-    IndexType block_coord_d    = dim_offset / _blocksize_spec.extent(dim);
+    IndexType block_coord_d    = _blocksize_div[dim].div(dim_offset);
     DASH_LOG_TRACE_VAR("TilePattern.has_local_elements", block_coord_d);
     // Coordinate of unit in team spec in given dimension
-    IndexType teamspec_coord_d = block_coord_d % _teamspec.extent(dim);
+    IndexType teamspec_coord_d = _teamspec_div[dim].mod(block_coord_d);
     DASH_LOG_TRACE_VAR("TilePattern.has_local_elements",
                        teamspec_coord_d);
     // Check if unit id lies in cartesian sub-space of team spec
@@ -1138,7 +1136,7 @@ public:
     std::array<index_type, NumDimensions> block_coords;
     // Coord to block coord to unit coord:
     for (auto d = 0; d < NumDimensions; ++d) {
-      block_coords[d] = g_coords[d] / _blocksize_spec.extent(d);
+      block_coords[d] = _blocksize_div[d].div(g_coords[d]);
     }
     // Block coord to block index:
     auto block_idx = _blockspec.at(block_coords);
@@ -1162,11 +1160,9 @@ public:
     std::array<IndexType, NumDimensions> l_block_coords;
     std::array<IndexType, NumDimensions> unit_ts_coords;
     for (dim_t d = 0; d < NumDimensions; ++d) {
-      auto nunits_d      = _teamspec.extent(d);
-      auto blocksize_d   = _blocksize_spec.extent(d);
-      auto block_coord_d = g_coords[d] / blocksize_d;
-      l_block_coords[d]  = block_coord_d / nunits_d;
-      unit_ts_coords[d]  = block_coord_d % nunits_d;
+      auto block_coord_d = _blocksize_div[d].div(g_coords[d]);
+      l_block_coords[d]  = _teamspec_div[d].div(block_coord_d);
+      unit_ts_coords[d]  = _teamspec_div[d].mod(block_coord_d);
     }
     l_pos.unit  = _teamspec.at(unit_ts_coords);
     l_pos.index = _local_blockspec.at(l_block_coords);
@@ -1505,6 +1501,8 @@ private:
         arguments.sizespec(),
         _distspec,
         _teamspec)),
+    _teamspec_div(initialize_divisors(_teamspec.extents())),
+    _blocksize_div(initialize_divisors(_blocksize_spec.extents())),
     _blockspec(initialize_blockspec(
         arguments.sizespec(),
         _blocksize_spec,
@@ -1519,6 +1517,20 @@ private:
         initialize_local_capacity(_local_memory_layout))
   {}
 
+  /**
+   * Precompute divisors by the given extents in every dimension.
+   */
+  template<typename Extents>
+  static std::array<dash::math::Divisor<SizeType>, NumDimensions>
+  initialize_divisors(const Extents & extents)
+  {
+    std::array<dash::math::Divisor<SizeType>, NumDimensions> divisors;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      divisors[d] = dash::math::Divisor<SizeType>(extents[d]);
+    }
+    return divisors;
+  }
+
   /**
    * Initialize block size specs from memory layout, team spec and
    * distribution spec.
@@ -1617,11 +1629,24 @@ private:
                          empty_blockspec.extents());
       return empty_blockspec;
     }
-    // Number of local blocks in all dimensions:
-    auto l_blocks = blockspec.extents();
     // Coordinates of local unit id in team spec:
-    auto unit_ts_coords = _teamspec.coords(unit_id);
+    return initialize_local_blockspec(
+             blockspec, blocksizespec, teamspec, _teamspec.coords(unit_id));
+  }
+
+  /**
+   * Initialize local block spec of the unit at the given coordinates in
+   * the team spec.
+   */
+  BlockSpec_t initialize_local_blockspec(
+    const BlockSpec_t                          & blockspec,
+    const BlockSizeSpec_t                      & blocksizespec,
+    const TeamSpec_t                           & teamspec,
+    const std::array<IndexType, NumDimensions> & unit_ts_coords) const
+  {
     DASH_LOG_TRACE_VAR("TilePattern.init_local_blockspec", unit_ts_coords);
+    // Number of local blocks in all dimensions:
+    auto l_blocks = blockspec.extents();
     for (auto d = 0; d < NumDimensions; ++d) {
       // Number of units in dimension:
       auto num_units_d        = _teamspec.extent(d);
@@ -119,6 +119,10 @@ private:
   SizeType                    _nunits          = 0;
   /// Maximum extents of a block in this pattern
   SizeType                    _blocksize       = 0;
+  /// Precomputed divisor by the number of units
+  dash::math::Divisor<SizeType> _nunits_div;
+  /// Precomputed divisor by the maximum block extent
+  dash::math::Divisor<SizeType> _blocksize_div;
   /// Number of blocks in all dimensions
   SizeType                    _nblocks         = 0;
   /// Actual number of local elements.
@@ -218,6 +222,8 @@ public:
         _size,
         _distspec,
         _nunits)),
+    _nunits_div(_nunits),
+    _blocksize_div(_blocksize),
     _nblocks(initialize_num_blocks(
         _size,
         _blocksize,
@@ -277,6 +283,8 @@ public:
         _size,
         _distspec,
         _nunits)),
+    _nunits_div(_nunits),
+    _blocksize_div(_blocksize),
     _nblocks(initialize_num_blocks(
         _size,
         _blocksize,
@@ -379,8 +387,9 @@ public:
     const ViewSpec_t & viewspec) const {
     DASH_LOG_TRACE_VAR("TilePattern<1>.unit_at()", coords);
     // Apply viewspec offsets to coordinates:
-    team_unit_t unit_id(((coords[0] + viewspec[0].offset) / _blocksize)
-                          % _nunits);
+    team_unit_t unit_id(
+                  _nunits_div.mod(
+                    _blocksize_div.div(coords[0] + viewspec[0].offset)));
     DASH_LOG_TRACE_VAR("TilePattern<1>.unit_at >", unit_id);
     return unit_id;
   }
@@ -393,7 +402,7 @@ public:
   team_unit_t unit_at(
     const std::array<IndexType, NumDimensions> & coords) const {
     DASH_LOG_TRACE_VAR("TilePattern<1>.unit_at()", coords);
-    team_unit_t unit_id((coords[0] / _blocksize) % _nunits);
+    team_unit_t unit_id(_nunits_div.mod(_blocksize_div.div(coords[0])));
     DASH_LOG_TRACE_VAR("TilePattern<1>.unit_at >", unit_id);
     return unit_id;
   }
@@ -411,8 +420,9 @@ public:
   ) const {
     DASH_LOG_TRACE_VAR("TilePattern<1>.unit_at()", global_pos);
     // Apply viewspec offsets to coordinates:
-    team_unit_t unit_id(((global_pos + viewspec[0].offset) / _blocksize)
-                          % _nunits);
+    team_unit_t unit_id(
+                  _nunits_div.mod(
+                    _blocksize_div.div(global_pos + viewspec[0].offset)));
     DASH_LOG_TRACE_VAR("TilePattern<1>.unit_at >", unit_id);
     return unit_id;
   }
@@ -426,7 +436,7 @@ public:
     /// Global linear element offset
     IndexType global_pos
   ) const {
-    return team_unit_t((global_pos / _blocksize) % _nunits);
+    return team_unit_t(_nunits_div.mod(_blocksize_div.div(global_pos)));
   }
 
   ////////////////////////////////////////////////////////////////////////////
@@ -510,8 +520,6 @@ public:
    * Converts global coordinates to their associated unit and its respective
    * local coordinates.
    *
-   * \todo Unoptimized
-   *
    * \see  DashPatternConcept
    */
   constexpr local_coords_t local(
@@ -525,17 +533,15 @@ public:
   /**
    * Converts global index to its associated unit and respective local index.
    *
-   * \todo Unoptimized
-   *
    * \see  DashPatternConcept
    */
   local_index_t local(
     IndexType g_index) const {
     DASH_LOG_TRACE_VAR("TilePattern<1>.local()", g_index);
-    index_type  g_block_index = g_index / _blocksize;
-    index_type  l_phase       = g_index % _blocksize;
-    index_type  l_block_index = g_block_index / _nunits;
-    team_unit_t unit(g_block_index % _nunits);
+    index_type  g_block_index = _blocksize_div.div(g_index);
+    index_type  l_phase       = g_index - (g_block_index * _blocksize);
+    index_type  l_block_index = _nunits_div.div(g_block_index);
+    team_unit_t unit(_nunits_div.mod(g_block_index));
     DASH_LOG_TRACE_VAR("TilePattern<1>.local >", unit);
     index_type  l_index       = (l_block_index * _blocksize) + l_phase;
     DASH_LOG_TRACE_VAR("TilePattern<1>.local >", l_index);
@@ -552,9 +558,9 @@ public:
     const std::array<IndexType, NumDimensions> & global_coords) const {
     IndexType local_coord;
     auto g_index        = global_coords[0];
-    auto elem_phase     = g_index % _blocksize;
-    auto g_block_offset = g_index / _blocksize;
-    auto l_block_offset = g_block_offset / _nunits;
+    auto g_block_offset = _blocksize_div.div(g_index);
+    auto elem_phase     = g_index - (g_block_offset * _blocksize);
+    auto l_block_offset = _nunits_div.div(g_block_offset);
     local_coord         = (l_block_offset * _blocksize) + elem_phase;
     return std::array<IndexType, 1> {{ local_coord }};
   }
@@ -568,10 +574,10 @@ public:
   local_index_t local_index(
     const std::array<IndexType, NumDimensions> & g_coords) const {
     DASH_LOG_TRACE_VAR("TilePattern<1>.local_index()", g_coords);
-    index_type  g_block_index = g_coords[0] / _blocksize;
-    index_type  l_phase       = g_coords[0] % _blocksize;
-    index_type  l_block_index = g_block_index / _nunits;
-    team_unit_t unit(g_block_index % _nunits);
+    index_type  g_block_index = _blocksize_div.div(g_coords[0]);
+    index_type  l_phase       = g_coords[0] - (g_block_index * _blocksize);
+    index_type  l_block_index = _nunits_div.div(g_block_index);
+    team_unit_t unit(_nunits_div.mod(g_block_index));
     DASH_LOG_TRACE_VAR("TilePattern<1>.local_index >", unit);
     // Global coords to local coords:
     index_type  l_index       = (l_block_index * _blocksize) + l_phase;
@@ -600,7 +606,7 @@ public:
     DASH_LOG_TRACE_VAR("TilePattern<1>.global", _nblocks);
     const Distribution & dist = _distspec[0];
     IndexType local_index     = local_coords[0];
-    IndexType elem_phase      = local_index % _blocksize;
+    IndexType elem_phase      = _blocksize_div.mod(local_index);
     DASH_LOG_TRACE_VAR("TilePattern<1>.global", local_index);
     DASH_LOG_TRACE_VAR("TilePattern<1>.global", elem_phase);
     // Global coords of the element's block within all blocks:
@@ -790,7 +796,7 @@ public:
     /// Global coordinates of element
     const std::array<index_type, 1> & g_coords) const
   {
-    return g_coords[0] / _blocksize;
+    return _blocksize_div.div(g_coords[0]);
   }
 
   /**
@@ -804,10 +810,10 @@ public:
     return local_index_t {
              // unit id:
              static_cast<team_unit_t>(
-                (g_coords[0] / _blocksize) % _teamspec.size()),
+                _nunits_div.mod(_blocksize_div.div(g_coords[0]))),
              // local block index:
              static_cast<index_type>(
-                (g_coords[0] / _blocksize) / _teamspec.size())
+                _nunits_div.div(_blocksize_div.div(g_coords[0])))
            };
   }
 
@@ -1033,6 +1039,8 @@ private:
         _size,
         _distspec,
         _nunits)),
+    _nunits_div(_nunits),
+    _blocksize_div(_blocksize),
     _nblocks(initialize_num_blocks(
         _size,
         _blocksize,
@@ -35,6 +35,8 @@ namespace dash {
 #include <dash/GlobAsyncRef.h>
 
 #include <dash/Onesided.h>
+#include <dash/WriteCombiner.h>
+#include <dash/ReadCache.h>
 
 #include <dash/LaunchPolicy.h>
 
@@ -45,6 +47,8 @@ namespace dash {
 #include <dash/Algorithm.h>
 #include <dash/Atomic.h>
 #include <dash/Mutex.h>
+#include <dash/SharedMutex.h>
+#include <dash/SyncEpoch.h>
 
 #include <dash/Pattern.h>
 
@@ -8,6 +8,11 @@ Mutex::Mutex(Team & team){
   DASH_ASSERT_EQ(DART_OK, ret, "dart_team_lock_init failed");
 }
 
+Mutex::Mutex(Team & team, hierarchical_lock_t){
+  dart_ret_t ret = dart_team_lock_init_hierarchical(team.dart_id(), &_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_team_lock_init_hierarchical failed");
+}
+
 Mutex::~Mutex(){
   dart_ret_t ret = dart_team_lock_destroy(&_mutex);
   DASH_ASSERT_EQ(DART_OK, ret, "dart_team_lock_free failed");
@@ -0,0 +1,36 @@
+#include <dash/SharedMutex.h>
+#include <dash/Exception.h>
+
+namespace dash {
+
+SharedMutex::SharedMutex(Team & team){
+  dart_ret_t ret = dart_team_rwlock_init(team.dart_id(), &_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_team_rwlock_init failed");
+}
+
+SharedMutex::~SharedMutex(){
+  dart_ret_t ret = dart_team_rwlock_destroy(&_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_team_rwlock_destroy failed");
+}
+
+void SharedMutex::lock(){
+  dart_ret_t ret = dart_rwlock_acquire_write(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_acquire_write failed");
+}
+
+void SharedMutex::unlock(){
+  dart_ret_t ret = dart_rwlock_release_write(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_release_write failed");
+}
+
+void SharedMutex::lock_shared(){
+  dart_ret_t ret = dart_rwlock_acquire_read(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_acquire_read failed");
+}
+
+void SharedMutex::unlock_shared(){
+  dart_ret_t ret = dart_rwlock_release_read(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_release_read failed");
+}
+
+} // namespace dash
@@ -26,9 +26,74 @@ TEST_F(AccumulateTest, SimpleConstructor) {
 				target.end(),
 				0); //start value			      
 
-  if(dash::myid() == 0) {
-    ASSERT_EQ_U(num_elem_total * value, result);
+  ASSERT_EQ_U(num_elem_total * value, result);
+}
+
+TEST_F(AccumulateTest, InitValueAndValueType) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+
+  dash::fill(target.begin(), target.end(), 3);
+
+  dash::barrier();
+
+  // Result type differs from element type, init is applied once:
+  double result = dash::accumulate(target.begin(),
+                                   target.end(),
+                                   0.5);
+
+  ASSERT_EQ_U(num_elem_total * 3 + 0.5, result);
+}
+
+TEST_F(AccumulateTest, ReduceOperations) {
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<long> target(num_elem_total, dash::BLOCKED);
+
+  for (size_t l = 0; l < num_elem_local; ++l) {
+    target.local[l] = target.pattern().global(l) + 1;
+  }
+
+  dash::barrier();
+
+  long max = dash::accumulate(target.begin(), target.end(),
+                              0l, dash::max<long>());
+  long min = dash::accumulate(target.begin(), target.end(),
+                              100000l, dash::min<long>());
+
+  ASSERT_EQ_U(num_elem_total, max);
+  ASSERT_EQ_U(1, min);
+
+  // Sub-range not covering the local range of all units:
+  long sum = dash::accumulate(target.begin() + 1, target.begin() + 4, 0l);
+  ASSERT_EQ_U(2 + 3 + 4, sum);
+}
+
+TEST_F(AccumulateTest, UserDefinedOperation) {
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+
+  for (size_t l = 0; l < num_elem_local; ++l) {
+    target.local[l] = target.pattern().global(l);
+  }
+
+  dash::barrier();
+
+  // Operation not known to DART, reduced via allgather:
+  auto sum_op = [](int a, int b) { return a + b; };
+  int result  = dash::accumulate(target.begin() + 1, target.end(),
+                                 5, sum_op);
+
+  int expected = 5;
+  for (size_t i = 1; i < num_elem_total; ++i) {
+    expected += i;
   }
+  ASSERT_EQ_U(expected, result);
 }
 
 TEST_F(AccumulateTest, StringConcatOperaton) {
@@ -8,6 +8,7 @@
 #include <dash/pattern/ShiftTilePattern1D.h>
 #include <dash/pattern/TilePattern1D.h>
 #include <dash/pattern/BlockPattern1D.h>
+#include <dash/pattern/BlockPattern.h>
 
 #include "../TestBase.h"
 #include "../TestLogHelpers.h"
@@ -319,6 +320,38 @@ TEST_F(CopyTest, BlockingGlobalToLocalMasterOnlyAllRemote)
   delete[] local_copy;
 }
 
+TEST_F(CopyTest, BlockingGlobalToLocalPipelined)
+{
+  // Copy the complete array with small chunks and a low limit of bytes
+  // in flight so large transfers are split and requests are completed
+  // while further gets are posted.
+  const int num_elem_per_unit = 1000;
+  size_t    num_elem_total    = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (auto l = 0; l < num_elem_per_unit; ++l) {
+    array.local[l] = ((dash::myid().id + 1) * 10000) + l;
+  }
+  array.barrier();
+
+  dash::util::Config::set("DASH_COPY_CHUNK_SIZE",         "256");
+  dash::util::Config::set("DASH_COPY_MAX_INFLIGHT_SIZE",  "1K");
+
+  std::vector<int> local_copy(num_elem_total);
+  int * dest_end = dash::copy(array.begin(), array.end(),
+                              local_copy.data());
+  EXPECT_EQ_U(local_copy.data() + num_elem_total, dest_end);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    int expected = ((g / num_elem_per_unit) + 1) * 10000
+                   + (g % num_elem_per_unit);
+    EXPECT_EQ_U(expected, local_copy[g]);
+  }
+
+  dash::util::Config::set("DASH_COPY_CHUNK_SIZE",         "0");
+  dash::util::Config::set("DASH_COPY_MAX_INFLIGHT_SIZE",  "0");
+  array.barrier();
+}
+
 TEST_F(CopyTest, BlockingGlobalToLocalBarrierUnaligned)
 {
   dash::global_unit_t myid = dash::myid();
@@ -729,7 +762,7 @@ TEST_F(CopyTest, AsyncGlobalToLocalTiles)
     auto req = dash::copy_async(gblock_a.begin(),
                                 gblock_a.end(),
                                 matrix_b_dest);
-    req_handles.push_back(req);
+    req_handles.push_back(std::move(req));
     dst_pointers.push_back(matrix_b_dest);
   }
 
@@ -743,7 +776,7 @@ TEST_F(CopyTest, AsyncGlobalToLocalTiles)
   // To prevent compiler from removing work load loop in optimization:
   LOG_MESSAGE("Dummy result: %f", m);
 
-  for (auto req : req_handles) {
+  for (auto & req : req_handles) {
     // Wait for completion of async copy operation.
     // Returns pointer to final element copied into target range:
     value_t * copy_dest_end   = req.get();
@@ -803,6 +836,220 @@ TEST_F(CopyTest, AsyncGlobalToLocalBlock)
   }
 }
 
+TEST_F(CopyTest, AsyncTestAndCompose)
+{
+  const int num_elem_per_unit = 1000;
+  size_t num_elem_total       = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (auto l = 0; l < num_elem_per_unit; ++l) {
+    array.local[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  array.barrier();
+
+  // Copy block of succeeding unit and poll for completion:
+  auto next_unit = (dash::myid() + 1) % _dash_size;
+  std::vector<int> block_next(num_elem_per_unit);
+  auto fut_next  = dash::copy_async(
+                     array.begin() + next_unit * num_elem_per_unit,
+                     array.begin() + (next_unit + 1) * num_elem_per_unit,
+                     block_next.data());
+  while (!fut_next.test()) { }
+  EXPECT_EQ_U(block_next.data() + num_elem_per_unit, fut_next.get());
+
+  // Continuation applied to the result of the copy operation:
+  std::vector<int> block_first(num_elem_per_unit);
+  auto fut_ncopied = dash::copy_async(
+                       array.begin(),
+                       array.begin() + num_elem_per_unit,
+                       block_first.data())
+                     .then([&](int * out_last) {
+                             return std::distance(block_first.data(),
+                                                  out_last);
+                           });
+  EXPECT_TRUE_U(fut_ncopied.valid());
+  EXPECT_EQ_U(num_elem_per_unit, fut_ncopied.get());
+
+  // Copy all blocks and wait for any and all copy operations:
+  std::vector<int> local_copy(num_elem_total);
+  std::vector< dash::Future<int *> > futures;
+  for (size_t u = 0; u < _dash_size; ++u) {
+    futures.push_back(
+      dash::copy_async(array.begin() + u * num_elem_per_unit,
+                       array.begin() + (u + 1) * num_elem_per_unit,
+                       local_copy.data() + u * num_elem_per_unit));
+  }
+  auto fut_any = dash::when_any(futures.begin(), futures.end());
+  auto it_any  = fut_any.get();
+  EXPECT_NE_U(futures.end(), it_any);
+  EXPECT_TRUE_U(it_any->test());
+
+  auto fut_all = dash::when_all(futures.begin(), futures.end());
+  EXPECT_EQ_U(futures.end(), fut_all.get());
+  for (size_t u = 0; u < _dash_size; ++u) {
+    EXPECT_TRUE_U(futures[u].test());
+    EXPECT_EQ_U(local_copy.data() + (u + 1) * num_elem_per_unit,
+                futures[u].get());
+  }
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    int unit = g / num_elem_per_unit;
+    int l    = g % num_elem_per_unit;
+    EXPECT_EQ_U(((unit + 1) * 1000) + l, local_copy[g]);
+  }
+  EXPECT_EQ_U(((next_unit + 1) * 1000), block_next[0]);
+  EXPECT_EQ_U(1000, block_first[0]);
+
+  array.barrier();
+}
+
+TEST_F(CopyTest, AsyncTestPollAndDiscard)
+{
+  const int num_elem_per_unit = 100;
+  const int num_iterations    = 200;
+  size_t num_elem_total       = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (auto l = 0; l < num_elem_per_unit; ++l) {
+    array.local[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  array.barrier();
+
+  // Repeatedly poll copies of the local block, served without MPI
+  // requests, and of the succeeding unit's block for completion:
+  auto next_unit = (dash::myid() + 1) % _dash_size;
+  std::vector<int> block_local(num_elem_per_unit);
+  std::vector<int> block_next(num_elem_per_unit);
+  for (int i = 0; i < num_iterations; ++i) {
+    auto fut_local = dash::copy_async(
+                       array.begin() + dash::myid() * num_elem_per_unit,
+                       array.begin() + (dash::myid() + 1) * num_elem_per_unit,
+                       block_local.data());
+    auto fut_next  = dash::copy_async(
+                       array.begin() + next_unit * num_elem_per_unit,
+                       array.begin() + (next_unit + 1) * num_elem_per_unit,
+                       block_next.data());
+    while (!fut_local.test()) { }
+    while (!fut_next.test()) { }
+    EXPECT_TRUE_U(fut_local.test());
+    EXPECT_EQ_U(block_local.data() + num_elem_per_unit, fut_local.get());
+    EXPECT_EQ_U(block_next.data() + num_elem_per_unit, fut_next.get());
+  }
+  EXPECT_EQ_U(((dash::myid() + 1) * 1000), block_local[0]);
+  EXPECT_EQ_U(((next_unit + 1) * 1000), block_next[0]);
+
+  // Futures that are destroyed or replaced before their result was
+  // requested complete their operations:
+  for (int i = 0; i < num_iterations; ++i) {
+    auto fut_next = dash::copy_async(
+                      array.begin() + next_unit * num_elem_per_unit,
+                      array.begin() + (next_unit + 1) * num_elem_per_unit,
+                      block_next.data());
+    fut_next = dash::copy_async(
+                 array.begin() + next_unit * num_elem_per_unit,
+                 array.begin() + (next_unit + 1) * num_elem_per_unit,
+                 block_next.data());
+  }
+  EXPECT_EQ_U(((next_unit + 1) * 1000) + num_elem_per_unit - 1,
+              block_next[num_elem_per_unit - 1]);
+
+  // Moved-from futures are invalid:
+  auto fut_moved = dash::copy_async(
+                     array.begin() + next_unit * num_elem_per_unit,
+                     array.begin() + (next_unit + 1) * num_elem_per_unit,
+                     block_next.data());
+  auto fut_moved_to(std::move(fut_moved));
+  EXPECT_FALSE_U(fut_moved.valid());
+  EXPECT_TRUE_U(fut_moved_to.valid());
+  fut_moved_to.wait();
+
+  array.barrier();
+}
+
+TEST_F(CopyTest, GlobalToGlobalRedistribute)
+{
+  // Copy between arrays with different distributions:
+  const int num_elem_per_unit = 23;
+  size_t num_elem_total       = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> src(num_elem_total, dash::BLOCKED);
+  dash::Array<int> dst(num_elem_total, dash::BLOCKCYCLIC(5));
+
+  for (auto l = 0; l < src.lsize(); ++l) {
+    src.local[l] = src.pattern().global(l);
+  }
+  for (auto l = 0; l < dst.lsize(); ++l) {
+    dst.local[l] = -1;
+  }
+  src.barrier();
+
+  // Copy complete range:
+  auto out_last = dash::copy(src.begin(), src.end(), dst.begin());
+  EXPECT_EQ_U(dst.end(), out_last);
+  dst.barrier();
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    EXPECT_EQ_U(static_cast<int>(g), static_cast<int>(dst[g]));
+  }
+  dst.barrier();
+
+  // Copy shifted subrange asynchronously:
+  size_t offset = 7;
+  size_t nelem  = num_elem_total - offset - 3;
+  auto fut = dash::copy_async(src.begin() + offset,
+                              src.begin() + offset + nelem,
+                              dst.begin());
+  EXPECT_EQ_U(dst.begin() + nelem, fut.get());
+  dst.barrier();
+  for (size_t g = 0; g < nelem; ++g) {
+    EXPECT_EQ_U(static_cast<int>(g + offset), static_cast<int>(dst[g]));
+  }
+  // Elements succeeding the output range are unchanged:
+  for (size_t g = nelem; g < num_elem_total; ++g) {
+    EXPECT_EQ_U(static_cast<int>(g), static_cast<int>(dst[g]));
+  }
+  dst.barrier();
+}
+
+TEST_F(CopyTest, GlobalToGlobalMatrixRedistribute)
+{
+  typedef dash::BlockPattern<2>                           pattern_t;
+  typedef pattern_t::index_type                           index_t;
+  typedef dash::Matrix<int, 2, index_t, pattern_t>        matrix_t;
+
+  // Copy between matrices distributed by rows and by cyclic columns:
+  size_t    ext_x = 3 * _dash_size + 1;
+  size_t    ext_y = 2 * _dash_size + 3;
+  pattern_t src_pattern(
+    dash::SizeSpec<2>(ext_x, ext_y),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE),
+    dash::TeamSpec<2>(_dash_size, 1));
+  pattern_t dst_pattern(
+    dash::SizeSpec<2>(ext_x, ext_y),
+    dash::DistributionSpec<2>(dash::NONE, dash::BLOCKCYCLIC(2)),
+    dash::TeamSpec<2>(1, _dash_size));
+  matrix_t src(src_pattern);
+  matrix_t dst(dst_pattern);
+
+  for (size_t l = 0; l < src.local.size(); ++l) {
+    src.lbegin()[l] = src_pattern.global(l);
+  }
+  std::fill(dst.lbegin(), dst.lend(), -1);
+  src.barrier();
+
+  index_t num_elem_total = ext_x * ext_y;
+  index_t offset         = ext_y + 1;
+  index_t nelem          = num_elem_total - offset - 2;
+  auto out_last = dash::copy(src.begin() + offset,
+                             src.begin() + offset + nelem,
+                             dst.begin());
+  EXPECT_EQ_U(dst.begin() + nelem, out_last);
+  dst.barrier();
+  for (index_t g = 0; g < num_elem_total; ++g) {
+    int expected = (g < nelem) ? static_cast<int>(g + offset) : -1;
+    EXPECT_EQ_U(expected, static_cast<int>(dst.begin()[g]));
+  }
+  dst.barrier();
+}
+
 #if 0
 // TODO
 TEST_F(CopyTest, AsyncAllToLocalVector)
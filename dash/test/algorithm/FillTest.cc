@@ -5,6 +5,7 @@
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Fill.h>
 
+#include <algorithm>
 #include <array>
 
 
@@ -42,3 +43,31 @@ TEST_F(FillTest, TestAllItemsFilled)
     EXPECT_EQ_U(17, static_cast<value_t>(*lbegin));
   }
 }
+
+TEST_F(FillTest, TestLargeLocalRange)
+{
+  // Local ranges large enough to be partitioned among threads
+  size_t num_local_elem = (1 << 17) + 3;
+  dash::Array<int> array(num_local_elem * dash::size());
+  dash::fill(array.begin(), array.end(), 23);
+  array.barrier();
+
+  EXPECT_EQ_U(num_local_elem, array.lend() - array.lbegin());
+  size_t num_mismatch = std::count_if(array.lbegin(), array.lend(),
+                                      [](int v) { return v != 23; });
+  EXPECT_EQ_U(0, num_mismatch);
+
+  // Fill sub-range with begin and end in different units:
+  auto first = array.begin() + num_local_elem / 2;
+  auto last  = array.end()   - num_local_elem / 2;
+  dash::fill(first, last, 42);
+  array.barrier();
+  if (dash::myid() == 0) {
+    for (size_t g = 0; g < array.size(); g += 101) {
+      int expected = (g >= num_local_elem / 2 &&
+                      g <  array.size() - num_local_elem / 2) ? 42 : 23;
+      EXPECT_EQ_U(expected, static_cast<int>(array[g]));
+    }
+  }
+  array.barrier();
+}
@@ -55,3 +55,43 @@ TEST_F(GenerateTest, TestGenerateWithIndex)
     }
   }
 }
+
+TEST_F(GenerateTest, TestGenerateWithIndexStateful)
+{
+  typedef typename Array_t::value_type value_t;
+
+  // Initialize global array:
+  Array_t array(_num_elem);
+  // Stateful generator, counts its invocations on the local unit
+  value_t count = 0;
+  auto f = [&count](Array_t::index_type){ return count++; };
+  // Local elements must be generated in the order of their indices
+  dash::generate_with_index(array.begin(), array.end(), f);
+
+  ASSERT_EQ_U(array.lsize(), static_cast<size_t>(count));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    ASSERT_EQ_U(static_cast<value_t>(l), array.local[l]);
+  }
+  array.barrier();
+}
+
+TEST_F(GenerateTest, TestGenerateWithIndexParallel)
+{
+  // Initialize global array:
+  Array_t array(_num_elem);
+  // Generator function
+  auto f = [](Array_t::index_type idx){ return 3*idx; };
+  // Fill Array with given generator function
+  dash::generate_with_index_parallel(array.begin(), array.end(), f);
+  // Wait for all units
+  array.barrier();
+
+  // check global index range
+  if (dash::myid() == 0) {
+    for (size_t idx = 0;
+         idx != array.size();
+         ++idx) {
+      ASSERT_EQ_U(idx * 3.0, array[idx]);
+    }
+  }
+}
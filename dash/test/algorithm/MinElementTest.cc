@@ -271,3 +271,30 @@ TEST_F(MinElementTest, TestFindMatrixDefault)
   EXPECT_EQ(min_value, found_min);
 }
 
+
+TEST_F(MinElementTest, TestFindArrayAsync)
+{
+  int num_elem        = 10 * dash::Team::All().size();
+  Element_t min_value = 3;
+  Array_t array(num_elem);
+  for (auto li = 0; li < array.local.size(); ++li) {
+    array.local[li] = 100 + dash::myid() * 10 + li;
+  }
+  array.barrier();
+  if (dash::myid() == 0) {
+    // Minimum at the first global position:
+    array[0] = min_value;
+  }
+  array.barrier();
+  auto fut_min = dash::min_element_async(array.begin(), array.end());
+  auto fut_max = dash::max_element_async(array.begin(), array.end());
+  // Both collectives are in flight, complete them out of order:
+  auto found_max = fut_max.get();
+  auto found_min = fut_min.get();
+  EXPECT_EQ_U(0, found_min.gpos());
+  EXPECT_EQ_U(min_value, static_cast<Element_t>(*found_min));
+  EXPECT_EQ_U(array.size() - 1, found_max.gpos());
+  // Empty range:
+  auto fut_empty = dash::min_element_async(array.begin(), array.begin());
+  EXPECT_EQ_U(array.begin(), fut_empty.get());
+}
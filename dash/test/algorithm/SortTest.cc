@@ -0,0 +1,153 @@
+
+#include "SortTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Sort.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+
+namespace {
+
+/**
+ * Copies all elements of the global array to a local vector at every
+ * unit.
+ */
+template <class ArrayT>
+std::vector<typename ArrayT::value_type> gather_all(ArrayT & array)
+{
+  std::vector<typename ArrayT::value_type> values;
+  values.reserve(array.size());
+  for (size_t i = 0; i < array.size(); ++i) {
+    values.push_back(array[i]);
+  }
+  return values;
+}
+
+/**
+ * Sum of all elements, used to validate that sorting is a permutation.
+ */
+template <class ArrayT>
+long long checksum(ArrayT & array)
+{
+  long long l_sum = 0;
+  for (auto it = array.lbegin(); it != array.lend(); ++it) {
+    l_sum += *it;
+  }
+  long long sum;
+  dart_allreduce(&l_sum, &sum, 1, DART_TYPE_LONGLONG, DART_OP_SUM,
+                 array.team().dart_id());
+  return sum;
+}
+
+} // namespace
+
+TEST_F(SortTest, BlockedRandom)
+{
+  typedef int                     value_t;
+  typedef dash::Array<value_t>    array_t;
+
+  size_t num_local_elem = 1000;
+  array_t array(num_local_elem * dash::size());
+
+  std::srand(dash::myid() + 31);
+  for (auto it = array.lbegin(); it != array.lend(); ++it) {
+    *it = std::rand() % 5000;
+  }
+  array.barrier();
+  auto sum_before = checksum(array);
+
+  dash::sort(array.begin(), array.end());
+
+  EXPECT_EQ_U(sum_before, checksum(array));
+  if (dash::myid() == 0) {
+    auto values = gather_all(array);
+    EXPECT_TRUE_U(std::is_sorted(values.begin(), values.end()));
+  }
+  array.barrier();
+}
+
+TEST_F(SortTest, BlockCyclicDescending)
+{
+  typedef long                    value_t;
+  typedef dash::Array<value_t>    array_t;
+
+  size_t num_local_elem = 517;
+  array_t array(num_local_elem * dash::size(), dash::BLOCKCYCLIC(7));
+
+  std::srand(dash::myid() + 97);
+  for (auto it = array.lbegin(); it != array.lend(); ++it) {
+    *it = std::rand() % 100000 - 50000;
+  }
+  array.barrier();
+  auto sum_before = checksum(array);
+
+  dash::sort(array.begin(), array.end(), std::greater<value_t>());
+
+  EXPECT_EQ_U(sum_before, checksum(array));
+  // Distribution of elements is unchanged:
+  EXPECT_EQ_U(array.pattern().local_size(), array.lsize());
+  if (dash::myid() == 0) {
+    auto values = gather_all(array);
+    EXPECT_TRUE_U(std::is_sorted(values.begin(), values.end(),
+                                 std::greater<value_t>()));
+  }
+  array.barrier();
+}
+
+TEST_F(SortTest, Duplicates)
+{
+  typedef int                     value_t;
+  typedef dash::Array<value_t>    array_t;
+
+  size_t num_local_elem = 200;
+  array_t array(num_local_elem * dash::size());
+
+  // Few distinct values to stress splitter tie-breaking:
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = (l + dash::myid()) % 3;
+  }
+  array.barrier();
+  auto sum_before = checksum(array);
+
+  dash::sort(array.begin(), array.end());
+
+  EXPECT_EQ_U(sum_before, checksum(array));
+  if (dash::myid() == 0) {
+    auto values = gather_all(array);
+    EXPECT_TRUE_U(std::is_sorted(values.begin(), values.end()));
+  }
+  array.barrier();
+}
+
+TEST_F(SortTest, SubRange)
+{
+  typedef int                     value_t;
+  typedef dash::Array<value_t>    array_t;
+
+  size_t num_local_elem = 100;
+  array_t array(num_local_elem * dash::size());
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = static_cast<value_t>(array.size() - array.pattern().global(l));
+  }
+  array.barrier();
+
+  // Range starts and ends within local blocks of units:
+  auto offset = num_local_elem / 2;
+  dash::sort(array.begin() + offset, array.end() - offset);
+
+  if (dash::myid() == 0) {
+    auto values = gather_all(array);
+    EXPECT_TRUE_U(std::is_sorted(values.begin() + offset,
+                                 values.end() - offset));
+    // Elements outside of the range are unchanged:
+    for (size_t i = 0; i < offset; ++i) {
+      EXPECT_EQ_U(array.size() - i, values[i]);
+    }
+  }
+  array.barrier();
+}
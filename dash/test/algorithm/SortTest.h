@@ -0,0 +1,18 @@
+#ifndef DASH__TEST__SORT_TEST_H_
+#define DASH__TEST__SORT_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithm dash::sort.
+ */
+class SortTest : public dash::test::TestBase {
+protected:
+
+  SortTest() {
+  }
+
+  virtual ~SortTest() {
+  }
+};
+#endif // DASH__TEST__SORT_TEST_H_
@@ -7,7 +7,9 @@
 #include <dash/Array.h>
 #include <dash/Matrix.h>
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 
 TEST_F(TransformTest, ArrayLocalPlusLocal)
@@ -43,13 +45,40 @@ TEST_F(TransformTest, ArrayLocalPlusLocal)
 
 }
 
-TEST_F(TransformTest, ArrayGlobalPlusLocalBlocking)
+TEST_F(TransformTest, ArrayLocalMaxLocalLarge)
 {
-  if (dash::size() == 3) {
-    // TODO: Fix this
-    SKIP_TEST();
+  // Local ranges large enough to be partitioned among threads
+  const size_t num_elem_local = (1 << 17) + 5;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  dash::Array<double> array_in(num_elem_total, dash::BLOCKED);
+  dash::Array<double> array_dest(num_elem_total, dash::BLOCKED);
+
+  for (size_t l_idx = 0; l_idx < num_elem_local; ++l_idx) {
+    array_in.local[l_idx]   = static_cast<double>(l_idx);
+    array_dest.local[l_idx] = 1000.5;
+  }
+  dash::barrier();
+
+  dash::transform_local<double>(
+      array_in.begin(), array_in.end(), // A
+      array_dest.begin(),               // B
+      array_dest.begin(),               // C = op(A,B)
+      dash::max<double>());             // op
+
+  dash::barrier();
+
+  size_t num_mismatch = 0;
+  for (size_t l_idx = 0; l_idx < num_elem_local; ++l_idx) {
+    double expected = std::max(static_cast<double>(l_idx), 1000.5);
+    if (array_dest.local[l_idx] != expected) {
+      ++num_mismatch;
+    }
   }
+  EXPECT_EQ_U(0, num_mismatch);
+}
 
+TEST_F(TransformTest, ArrayGlobalPlusLocalBlocking)
+{
   // Add local range to every block in global range
   const size_t num_elem_local = 5;
   size_t num_elem_total = dash::size() * num_elem_local;
@@ -113,6 +142,49 @@ TEST_F(TransformTest, ArrayGlobalPlusLocalBlocking)
   dash::barrier();
 }
 
+TEST_F(TransformTest, ArrayGlobalPlusLocalMultipleBlocks)
+{
+  // Add local range to a global range spanning blocks of all units
+  const size_t block_size     = 7;
+  const size_t num_blocks     = 3 * dash::size();
+  size_t       num_elem_total = block_size * num_blocks;
+  dash::Array<int> array_dest(num_elem_total, dash::BLOCKCYCLIC(block_size));
+
+  for (auto l_it = array_dest.lbegin(); l_it != array_dest.lend(); ++l_it) {
+    *l_it = 1000;
+  }
+  dash::barrier();
+
+  // Every unit adds its values to the range starting in the middle of
+  // the first block and ending in the middle of the last block:
+  size_t offset = block_size / 2;
+  size_t nelem  = num_elem_total - block_size;
+  std::vector<int> local(nelem);
+  for (size_t i = 0; i < nelem; ++i) {
+    local[i] = (dash::myid() + 1) * i;
+  }
+  auto transform_end =
+    dash::transform<int>(local.data(), local.data() + nelem, // A
+                         array_dest.begin() + offset,        // B
+                         array_dest.begin() + offset,        // B = op(B,A)
+                         dash::plus<int>());                 // op
+  EXPECT_EQ_U(offset + nelem, transform_end - array_dest.begin());
+
+  dash::barrier();
+
+  if (dash::myid() == 0) {
+    int sum_units = (dash::size() * (dash::size() + 1)) / 2;
+    for (size_t g = 0; g < num_elem_total; ++g) {
+      int expected = 1000;
+      if (g >= offset && g < offset + nelem) {
+        expected += sum_units * (g - offset);
+      }
+      EXPECT_EQ_U(expected, static_cast<int>(array_dest[g]));
+    }
+  }
+  dash::barrier();
+}
+
 TEST_F(TransformTest, ArrayGlobalPlusGlobalBlocking)
 {
   // Add values in global range to values in other global range
@@ -154,6 +226,44 @@ TEST_F(TransformTest, ArrayGlobalPlusGlobalBlocking)
   }
 }
 
+TEST_F(TransformTest, ArrayGlobalPlusGlobalDifferentPatterns)
+{
+  // Add values in a block-cyclic range to a blocked range
+  const size_t num_elem_local = 30;
+  size_t num_elem_total = dash::size() * num_elem_local;
+  dash::Array<int> array_dest(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_values(num_elem_total, dash::BLOCKCYCLIC(4));
+
+  if (dash::myid() == 0) {
+    for (size_t g = 0; g < num_elem_total; ++g) {
+      array_dest[g]   = 100;
+      array_values[g] = g;
+    }
+  }
+  dash::barrier();
+
+  // Transform range excluding the first and last element:
+  auto transform_end =
+    dash::transform<int>(array_values.begin() + 1, array_values.end() - 1,
+                         array_dest.begin() + 1,
+                         array_dest.begin() + 1,
+                         dash::plus<int>());
+  EXPECT_EQ_U(num_elem_total - 1, transform_end - array_dest.begin());
+
+  dash::barrier();
+
+  if (dash::myid() == 0) {
+    for (size_t g = 0; g < num_elem_total; ++g) {
+      int expected = 100;
+      if (g > 0 && g < num_elem_total - 1) {
+        expected += g;
+      }
+      EXPECT_EQ_U(expected, static_cast<int>(array_dest[g]));
+    }
+  }
+  dash::barrier();
+}
+
 TEST_F(TransformTest, MatrixGlobalPlusGlobalBlocking)
 {
   // Block-wise addition (a += b) of two matrices
@@ -96,3 +96,163 @@ TEST_F(ListTest, Initialization)
   }
 }
 
+
+TEST_F(ListTest, GlobalPushFrontPushBack)
+{
+  typedef int value_t;
+
+  dash::List<value_t> list(0);
+
+  if (dash::myid() == 0) {
+    list.queue.push_back(2);
+    list.queue.push_front(1);
+    list.queue.push_front(0);
+    list.queue.push_back(3);
+    EXPECT_EQ_U(0, static_cast<value_t>(list.queue.front()));
+    EXPECT_EQ_U(3, static_cast<value_t>(list.queue.back()));
+    EXPECT_EQ_U(4, list.queue.size());
+  }
+  list.barrier();
+  EXPECT_EQ_U(4, list.queue.size());
+  // Queue elements are not elements of the list:
+  EXPECT_EQ_U(0, list.size());
+
+  if (dash::myid() == dash::size() - 1) {
+    value_t value;
+    EXPECT_TRUE_U(list.queue.try_pop_back(value));
+    EXPECT_EQ_U(3, value);
+    EXPECT_TRUE_U(list.queue.try_pop_front(value));
+    EXPECT_EQ_U(0, value);
+    EXPECT_EQ_U(1, static_cast<value_t>(list.queue.front()));
+    EXPECT_EQ_U(2, static_cast<value_t>(list.queue.back()));
+    list.queue.pop_back();
+    list.queue.pop_front();
+    EXPECT_FALSE_U(list.queue.try_pop_front(value));
+    EXPECT_FALSE_U(list.queue.try_pop_back(value));
+    EXPECT_THROW(list.queue.front(), dash::exception::OutOfRange);
+  }
+  list.barrier();
+  EXPECT_EQ_U(0, list.queue.size());
+}
+
+TEST_F(ListTest, GlobalConcurrentPushBack)
+{
+  typedef int value_t;
+
+  auto nunits    = dash::size();
+  auto myid      = dash::myid();
+  // Size of node pool buckets, smaller than number of pushed elements to
+  // exhaust the initial node pools:
+  auto lbuf_size = 8;
+  auto nlocal    = 20;
+
+  dash::List<value_t> list(0, lbuf_size);
+
+  for (int round = 0; round < 2; ++round) {
+    // Node pools are only extended in barrier, push elements in chunks
+    // not exceeding the initial node pool capacity:
+    for (int chunk = 0; chunk < nlocal; chunk += lbuf_size / 2) {
+      for (int i = chunk; i < std::min(nlocal, chunk + lbuf_size / 2); ++i) {
+        list.queue.push_back(myid * 1000 + i);
+      }
+      list.barrier();
+    }
+    EXPECT_EQ_U(nlocal * nunits, list.queue.size());
+
+    if (myid == 0) {
+      // Elements pushed by the same unit keep their order:
+      std::vector<value_t> last(nunits, -1);
+      value_t value;
+      int     npopped = 0;
+      while (list.queue.try_pop_front(value)) {
+        auto unit = value / 1000;
+        EXPECT_LT_U(last[unit], value % 1000);
+        last[unit] = value % 1000;
+        ++npopped;
+      }
+      EXPECT_EQ_U(nlocal * nunits, npopped);
+    }
+    list.barrier();
+    EXPECT_EQ_U(0, list.queue.size());
+  }
+}
+
+TEST_F(ListTest, GlobalConcurrentPop)
+{
+  typedef long long value_t;
+
+  auto nunits = dash::size();
+  auto myid   = dash::myid();
+  auto nlocal = 50;
+
+  dash::ListQueue<value_t> queue(2 * nlocal);
+
+  for (int i = 0; i < nlocal; ++i) {
+    value_t value = myid * nlocal + i;
+    if (i % 2 == 0) {
+      queue.push_back(value);
+    } else {
+      queue.push_front(value);
+    }
+  }
+  queue.barrier();
+  EXPECT_EQ_U(nlocal * nunits, queue.size());
+
+  // Units remove elements at both ends concurrently, every element must be
+  // removed exactly once:
+  value_t lsum    = 0;
+  value_t lcount  = 0;
+  value_t value;
+  for (int i = 0; ; ++i) {
+    bool popped = (i + myid) % 2 == 0
+                  ? queue.try_pop_front(value)
+                  : queue.try_pop_back(value);
+    if (!popped) {
+      break;
+    }
+    lsum   += value;
+    lcount += 1;
+  }
+  value_t sum;
+  value_t count;
+  dart_allreduce(&lsum, &sum, 1, DART_TYPE_LONGLONG, DART_OP_SUM,
+                 dash::Team::All().dart_id());
+  dart_allreduce(&lcount, &count, 1, DART_TYPE_LONGLONG, DART_OP_SUM,
+                 dash::Team::All().dart_id());
+  value_t nglobal = nlocal * nunits;
+  EXPECT_EQ_U(nglobal, count);
+  EXPECT_EQ_U(nglobal * (nglobal - 1) / 2, sum);
+
+  queue.barrier();
+  EXPECT_EQ_U(0, queue.size());
+}
+
+TEST_F(ListTest, LocalSegmentsAndQueue)
+{
+  typedef int value_t;
+
+  auto nunits = dash::size();
+  auto myid   = dash::myid();
+
+  dash::List<value_t> list(0);
+
+  list.local.push_back(myid);
+  list.barrier();
+  EXPECT_EQ_U(nunits, list.size());
+  EXPECT_EQ_U(0, list.queue.size());
+  // Elements in local segments are not in the shared queue:
+  value_t value;
+  EXPECT_FALSE_U(list.queue.try_pop_front(value));
+  dash::internal::logging::disable_log();
+  EXPECT_THROW(list.queue.front(), dash::exception::OutOfRange);
+  dash::internal::logging::enable_log();
+  list.barrier();
+
+  list.queue.push_back(myid);
+  list.barrier();
+  EXPECT_EQ_U(nunits, list.size());
+  EXPECT_EQ_U(nunits, list.queue.size());
+  EXPECT_EQ_U(1, list.lsize());
+  EXPECT_EQ_U(myid, (*list.local.begin()).value);
+  list.barrier();
+}
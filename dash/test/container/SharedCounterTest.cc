@@ -0,0 +1,67 @@
+
+#include "SharedCounterTest.h"
+
+#include <dash/SharedCounter.h>
+
+
+TEST_F(SharedCounterTest, ConcurrentIncrement)
+{
+  typedef long value_t;
+
+  dash::SharedCounter<value_t> counter;
+  EXPECT_EQ_U(0, counter.get());
+
+  value_t num_inc = 100;
+  for (value_t i = 0; i < num_inc; ++i) {
+    counter.inc(dash::myid() + 1);
+  }
+  counter.dec(1);
+  dash::barrier();
+
+  value_t nunits   = dash::size();
+  value_t expected = num_inc * (nunits * (nunits + 1) / 2) - nunits;
+  EXPECT_EQ_U(expected, counter.get());
+  EXPECT_EQ_U(expected, counter.reduce());
+
+  dash::barrier();
+}
+
+TEST_F(SharedCounterTest, TeamCounter)
+{
+  typedef size_t value_t;
+
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+
+  auto & team = dash::Team::All().split(2);
+  dash::SharedCounter<value_t> counter(team);
+
+  counter.inc(2);
+  team.barrier();
+
+  EXPECT_EQ_U(2 * team.size(), counter.get());
+  EXPECT_EQ_U(2 * team.size(), counter.reduce());
+
+  team.barrier();
+}
+
+TEST_F(SharedCounterTest, FloatingPointIncrement)
+{
+  typedef double value_t;
+
+  dash::SharedCounter<value_t> counter;
+
+  int num_inc = 100;
+  for (int i = 0; i < num_inc; ++i) {
+    counter.inc(0.5);
+  }
+  counter.dec(0.25);
+  dash::barrier();
+
+  value_t expected = dash::size() * (num_inc * 0.5 - 0.25);
+  EXPECT_EQ_U(expected, counter.get());
+  EXPECT_EQ_U(expected, counter.reduce());
+
+  dash::barrier();
+}
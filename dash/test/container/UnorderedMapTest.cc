@@ -543,3 +543,206 @@ TEST_F(UnorderedMapTest, MappedAtomics)
   }
 }
 
+
+TEST_F(UnorderedMapTest, RemoteInsert)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  if (dash::size() < 2) {
+    LOG_MESSAGE(
+      "UnorderedMapTest.RemoteInsert requires at least two units");
+    return;
+  }
+
+  size_type nunits = dash::size();
+  map_t     map;
+
+  // Every unit inserts the same keys, most of them mapped to remote units.
+  // Number of keys exceeds initial capacity of staging buffers:
+  key_t nkeys = 1000 * nunits;
+  for (key_t key = 0; key < nkeys; ++key) {
+    map_value value({ key, 0.5 * key });
+    auto insertion = map.insert(value);
+    if (key % nunits == dash::myid().id) {
+      EXPECT_NE_U(map.end(), insertion.first);
+    }
+  }
+
+  map.barrier();
+
+  // Duplicate insertions by different units have been discarded:
+  EXPECT_EQ_U(nkeys, map.size());
+  EXPECT_EQ_U(nkeys / nunits, map.lsize());
+
+  for (key_t key = dash::myid().id; key < nkeys; key += 7) {
+    auto found = map.find(key);
+    EXPECT_NE_U(map.end(), found);
+    map_value found_value = *found;
+    EXPECT_EQ_U(key, found_value.first);
+    EXPECT_EQ_U(0.5 * key, found_value.second);
+    EXPECT_EQ_U(1, map.count(key));
+  }
+  EXPECT_EQ_U(0, map.count(nkeys + 1));
+  EXPECT_EQ_U(map.end(), map.find(-1));
+}
+
+TEST_F(UnorderedMapTest, BatchedInsertFind)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits = dash::size();
+  map_t     map;
+
+  // Every unit inserts a disjoint range of keys and a range of keys
+  // shared by all units:
+  key_t nkeys_unit = 2000;
+  key_t nkeys      = nkeys_unit * nunits;
+  std::vector<map_value> values;
+  for (key_t key = dash::myid().id * nkeys_unit;
+       key < (dash::myid().id + 1) * nkeys_unit; ++key) {
+    values.push_back(map_value({ key, 0.5 * key }));
+  }
+  for (key_t key = nkeys; key < nkeys + 100; ++key) {
+    values.push_back(map_value({ key, 0.5 * key }));
+  }
+  map.insert(values.begin(), values.end());
+
+  map.barrier();
+
+  EXPECT_EQ_U(nkeys + 100, map.size());
+
+  // Look up all keys of the succeeding unit and keys not contained in
+  // the map:
+  std::vector<key_t> keys;
+  key_t first_key = ((dash::myid().id + 1) % nunits) * nkeys_unit;
+  for (key_t key = first_key; key < first_key + nkeys_unit; ++key) {
+    keys.push_back(key);
+  }
+  keys.push_back(-1);
+  keys.push_back(nkeys + 100);
+
+  std::vector<map_t::iterator> found(keys.size());
+  auto found_end = map.find_many(keys.begin(), keys.end(), found.begin());
+  EXPECT_EQ_U(found.end(), found_end);
+  for (size_type k = 0; k < keys.size() - 2; ++k) {
+    EXPECT_NE_U(map.end(), found[k]);
+    EXPECT_EQ_U(found[k], map.find(keys[k]));
+    map_value found_value = *found[k];
+    EXPECT_EQ_U(keys[k], found_value.first);
+    EXPECT_EQ_U(0.5 * keys[k], found_value.second);
+  }
+  EXPECT_EQ_U(map.end(), found[keys.size() - 2]);
+  EXPECT_EQ_U(map.end(), found[keys.size() - 1]);
+}
+
+TEST_F(UnorderedMapTest, RemoteKeySubscript)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  if (dash::size() < 2) {
+    LOG_MESSAGE(
+      "UnorderedMapTest.RemoteKeySubscript requires at least two units");
+    return;
+  }
+
+  size_type nunits = dash::size();
+  key_t     myid   = dash::myid().id;
+  map_t     map;
+
+  // Key mapped to the succeeding unit is inserted in local memory by
+  // subscript:
+  key_t sub_key = 10 * nunits + (myid + 1) % nunits;
+  map[sub_key]  = 0.5 * sub_key;
+  EXPECT_EQ_U(1, map.lsize());
+  EXPECT_EQ_U(0.5 * sub_key, static_cast<mapped_t>(map[sub_key]));
+  EXPECT_EQ_U(1, map.lsize());
+
+  // Repeated insertion of a key staged at a remote unit is reported:
+  key_t ins_key = 20 * nunits + (myid + 1) % nunits;
+  map_value value({ ins_key, 0.5 * ins_key });
+  auto inserted = map.insert(value);
+  EXPECT_EQ_U(map.end(), inserted.first);
+  EXPECT_TRUE_U(inserted.second);
+  auto existing = map.insert(value);
+  EXPECT_EQ_U(map.end(), existing.first);
+  EXPECT_FALSE_U(existing.second);
+
+  map.barrier();
+
+  EXPECT_EQ_U(2 * nunits, map.size());
+  EXPECT_EQ_U(2, map.lsize());
+
+  // Elements inserted by subscript at other units are found at all units:
+  for (key_t u = 0; u < static_cast<key_t>(nunits); ++u) {
+    key_t key   = 10 * nunits + (u + 1) % nunits;
+    auto  found = map.find(key);
+    EXPECT_NE_U(map.end(), found);
+    map_value found_value = *found;
+    EXPECT_EQ_U(0.5 * key, found_value.second);
+    EXPECT_EQ_U(1, map.count(20 * nunits + (u + 1) % nunits));
+  }
+  // Existing element is not inserted again by subscript:
+  key_t next_key = 10 * nunits + (myid + 2) % nunits;
+  EXPECT_EQ_U(0.5 * next_key, static_cast<mapped_t>(map[next_key]));
+  EXPECT_EQ_U(2, map.lsize());
+  EXPECT_EQ_U(0, map.count(-1));
+}
+
+TEST_F(UnorderedMapTest, LocalHashFind)
+{
+  typedef int                                  key_t;
+  typedef double                               mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
+  typedef typename map_t::value_type           map_value;
+  typedef typename map_t::size_type            size_type;
+
+  size_type nunits     = dash::size();
+  key_t     nkeys_unit = 100;
+  map_t     map;
+
+  for (key_t key = dash::myid().id * nkeys_unit;
+       key < (dash::myid().id + 1) * nkeys_unit; ++key) {
+    map.insert(map_value({ key, 0.5 * key }));
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nkeys_unit * nunits, map.size());
+  for (size_type u = 0; u < nunits; ++u) {
+    EXPECT_EQ_U(nkeys_unit, map.bucket_size(u));
+  }
+
+  std::vector<key_t> keys;
+  for (key_t key = 0; key < static_cast<key_t>(nkeys_unit * nunits);
+       key += 3) {
+    keys.push_back(key);
+    auto found = map.find(key);
+    EXPECT_NE_U(map.end(), found);
+    map_value found_value = *found;
+    EXPECT_EQ_U(key, found_value.first);
+    EXPECT_EQ_U(0.5 * key, found_value.second);
+  }
+  keys.push_back(-1);
+  EXPECT_EQ_U(map.end(), map.find(-1));
+
+  std::vector<map_t::iterator> found(keys.size());
+  map.find_many(keys.begin(), keys.end(), found.begin());
+  for (size_type k = 0; k < keys.size() - 1; ++k) {
+    EXPECT_EQ_U(map.find(keys[k]), found[k]);
+  }
+  EXPECT_EQ_U(map.end(), found.back());
+}
@@ -50,3 +50,146 @@ TEST_F(DARTCollectiveTest, Sendrecv) {
     ASSERT_EQ(recv, data[partner]);
   }
 }
+
+TEST_F(DARTCollectiveTest, IBarrier) {
+  dart_handle_t handle;
+  ASSERT_EQ_U(DART_OK, dart_ibarrier(DART_TEAM_ALL, &handle));
+  int32_t finished = 0;
+  while (!finished) {
+    ASSERT_EQ_U(DART_OK, dart_test_local(handle, &finished));
+  }
+  ASSERT_EQ_U(DART_OK, dart_wait(handle));
+}
+
+TEST_F(DARTCollectiveTest, IAllreduce) {
+  int value  = _dash_id + 1;
+  int result = 0;
+  dart_handle_t handle;
+  ASSERT_EQ_U(DART_OK, dart_iallreduce(&value, &result, 1, DART_TYPE_INT,
+                                       DART_OP_SUM, DART_TEAM_ALL,
+                                       &handle));
+  ASSERT_EQ_U(DART_OK, dart_wait(handle));
+  int expected = (_dash_size * (_dash_size + 1)) / 2;
+  ASSERT_EQ_U(expected, result);
+}
+
+TEST_F(DARTCollectiveTest, IAllgatherv) {
+  // Unit u contributes u+1 values of u:
+  std::vector<size_t> counts(_dash_size);
+  std::vector<size_t> displs(_dash_size);
+  size_t total = 0;
+  for (size_t u = 0; u < _dash_size; ++u) {
+    counts[u] = u + 1;
+    displs[u] = total;
+    total    += counts[u];
+  }
+  std::vector<int> send(_dash_id + 1, _dash_id);
+  std::vector<int> recv(total, -1);
+  dart_handle_t handles[2];
+  ASSERT_EQ_U(DART_OK, dart_iallgatherv(send.data(), send.size(),
+                                        DART_TYPE_INT, recv.data(),
+                                        counts.data(), displs.data(),
+                                        DART_TEAM_ALL, &handles[0]));
+  // Count and displacement arrays are not referenced after the call:
+  counts.clear();
+  displs.clear();
+  ASSERT_EQ_U(DART_OK, dart_ibarrier(DART_TEAM_ALL, &handles[1]));
+  ASSERT_EQ_U(DART_OK, dart_waitall(handles, 2));
+  size_t idx = 0;
+  for (size_t u = 0; u < _dash_size; ++u) {
+    for (size_t i = 0; i <= u; ++i, ++idx) {
+      ASSERT_EQ_U(static_cast<int>(u), recv[idx]);
+    }
+  }
+}
+
+TEST_F(DARTCollectiveTest, Alltoall) {
+  // Unit i sends value (i * 100 + u) to unit u:
+  std::vector<int> send(_dash_size);
+  std::vector<int> recv(_dash_size, -1);
+  for (size_t u = 0; u < _dash_size; ++u) {
+    send[u] = _dash_id * 100 + u;
+  }
+  ASSERT_EQ_U(DART_OK, dart_alltoall(send.data(), recv.data(), 1,
+                                     DART_TYPE_INT, DART_TEAM_ALL));
+  for (size_t u = 0; u < _dash_size; ++u) {
+    ASSERT_EQ_U(static_cast<int>(u * 100 + _dash_id), recv[u]);
+  }
+}
+
+TEST_F(DARTCollectiveTest, Alltoallv) {
+  // Unit i sends u+1 values of (i * 100 + u) to unit u and receives i+1
+  // values from every unit:
+  std::vector<size_t> scounts(_dash_size), sdispls(_dash_size);
+  std::vector<size_t> rcounts(_dash_size), rdispls(_dash_size);
+  size_t stotal = 0, rtotal = 0;
+  for (size_t u = 0; u < _dash_size; ++u) {
+    scounts[u] = u + 1;
+    sdispls[u] = stotal;
+    stotal    += scounts[u];
+    rcounts[u] = _dash_id + 1;
+    rdispls[u] = rtotal;
+    rtotal    += rcounts[u];
+  }
+  std::vector<int> send(stotal);
+  for (size_t u = 0; u < _dash_size; ++u) {
+    std::fill_n(send.begin() + sdispls[u], scounts[u],
+                _dash_id * 100 + u);
+  }
+  std::vector<int> recv(rtotal, -1);
+  std::vector<int> irecv(rtotal, -1);
+  ASSERT_EQ_U(DART_OK, dart_alltoallv(send.data(), scounts.data(),
+                                      sdispls.data(), DART_TYPE_INT,
+                                      recv.data(), rcounts.data(),
+                                      rdispls.data(), DART_TEAM_ALL));
+  dart_handle_t handle;
+  ASSERT_EQ_U(DART_OK, dart_ialltoallv(send.data(), scounts.data(),
+                                       sdispls.data(), DART_TYPE_INT,
+                                       irecv.data(), rcounts.data(),
+                                       rdispls.data(), DART_TEAM_ALL,
+                                       &handle));
+  ASSERT_EQ_U(DART_OK, dart_wait(handle));
+  for (size_t u = 0; u < _dash_size; ++u) {
+    for (size_t i = 0; i < rcounts[u]; ++i) {
+      ASSERT_EQ_U(static_cast<int>(u * 100 + _dash_id),
+                  recv[rdispls[u] + i]);
+    }
+  }
+  ASSERT_EQ_U(recv, irecv);
+}
+
+TEST_F(DARTCollectiveTest, NeighborAlltoallv) {
+  // Exchange with left and right neighbors in a ring, including the
+  // unit itself for a single unit:
+  dart_team_unit_t left  { static_cast<dart_unit_t>(
+                             (_dash_id + _dash_size - 1) % _dash_size) };
+  dart_team_unit_t right { static_cast<dart_unit_t>(
+                             (_dash_id + 1) % _dash_size) };
+  size_t nunits = (_dash_size > 2) ? 2 : 1;
+  dart_team_unit_t units[2] = { left, right };
+  size_t counts[2]  = { 2, 2 };
+  size_t displs[2]  = { 0, 2 };
+  int    send[4]    = { static_cast<int>(_dash_id),
+                        static_cast<int>(_dash_id),
+                        static_cast<int>(_dash_id + 100),
+                        static_cast<int>(_dash_id + 100) };
+  int    recv[4]    = { -1, -1, -1, -1 };
+  if (nunits == 1) {
+    // Left and right neighbor are identical, send right values only:
+    displs[0] = 2;
+  }
+  ASSERT_EQ_U(DART_OK, dart_neighbor_alltoallv(send, nunits, units,
+                                               counts, displs,
+                                               DART_TYPE_INT,
+                                               recv, nunits, units,
+                                               counts, displs,
+                                               DART_TEAM_ALL));
+  if (nunits == 2) {
+    // Values sent to the right by the left neighbor:
+    ASSERT_EQ_U(static_cast<int>(left.id), recv[0] - 100);
+    // Values sent to the left by the right neighbor:
+    ASSERT_EQ_U(static_cast<int>(right.id), recv[2]);
+  } else {
+    ASSERT_EQ_U(static_cast<int>(left.id + 100), recv[2]);
+  }
+}
@@ -234,3 +234,129 @@ TEST_F(DARTLockTest, TeamLockUnlock) {
     dart_team_lock_destroy(&lock));
 
 }
+
+TEST_F(DARTLockTest, HierarchicalLockUnlock) {
+  using value_t = int;
+  constexpr int num_iterations = 100;
+  dash::Shared<value_t> shared;
+  dart_lock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_init_hierarchical(DART_TEAM_ALL, &lock));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_acquire(lock));
+    shared.set(shared.get() + 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(num_iterations * dash::size(), static_cast<value_t>(shared.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, HierarchicalTryLockUnlock) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  dash::Shared<value_t> shared;
+  dart_lock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_init_hierarchical(DART_TEAM_ALL, &lock));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    int32_t acquired;
+    do {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_try_acquire(lock, &acquired));
+    } while (!acquired);
+    shared.set(shared.get() + 1);
+    // mix with blocking acquisitions
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_acquire(lock));
+    shared.set(shared.get() + 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(2 * num_iterations * dash::size(),
+              static_cast<value_t>(shared.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, RWLockReadWrite) {
+  using value_t = int;
+  constexpr int num_iterations = 20;
+  dash::Shared<value_t> shared;
+  dart_rwlock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &lock));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    if (i % 4 == 0) {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_acquire_write(lock));
+      // value is not modified by other writers in between
+      value_t value = shared.get();
+      shared.set(value + 1);
+      EXPECT_EQ_U(value + 1, static_cast<value_t>(shared.get()));
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_release_write(lock));
+    } else {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_acquire_read(lock));
+      value_t value = shared.get();
+      EXPECT_EQ_U(value, static_cast<value_t>(shared.get()));
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_release_read(lock));
+    }
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U((num_iterations / 4) * dash::size(),
+              static_cast<value_t>(shared.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_destroy(&lock));
+}
@@ -159,3 +159,125 @@ TEST_F(DARTMemAllocTest, SegmentReuseTest)
     DART_OK,
     dart_team_memfree(gptr2));
 }
+
+TEST_F(DARTMemAllocTest, ManySegments)
+{
+  // Exceed the initial size of the segment table:
+  const size_t num_segments = 600;
+  std::vector<dart_gptr_t> gptrs(num_segments);
+  for (size_t s = 0; s < num_segments; ++s) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memalloc_aligned(
+        DART_TEAM_ALL, 1, DART_TYPE_INT, &gptrs[s]));
+    int * addr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_setunit(&gptrs[s], dash::Team::All().myid()));
+    ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptrs[s], (void **)&addr));
+    *addr = static_cast<int>(s);
+  }
+  dash::barrier();
+
+  // Read values from the succeeding unit in every segment:
+  dart_team_unit_t next_unit{
+    static_cast<int>((dash::myid() + 1) % dash::size()) };
+  for (size_t s = 0; s < num_segments; ++s) {
+    dart_gptr_t gptr = gptrs[s];
+    ASSERT_EQ_U(DART_OK, dart_gptr_setunit(&gptr, next_unit));
+    int value = -1;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_blocking(&value, gptr, 1, DART_TYPE_INT));
+    EXPECT_EQ_U(static_cast<int>(s), value);
+  }
+  dash::barrier();
+
+  for (size_t s = 0; s < num_segments; ++s) {
+    ASSERT_EQ_U(DART_OK, dart_team_memfree(gptrs[s]));
+  }
+}
+
+TEST_F(DARTMemAllocTest, ManySmallLocalAllocs)
+{
+  // Cover all size classes and sizes between them:
+  const size_t num_allocs = 1500;
+  std::vector<dart_gptr_t> gptrs(num_allocs);
+  std::vector<char *>      addrs(num_allocs);
+  for (size_t a = 0; a < num_allocs; ++a) {
+    size_t nbytes = 1 + (a * 7) % 1100;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(nbytes, DART_TYPE_BYTE, &gptrs[a]));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_getaddr(gptrs[a], (void **)&addrs[a]));
+    // Blocks are aligned like memory returned from malloc:
+    size_t align = (nbytes > 8) ? 16 : 8;
+    EXPECT_EQ_U(0, reinterpret_cast<uintptr_t>(addrs[a]) % align);
+    memset(addrs[a], static_cast<int>(a % 128), nbytes);
+  }
+  // Blocks must not overlap:
+  for (size_t a = 0; a < num_allocs; ++a) {
+    size_t nbytes = 1 + (a * 7) % 1100;
+    for (size_t b = 0; b < nbytes; ++b) {
+      ASSERT_EQ_U(static_cast<char>(a % 128), addrs[a][b]);
+    }
+  }
+  // Free every other block and allocate again:
+  for (size_t a = 0; a < num_allocs; a += 2) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[a]));
+  }
+  for (size_t a = 0; a < num_allocs; a += 2) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(1 + (a * 7) % 1100, DART_TYPE_BYTE, &gptrs[a]));
+  }
+  for (size_t a = 0; a < num_allocs; ++a) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[a]));
+  }
+}
+
+TEST_F(DARTMemAllocTest, LocalAllocBeyondPool)
+{
+  typedef int value_t;
+  // Exceeds the default initial size of the local memory pool:
+  const size_t num_blocks = 3;
+  const size_t block_size = (8 * 1024 * 1024) / sizeof(value_t);
+
+  std::vector<dart_gptr_t> gptrs(num_blocks);
+  for (size_t b = 0; b < num_blocks; ++b) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(block_size, DART_TYPE_INT, &gptrs[b]));
+    value_t * addr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_getaddr(gptrs[b], (void **)&addr));
+    addr[0]              = dash::myid().id;
+    addr[block_size - 1] = static_cast<value_t>(b);
+  }
+
+  dash::Array<dart_gptr_t> arr(dash::size());
+  arr.local[0] = gptrs[num_blocks - 1];
+  arr.barrier();
+
+  size_t  neighbor_id = (dash::myid().id + 1) % dash::size();
+  dart_gptr_t gptr    = arr[neighbor_id];
+  value_t neighbor_val;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(&neighbor_val, gptr, 1, DART_TYPE_INT));
+  EXPECT_EQ_U(neighbor_id, neighbor_val);
+  gptr.addr_or_offs.offset += (block_size - 1) * sizeof(value_t);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(&neighbor_val, gptr, 1, DART_TYPE_INT));
+  EXPECT_EQ_U(num_blocks - 1, neighbor_val);
+
+  arr.barrier();
+
+  for (size_t b = 0; b < num_blocks; ++b) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[b]));
+  }
+}
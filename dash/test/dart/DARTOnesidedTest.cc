@@ -3,6 +3,10 @@
 
 #include <dash/Array.h>
 #include <dash/Onesided.h>
+#include <dash/SyncEpoch.h>
+#include <dash/algorithm/Fill.h>
+
+#include <vector>
 
 
 TEST_F(DARTOnesidedTest, GetBlockingSingleBlock)
@@ -176,3 +180,324 @@ TEST_F(DARTOnesidedTest, GetHandleAllRemote)
   delete[] local_array;
   ASSERT_EQ_U(num_elem_copy, l);
 }
+
+TEST_F(DARTOnesidedTest, StridedGetPut)
+{
+  typedef int value_t;
+  const size_t block_size  = 12;
+  const size_t nelem_block = 2;
+  const size_t stride      = 4;
+  const size_t nblocks     = block_size / stride;
+  size_t num_elem_total    = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < block_size; ++l) {
+    array.local[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  array.barrier();
+
+  // Read elements { 0, 1, 4, 5, 8, 9 } from the next unit's block:
+  dart_unit_t unit_src = (dash::myid() + 1) % dash::size();
+  value_t     local_array[nblocks * nelem_block];
+  dart_storage_t ds = dash::dart_storage<value_t>(nelem_block);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_strided_blocking(
+      local_array,
+      (array.begin() + (unit_src * block_size)).dart_gptr(),
+      nblocks,
+      ds.nelem,
+      ds.nelem / nelem_block * stride,
+      ds.dtype));
+  for (size_t b = 0; b < nblocks; ++b) {
+    for (size_t e = 0; e < nelem_block; ++e) {
+      value_t expected = ((unit_src + 1) * 1000) + (b * stride) + e;
+      ASSERT_EQ_U(expected, local_array[b * nelem_block + e]);
+    }
+  }
+  array.barrier();
+
+  // Negate the same elements in the next unit's block:
+  for (size_t i = 0; i < nblocks * nelem_block; ++i) {
+    local_array[i] = -local_array[i];
+  }
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_strided_blocking(
+      (array.begin() + (unit_src * block_size)).dart_gptr(),
+      local_array,
+      nblocks,
+      ds.nelem,
+      ds.nelem / nelem_block * stride,
+      ds.dtype));
+  array.barrier();
+
+  for (size_t l = 0; l < block_size; ++l) {
+    value_t expected = ((dash::myid() + 1) * 1000) + l;
+    if (l % stride < nelem_block) {
+      expected = -expected;
+    }
+    ASSERT_EQ_U(expected, static_cast<value_t>(array.local[l]));
+  }
+}
+
+TEST_F(DARTOnesidedTest, IndexedGetHandle)
+{
+  typedef int value_t;
+  const size_t block_size = 10;
+  size_t num_elem_total   = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < block_size; ++l) {
+    array.local[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  array.barrier();
+
+  // Read elements { 1, 2, 3, 5, 9 } from the next unit's block:
+  dart_unit_t         unit_src = (dash::myid() + 1) % dash::size();
+  std::vector<size_t> nelem_blocks { 3, 1, 1 };
+  std::vector<size_t> displs       { 1, 5, 9 };
+  std::vector<value_t> local_array(5);
+  dart_handle_t handle;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_indexed_handle(
+      local_array.data(),
+      (array.begin() + (unit_src * block_size)).dart_gptr(),
+      nelem_blocks.size(),
+      nelem_blocks.data(),
+      displs.data(),
+      dash::dart_datatype<value_t>::value,
+      &handle));
+  ASSERT_EQ_U(DART_OK, dart_wait(handle));
+
+  std::vector<size_t> indices { 1, 2, 3, 5, 9 };
+  for (size_t i = 0; i < indices.size(); ++i) {
+    value_t expected = ((unit_src + 1) * 1000) + indices[i];
+    ASSERT_EQ_U(expected, local_array[i]);
+  }
+  array.barrier();
+}
+
+TEST_F(DARTOnesidedTest, FenceEpochPut)
+{
+  typedef int value_t;
+  const size_t block_size = 10;
+  size_t num_elem_total   = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), -1);
+  array.barrier();
+
+  // Write own block values to the block of the next unit:
+  dart_unit_t unit_dst = (dash::myid() + 1) % dash::size();
+  std::vector<value_t> values(block_size);
+  for (size_t l = 0; l < block_size; ++l) {
+    values[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  {
+    dash::FenceEpoch epoch;
+    // Blocking operations are not permitted in active-target epochs:
+    value_t tmp;
+    ASSERT_EQ_U(
+      DART_ERR_INVAL,
+      dart_get_blocking(
+        &tmp, array.begin().dart_gptr(), 1,
+        dash::dart_datatype<value_t>::value));
+    // First half before fence, second half after fence:
+    for (size_t half = 0; half < 2; ++half) {
+      size_t offset = half * (block_size / 2);
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_put(
+          (array.begin() + (unit_dst * block_size) + offset).dart_gptr(),
+          values.data() + offset,
+          block_size / 2,
+          dash::dart_datatype<value_t>::value));
+      // Flushes have no effect in the epoch:
+      ASSERT_EQ_U(DART_OK, dart_flush_all(array.begin().dart_gptr()));
+      epoch.fence();
+    }
+    epoch.close();
+    // Closing again has no effect:
+    epoch.close();
+  }
+  dart_unit_t unit_src = (dash::myid() + dash::size() - 1) % dash::size();
+  for (size_t l = 0; l < block_size; ++l) {
+    value_t expected = ((unit_src + 1) * 1000) + l;
+    ASSERT_EQ_U(expected, static_cast<value_t>(array.local[l]));
+  }
+  array.barrier();
+}
+
+TEST_F(DARTOnesidedTest, NeighborEpochPutRing)
+{
+  typedef int value_t;
+  const size_t block_size = 10;
+  size_t num_elem_total   = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), -1);
+  array.barrier();
+
+  // Each unit writes to the next unit and is written to by the previous
+  // unit in the ring:
+  dash::team_unit_t unit_dst((dash::myid() + 1) % dash::size());
+  dash::team_unit_t unit_src(
+                      (dash::myid() + dash::size() - 1) % dash::size());
+  std::vector<value_t> values(block_size);
+  for (size_t l = 0; l < block_size; ++l) {
+    values[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  {
+    dash::NeighborEpoch epoch({ unit_src }, { unit_dst });
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_put(
+        (array.begin() + (unit_dst * block_size)).dart_gptr(),
+        values.data(),
+        block_size,
+        dash::dart_datatype<value_t>::value));
+    epoch.close();
+  }
+  for (size_t l = 0; l < block_size; ++l) {
+    value_t expected = ((unit_src + 1) * 1000) + l;
+    ASSERT_EQ_U(expected, static_cast<value_t>(array.local[l]));
+  }
+  array.barrier();
+
+  // Symmetric neighbors, read the block of the previous and next unit:
+  std::vector<value_t> left(block_size);
+  std::vector<value_t> right(block_size);
+  {
+    dash::NeighborEpoch epoch({ unit_src, unit_dst });
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get(
+        left.data(),
+        (array.begin() + (unit_src * block_size)).dart_gptr(),
+        block_size,
+        dash::dart_datatype<value_t>::value));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get(
+        right.data(),
+        (array.begin() + (unit_dst * block_size)).dart_gptr(),
+        block_size,
+        dash::dart_datatype<value_t>::value));
+  }
+  for (size_t l = 0; l < block_size; ++l) {
+    ASSERT_EQ_U(array[unit_src * block_size + l], left[l]);
+    ASSERT_EQ_U(array[unit_dst * block_size + l], right[l]);
+  }
+  array.barrier();
+}
+
+TEST_F(DARTOnesidedTest, WaitAllMultipleHandlesPerTarget)
+{
+  typedef int value_t;
+  const size_t block_size = 64;
+  size_t num_elem_total   = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), -1);
+  array.barrier();
+
+  // Put single elements to all units, multiple handles per target unit:
+  std::vector<value_t>       values(num_elem_total);
+  std::vector<dart_handle_t> handles;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    size_t l_first = dash::myid() * (block_size / dash::size());
+    for (size_t l = l_first; l < l_first + block_size / dash::size(); ++l) {
+      size_t g = u * block_size + l;
+      values[g] = (dash::myid() + 1) * 1000 + l;
+      dart_handle_t handle;
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_put_handle(
+          (array.begin() + g).dart_gptr(),
+          &values[g],
+          1,
+          dash::dart_datatype<value_t>::value,
+          &handle));
+      handles.push_back(handle);
+    }
+  }
+  ASSERT_EQ_U(DART_OK, dart_waitall(handles.data(), handles.size()));
+  array.barrier();
+
+  for (size_t l = 0; l < (block_size / dash::size()) * dash::size(); ++l) {
+    value_t expected = (l / (block_size / dash::size()) + 1) * 1000 + l;
+    ASSERT_EQ_U(expected, static_cast<value_t>(array.local[l]));
+  }
+  array.barrier();
+}
+
+TEST_F(DARTOnesidedTest, HandleGroup)
+{
+  typedef int value_t;
+  const size_t block_size = 10;
+  size_t num_elem_total   = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < block_size; ++l) {
+    array.local[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  array.barrier();
+
+  dart_handle_group_t group;
+  ASSERT_EQ_U(DART_OK, dart_handle_group_create(&group));
+
+  // Read the blocks of all units, contiguous, strided and indexed:
+  std::vector<value_t> contiguous(num_elem_total);
+  std::vector<value_t> strided(dash::size() * (block_size / 2));
+  std::vector<value_t> indexed(dash::size() * 2);
+  std::vector<size_t>  nelem_blocks { 1, 1 };
+  std::vector<size_t>  displs       { 3, 7 };
+  for (size_t u = 0; u < dash::size(); ++u) {
+    auto gptr = (array.begin() + u * block_size).dart_gptr();
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_grouped(
+        contiguous.data() + u * block_size, gptr, block_size,
+        dash::dart_datatype<value_t>::value, group));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_strided_grouped(
+        strided.data() + u * (block_size / 2), gptr, block_size / 2, 1, 2,
+        dash::dart_datatype<value_t>::value, group));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_indexed_grouped(
+        indexed.data() + u * 2, gptr, 2, nelem_blocks.data(),
+        displs.data(), dash::dart_datatype<value_t>::value, group));
+  }
+  ASSERT_EQ_U(DART_OK, dart_handle_group_waitall(group));
+
+  for (size_t u = 0; u < dash::size(); ++u) {
+    for (size_t l = 0; l < block_size; ++l) {
+      value_t expected = ((u + 1) * 1000) + l;
+      ASSERT_EQ_U(expected, contiguous[u * block_size + l]);
+      if (l % 2 == 0) {
+        ASSERT_EQ_U(expected, strided[u * (block_size / 2) + l / 2]);
+      }
+    }
+    ASSERT_EQ_U(((u + 1) * 1000) + 3, indexed[u * 2]);
+    ASSERT_EQ_U(((u + 1) * 1000) + 7, indexed[u * 2 + 1]);
+  }
+  array.barrier();
+
+  // Reuse the group to write to the next unit:
+  dart_unit_t unit_dst = (dash::myid() + 1) % dash::size();
+  std::vector<value_t> values(block_size, dash::myid());
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_grouped(
+      (array.begin() + unit_dst * block_size).dart_gptr(),
+      values.data(), block_size,
+      dash::dart_datatype<value_t>::value, group));
+  ASSERT_EQ_U(DART_OK, dart_handle_group_waitall(group));
+  array.barrier();
+
+  dart_unit_t unit_src = (dash::myid() + dash::size() - 1) % dash::size();
+  for (size_t l = 0; l < block_size; ++l) {
+    ASSERT_EQ_U(unit_src, static_cast<value_t>(array.local[l]));
+  }
+  ASSERT_EQ_U(DART_OK, dart_handle_group_destroy(&group));
+  ASSERT_EQ_U(nullptr, group);
+  array.barrier();
+}
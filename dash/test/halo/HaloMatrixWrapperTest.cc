@@ -0,0 +1,197 @@
+
+#include "HaloMatrixWrapperTest.h"
+
+#include <dash/Matrix.h>
+#include <dash/pattern/BlockPattern.h>
+#include <dash/pattern/TilePattern.h>
+#include <dash/halo/HaloMatrixWrapper.h>
+
+#include <array>
+
+
+namespace {
+
+template <typename MatrixT>
+void fill_matrix(MatrixT & matrix)
+{
+  const auto & pattern = matrix.pattern();
+  for (size_t l = 0; l < pattern.local_size(); ++l) {
+    auto coords = pattern.coords(pattern.global(l));
+    matrix.lbegin()[l] = coords[0] * 1000 + coords[1];
+  }
+  matrix.barrier();
+}
+
+/**
+ * Validates the values of all halo elements of all local blocks.
+ */
+template <typename HaloT>
+void check_halos(
+  HaloT                                     & halo,
+  const dash::halo::GlobalBoundarySpec<2>   & boundary,
+  int                                         custom_value)
+{
+  const auto & pattern  = halo.matrix().pattern();
+  const auto & halospec = halo.halospec();
+  for (size_t lb = 0; lb < halo.num_blocks(); ++lb) {
+    auto view = halo.block_view(lb);
+    for (long i = view.offset(0) + halospec.offset_range(0).min;
+         i < view.offset(0) + static_cast<long>(view.extent(0))
+               + halospec.offset_range(0).max; ++i) {
+      for (long j = view.offset(1) + halospec.offset_range(1).min;
+           j < view.offset(1) + static_cast<long>(view.extent(1))
+                 + halospec.offset_range(1).max; ++j) {
+        std::array<long, 2> coords {{ i, j }};
+        std::array<long, 2> wrapped(coords);
+        bool is_none   = false;
+        bool is_custom = false;
+        for (int d = 0; d < 2; ++d) {
+          long extent_d = pattern.extent(d);
+          if (coords[d] >= 0 && coords[d] < extent_d) {
+            continue;
+          }
+          is_none   |= boundary[d] == dash::halo::BoundaryProp::NONE;
+          is_custom |= boundary[d] == dash::halo::BoundaryProp::CUSTOM;
+          wrapped[d] = (coords[d] + extent_d) % extent_d;
+        }
+        typename HaloT::coords_type h_coords {{ i, j }};
+        if (is_custom) {
+          EXPECT_EQ_U(custom_value, halo.value_at(lb, h_coords));
+        } else if (!is_none) {
+          EXPECT_EQ_U(wrapped[0] * 1000 + wrapped[1],
+                      halo.value_at(lb, h_coords));
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST_F(HaloMatrixWrapperTest, CyclicBlocked)
+{
+  const size_t ext_x = 4 * dash::size();
+  const size_t ext_y = 3 * dash::size() + 1;
+  dash::Matrix<int, 2> matrix(
+    dash::SizeSpec<2>(ext_x, ext_y),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+    dash::Team::All(),
+    dash::TeamSpec<2>(dash::Team::All()));
+  fill_matrix(matrix);
+
+  dash::HaloSpec<2> halospec({{ { -1, 1 }, { -1, 1 } }});
+  dash::halo::GlobalBoundarySpec<2> boundary(
+    dash::halo::BoundaryProp::CYCLIC,
+    dash::halo::BoundaryProp::CYCLIC);
+  dash::halo::HaloMatrixWrapper<decltype(matrix)> halo(
+    matrix, halospec, boundary);
+
+  ASSERT_EQ_U(1, halo.num_blocks());
+  // Faces, edges and corners:
+  ASSERT_EQ_U(8, halo.regions(0).size());
+  auto inner = halo.inner_view(0);
+  auto view  = halo.block_view(0);
+  for (int d = 0; d < 2; ++d) {
+    ASSERT_EQ_U(view.offset(d) + 1, inner.offset(d));
+    ASSERT_EQ_U(std::max<long>(view.extent(d) - 2, 0), inner.extent(d));
+  }
+
+  halo.update_async();
+  halo.wait();
+  check_halos(halo, boundary, 0);
+  matrix.barrier();
+
+  // Modify matrix and update again:
+  for (size_t l = 0; l < matrix.local.size(); ++l) {
+    matrix.lbegin()[l] *= -1;
+  }
+  matrix.barrier();
+  halo.update();
+  const auto & pattern = matrix.pattern();
+  auto west = halo.halo_region_begin(0, {{ 0, -1 }});
+  ASSERT_NE_U(nullptr, west);
+  long j = (view.offset(1) - 1 + ext_y) % ext_y;
+  for (size_t i = 0; i < view.extent(0); ++i) {
+    long g_i = view.offset(0) + i;
+    EXPECT_EQ_U(-(g_i * 1000 + j), west[i]);
+  }
+  matrix.barrier();
+}
+
+TEST_F(HaloMatrixWrapperTest, MultipleBlocksCustomBoundary)
+{
+  typedef dash::TilePattern<2>          pattern_t;
+  typedef pattern_t::index_type         index_t;
+
+  const size_t block_x = 3;
+  const size_t block_y = 4;
+  pattern_t pattern(
+    dash::SizeSpec<2>(block_x * 2 * dash::size(), block_y * 3),
+    dash::DistributionSpec<2>(dash::TILE(block_x), dash::TILE(block_y)),
+    dash::TeamSpec<2>(dash::size(), 1));
+  dash::Matrix<int, 2, index_t, pattern_t> matrix(pattern);
+  fill_matrix(matrix);
+
+  // Asymmetric stencil with halo width 2 spanning most of the block
+  // extent in dimension 0 on the negative side:
+  dash::HaloSpec<2> halospec({{ { -2, 1 }, { 0, 2 } }});
+  dash::halo::GlobalBoundarySpec<2> boundary(
+    dash::halo::BoundaryProp::CUSTOM,
+    dash::halo::BoundaryProp::NONE);
+  dash::halo::HaloMatrixWrapper<decltype(matrix)> halo(
+    matrix, halospec, boundary);
+
+  ASSERT_EQ_U(matrix.pattern().local_blockspec().size(), halo.num_blocks());
+  ASSERT_GT_U(halo.num_blocks(), 1);
+  for (size_t lb = 0; lb < halo.num_blocks(); ++lb) {
+    // No regions in negative direction of dimension 1:
+    ASSERT_EQ_U(nullptr, halo.halo_region_begin(lb, {{ 0, -1 }}));
+    ASSERT_EQ_U(5, halo.regions(lb).size());
+  }
+
+  halo.set_custom_halos(
+    [](const std::array<index_t, 2> &) { return -1; });
+  halo.update_async();
+  halo.wait();
+  check_halos(halo, boundary, -1);
+  matrix.barrier();
+}
+
+TEST_F(HaloMatrixWrapperTest, UnderfilledBoundaryBlock)
+{
+  typedef dash::BlockPattern<2>         pattern_t;
+  typedef pattern_t::index_type         index_t;
+
+  const size_t block_x = 3;
+  // Last block in dimension 0 has extent 1:
+  pattern_t pattern(
+    dash::SizeSpec<2>(block_x * 2 * dash::size() + 1, 8),
+    dash::DistributionSpec<2>(dash::BLOCKCYCLIC(block_x), dash::NONE),
+    dash::TeamSpec<2>(dash::size(), 1));
+  dash::Matrix<int, 2, index_t, pattern_t> matrix(pattern);
+  fill_matrix(matrix);
+
+  // Halo width 2 in dimension 0 exceeds the extent of the last block,
+  // halo regions of its neighbors reach partly beyond the boundary:
+  dash::HaloSpec<2> halospec({{ { -2, 2 }, { -1, 1 } }});
+  dash::halo::GlobalBoundarySpec<2> cyclic(
+    dash::halo::BoundaryProp::CYCLIC,
+    dash::halo::BoundaryProp::CYCLIC);
+  dash::halo::HaloMatrixWrapper<decltype(matrix)> halo_cyclic(
+    matrix, halospec, cyclic);
+  halo_cyclic.update();
+  check_halos(halo_cyclic, cyclic, 0);
+
+  // Elements within the matrix extents are updated in regions that are
+  // split at the boundary:
+  dash::halo::GlobalBoundarySpec<2> fixed(
+    dash::halo::BoundaryProp::NONE,
+    dash::halo::BoundaryProp::CUSTOM);
+  dash::halo::HaloMatrixWrapper<decltype(matrix)> halo_fixed(
+    matrix, halospec, fixed);
+  halo_fixed.set_custom_halos(
+    [](const decltype(halo_fixed)::coords_type &) { return -1; });
+  halo_fixed.update();
+  check_halos(halo_fixed, fixed, -1);
+  matrix.barrier();
+}
@@ -0,0 +1,19 @@
+#ifndef DASH__TEST__HALO_MATRIX_WRAPPER_TEST_H_
+#define DASH__TEST__HALO_MATRIX_WRAPPER_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::halo::HaloMatrixWrapper.
+ */
+class HaloMatrixWrapperTest : public dash::test::TestBase {
+protected:
+
+  HaloMatrixWrapperTest() {
+  }
+
+  virtual ~HaloMatrixWrapperTest() {
+  }
+};
+
+#endif // DASH__TEST__HALO_MATRIX_WRAPPER_TEST_H_
@@ -554,3 +554,93 @@ TEST_F(GlobHeapMemTest, RemoteAccess)
     }
   }
 }
+
+TEST_F(GlobHeapMemTest, UnbalancedBucketsCommit)
+{
+  typedef int value_t;
+
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("Test case requires at least two units");
+  }
+
+  // Every unit allocates a different number of buckets with different
+  // sizes between commits:
+  size_t initial_local_capacity = 4;
+  dash::GlobHeapMem<value_t> gdmem(initial_local_capacity);
+
+  auto bucket_size = [](dash::team_unit_t u, size_t b) -> size_t {
+                       return 1 + ((u + b) % 3);
+                     };
+  auto num_buckets = [](dash::team_unit_t u) -> size_t {
+                       return 2 * u;
+                     };
+  auto lsize_expected = [&](dash::team_unit_t u) -> size_t {
+                          size_t lsize = initial_local_capacity;
+                          for (size_t b = 0; b < num_buckets(u); ++b) {
+                            lsize += bucket_size(u, b);
+                          }
+                          return lsize;
+                        };
+
+  dash::team_unit_t myid(dash::myid());
+  for (size_t b = 0; b < num_buckets(myid); ++b) {
+    gdmem.grow(bucket_size(myid, b));
+  }
+  ASSERT_EQ_U(lsize_expected(myid), gdmem.local_size());
+
+  auto lbegin = gdmem.lbegin();
+  for (size_t li = 0; li < gdmem.local_size(); ++li) {
+    *(lbegin + li) = (1000 * (myid + 1)) + li;
+  }
+
+  gdmem.commit();
+
+  size_t gsize_expected = 0;
+  for (dash::team_unit_t u{0}; u < dash::size(); ++u) {
+    EXPECT_EQ_U(lsize_expected(u), gdmem.local_size(u));
+    gsize_expected += lsize_expected(u);
+  }
+  EXPECT_EQ_U(gsize_expected, gdmem.size());
+
+  for (dash::team_unit_t u{0}; u < dash::size(); ++u) {
+    for (size_t lidx = 0; lidx < gdmem.local_size(u); ++lidx) {
+      value_t expected = (1000 * (u + 1)) + lidx;
+      value_t actual;
+      dash::get_value(&actual, gdmem.at(u, lidx));
+      EXPECT_EQ_U(expected, actual);
+    }
+  }
+  gdmem.barrier();
+
+  // Remove the last bucket and an element of the preceding bucket on the
+  // last unit, grow the first unit:
+  dash::team_unit_t last_unit(dash::size() - 1);
+  size_t num_shrink = bucket_size(last_unit, num_buckets(last_unit) - 1) + 1;
+  if (myid == last_unit) {
+    gdmem.shrink(num_shrink);
+  }
+  if (myid == 0) {
+    gdmem.grow(3);
+    auto lbegin = gdmem.lbegin();
+    for (size_t li = lsize_expected(myid); li < gdmem.local_size(); ++li) {
+      *(lbegin + li) = (1000 * (myid + 1)) + li;
+    }
+  }
+
+  gdmem.commit();
+
+  for (dash::team_unit_t u{0}; u < dash::size(); ++u) {
+    size_t lsize = lsize_expected(u);
+    if (u == last_unit) { lsize -= num_shrink; }
+    if (u == 0)         { lsize += 3; }
+    EXPECT_EQ_U(lsize, gdmem.local_size(u));
+    for (size_t lidx = 0; lidx < gdmem.local_size(u); ++lidx) {
+      value_t expected = (1000 * (u + 1)) + lidx;
+      value_t actual;
+      dash::get_value(&actual, gdmem.at(u, lidx));
+      EXPECT_EQ_U(expected, actual);
+    }
+  }
+  // Remote units must complete their accesses before memory is freed:
+  gdmem.barrier();
+}
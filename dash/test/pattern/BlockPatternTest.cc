@@ -321,6 +321,62 @@ TEST_F(BlockPatternTest, Distribute1DimBlockcyclic)
   }
 }
 
+TEST_F(BlockPatternTest, LocalIndexTranslation)
+{
+  DASH_TEST_LOCAL_ONLY();
+  typedef dash::default_index_t index_t;
+  typedef dash::default_size_t  size_type;
+
+  // Precomputed divisors must be equivalent to integer division:
+  for (size_type d : { 1, 2, 3, 7, 8, 23, 64, 1000 }) {
+    dash::math::Divisor<size_type> div(d);
+    for (index_t x : { index_t(0), index_t(1), index_t(d - 1), index_t(d),
+                       index_t(12345), index_t(4294967295),
+                       index_t(4294967296), index_t(123456789012) }) {
+      EXPECT_EQ_U(x / static_cast<index_t>(d), div.div(x));
+      EXPECT_EQ_U(x % static_cast<index_t>(d), div.mod(x));
+    }
+  }
+
+  size_t team_size = dash::Team::All().size();
+  // Block sizes resolved to shift/mask and to multiplication:
+  for (size_t block_size : { 8, 23 }) {
+    dash::BlockPattern<1> pattern(
+        dash::SizeSpec<1>(_num_elem),
+        dash::DistributionSpec<1>(dash::BLOCKCYCLIC(block_size)),
+        dash::TeamSpec<1>(),
+        dash::Team::All());
+    for (index_t g = 0; g < static_cast<index_t>(_num_elem); ++g) {
+      index_t block_index = g / block_size;
+      auto    l_pos       = pattern.local(g);
+      EXPECT_EQ_U(block_index % team_size, l_pos.unit.id);
+      EXPECT_EQ_U((block_index / team_size) * block_size + g % block_size,
+                  l_pos.index);
+    }
+  }
+
+  // Every global index is mapped to a distinct local index of its unit:
+  size_t extent_x = 7 * team_size;
+  size_t extent_y = 5 * team_size;
+  dash::BlockPattern<2> pattern(
+      dash::SizeSpec<2>(extent_x, extent_y),
+      dash::DistributionSpec<2>(dash::BLOCKCYCLIC(3), dash::BLOCKCYCLIC(2)),
+      dash::TeamSpec<2>(dash::Team::All()),
+      dash::Team::All());
+  std::vector<std::vector<bool>> mapped(team_size);
+  for (size_t u = 0; u < team_size; ++u) {
+    auto l_extents = pattern.local_extents(dash::team_unit_t(u));
+    mapped[u].resize(l_extents[0] * l_extents[1], false);
+  }
+  for (index_t g = 0; g < static_cast<index_t>(pattern.size()); ++g) {
+    auto l_pos = pattern.local(g);
+    EXPECT_EQ_U(pattern.unit_at(pattern.coords(g)), l_pos.unit);
+    ASSERT_LT(l_pos.index, mapped[l_pos.unit.id].size());
+    EXPECT_FALSE_U(mapped[l_pos.unit.id][l_pos.index]);
+    mapped[l_pos.unit.id][l_pos.index] = true;
+  }
+}
+
 TEST_F(BlockPatternTest, Distribute2DimBlockedY)
 {
   DASH_TEST_LOCAL_ONLY();
@@ -73,3 +73,115 @@ TEST_F(CSRPatternTest, InitArray) {
     EXPECT_EQ_U(*i, myid.id);
   }
 }
+
+TEST_F(CSRPatternTest, LocalSegments) {
+  using pattern_t = dash::CSRPattern<1>;
+  using extent_t  = pattern_t::size_type;
+  using index_t   = pattern_t::index_type;
+
+  auto nunits = dash::size();
+
+  // Every second unit is assigned an empty block:
+  std::vector<extent_t> local_sizes;
+  for (size_t unit_idx = 0; unit_idx < nunits; ++unit_idx) {
+    local_sizes.push_back(unit_idx % 2 == 1 ? 0 : 3 + unit_idx);
+  }
+  pattern_t pattern(local_sizes);
+  index_t   size = pattern.size();
+
+  for (index_t g = 0; g < size; ++g) {
+    auto l_pos = pattern.local(g);
+    EXPECT_EQ_U(pattern.unit_at(g), l_pos.unit);
+    EXPECT_NE_U(0, local_sizes[l_pos.unit.id]);
+    EXPECT_EQ_U(g, pattern.global(l_pos.unit, l_pos.index));
+  }
+
+  // Range translation yields a single segment per non-empty block:
+  index_t g_begin  = 1;
+  auto    segments = dash::local_segments(pattern, g_begin, size);
+  EXPECT_EQ_U((nunits + 1) / 2, segments.size());
+  index_t num_elements = 0;
+  for (size_t s = 0; s < segments.size(); ++s) {
+    const auto & seg = segments[s];
+    if (s > 0) {
+      EXPECT_LT_U(segments[s-1].unit, seg.unit);
+    }
+    EXPECT_EQ_U(seg.gindex - g_begin, seg.pos);
+    EXPECT_EQ_U(pattern.local(seg.gindex).unit,  seg.unit);
+    EXPECT_EQ_U(pattern.local(seg.gindex).index, seg.lindex);
+    num_elements += seg.size;
+  }
+  EXPECT_EQ_U(size - g_begin, num_elements);
+
+  // Segments of the calling unit are resolved from its local blocks only:
+  auto unit_segments = dash::unit_local_segments(pattern, g_begin, size);
+  auto u_seg         = unit_segments.begin();
+  for (const auto & seg : segments) {
+    if (seg.unit != dash::myid()) {
+      continue;
+    }
+    ASSERT_NE_U(unit_segments.end(), u_seg);
+    EXPECT_EQ_U(seg.unit,   u_seg->unit);
+    EXPECT_EQ_U(seg.gindex, u_seg->gindex);
+    EXPECT_EQ_U(seg.lindex, u_seg->lindex);
+    EXPECT_EQ_U(seg.pos,    u_seg->pos);
+    EXPECT_EQ_U(seg.size,   u_seg->size);
+    ++u_seg;
+  }
+  EXPECT_EQ_U(unit_segments.end(), u_seg);
+
+  // Index lists are coalesced where contiguous, positions refer to the
+  // input sequence:
+  std::vector<index_t> indices;
+  for (index_t g = size - 1; g >= 0; g -= 2) {
+    indices.push_back(g);
+    if (g + 1 < size) {
+      indices.push_back(g + 1);
+    }
+  }
+  auto idx_segments = dash::local_segments(
+                        pattern, indices.begin(), indices.end());
+  num_elements = 0;
+  for (size_t s = 0; s < idx_segments.size(); ++s) {
+    const auto & seg = idx_segments[s];
+    if (s > 0) {
+      EXPECT_LE_U(idx_segments[s-1].unit, seg.unit);
+    }
+    for (index_t i = 0; i < seg.size; ++i) {
+      auto l_pos = pattern.local(indices[seg.pos + i]);
+      EXPECT_EQ_U(seg.gindex + i, indices[seg.pos + i]);
+      EXPECT_EQ_U(seg.unit,       l_pos.unit);
+      EXPECT_EQ_U(seg.lindex + i, l_pos.index);
+    }
+    num_elements += seg.size;
+  }
+  EXPECT_EQ_U(indices.size(), num_elements);
+}
+
+TEST_F(CSRPatternTest, EmptyLeadingUnit) {
+  using pattern_t = dash::CSRPattern<1>;
+  using extent_t  = pattern_t::size_type;
+  using index_t   = pattern_t::index_type;
+
+  auto nunits = dash::size();
+  if (nunits < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+
+  // First unit is assigned an empty block:
+  std::vector<extent_t> local_sizes(nunits, 5);
+  local_sizes[0] = 0;
+  pattern_t pattern(local_sizes);
+
+  EXPECT_EQ_U(5 * (nunits - 1), pattern.size());
+  EXPECT_EQ_U(1, pattern.unit_at(0));
+  EXPECT_EQ_U(1, pattern.local(0).unit);
+  EXPECT_EQ_U(0, pattern.local(0).index);
+  for (index_t g = 0; g < static_cast<index_t>(pattern.size()); ++g) {
+    auto l_pos = pattern.local(g);
+    EXPECT_EQ_U(g / 5 + 1, l_pos.unit);
+    EXPECT_EQ_U(g % 5,     l_pos.index);
+    EXPECT_EQ_U(pattern.unit_at(g), l_pos.unit);
+    EXPECT_EQ_U(g, pattern.global(l_pos.unit, l_pos.index));
+  }
+}
@@ -4,6 +4,7 @@
 #include <dash/Atomic.h>
 #include <dash/Array.h>
 #include <dash/Mutex.h>
+#include <dash/SharedMutex.h>
 #include <dash/Matrix.h>
 #include <dash/Shared.h>
 
@@ -478,6 +479,59 @@ TEST_F(AtomicTest, MutexInterface){
   }
 }
 
+TEST_F(AtomicTest, HierarchicalMutexInterface){
+  dash::Mutex mx(dash::Team::All(), dash::hierarchical_lock);
+
+  dash::Shared<int> shared(dash::team_unit_t{0});
+
+  if(dash::myid() == 0){
+    shared.set(0);
+  }
+
+  dash::barrier();
+
+  for (int i = 0; i < 10; ++i) {
+    std::lock_guard<dash::Mutex> lg(mx);
+    int tmp = shared.get();
+    shared.set(tmp + 1);
+  }
+
+  dash::barrier();
+
+  if(dash::myid() == 0){
+    int result = shared.get();
+    EXPECT_EQ_U(result, static_cast<int>(dash::size())*10);
+  }
+}
+
+TEST_F(AtomicTest, SharedMutexInterface){
+  dash::SharedMutex mx;
+
+  dash::Shared<int> shared(dash::team_unit_t{0});
+
+  if(dash::myid() == 0){
+    shared.set(0);
+  }
+
+  dash::barrier();
+
+  {
+    std::lock_guard<dash::SharedMutex> lg(mx);
+    int tmp = shared.get();
+    shared.set(tmp + 1);
+  }
+
+  dash::barrier();
+
+  // readers share the lock
+  mx.lock_shared();
+  EXPECT_EQ_U(static_cast<int>(dash::size()), shared.get());
+  dash::barrier();
+  mx.unlock_shared();
+
+  dash::barrier();
+}
+
 
 TEST_F(AtomicTest, AtomicSignal){
   using value_t = int;
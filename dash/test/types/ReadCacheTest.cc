@@ -0,0 +1,103 @@
+
+#include <gtest/gtest.h>
+
+#include <dash/ReadCache.h>
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+
+#include "../TestBase.h"
+#include "ReadCacheTest.h"
+
+#include <chrono>
+#include <thread>
+
+
+TEST_F(ReadCacheTest, CachedArrayReads)
+{
+  const size_t num_elem_per_unit = 100;
+  size_t       num_elem_total    = num_elem_per_unit * dash::size();
+  auto         myid              = dash::myid().id;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < num_elem_per_unit; ++l) {
+    array.local[l] = myid * 1000 + l;
+  }
+  array.barrier();
+
+  auto cached_array = dash::cached(array, 64);
+  EXPECT_EQ_U(64,             cached_array.cache().line_size());
+  EXPECT_EQ_U(num_elem_total, cached_array.size());
+  for (int pass = 0; pass < 2; ++pass) {
+    for (size_t g = 0; g < num_elem_total; ++g) {
+      int expected = (g / num_elem_per_unit) * 1000 + g % num_elem_per_unit;
+      EXPECT_EQ_U(expected, cached_array[g]);
+    }
+  }
+  // Remote elements are fetched once per line of 16 elements:
+  size_t num_lines = (num_elem_per_unit * sizeof(int) + 63) / 64;
+  EXPECT_EQ_U((dash::size() - 1) * num_lines, cached_array.cache().misses());
+
+  // Modified values are read after the next barrier:
+  array.barrier();
+  for (size_t l = 0; l < num_elem_per_unit; ++l) {
+    array.local[l] = -(myid * 1000 + l);
+  }
+  array.barrier();
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    int expected = (g / num_elem_per_unit) * 1000 + g % num_elem_per_unit;
+    EXPECT_EQ_U(-expected, cached_array[g]);
+  }
+  array.barrier();
+}
+
+TEST_F(ReadCacheTest, CachedMatrixReads)
+{
+  size_t extent_x = 5 * dash::size();
+  size_t extent_y = 7;
+
+  dash::Matrix<int, 2> matrix(extent_x, extent_y);
+  int * l_first = matrix.lbegin();
+  for (size_t l = 0; l < matrix.local_size(); ++l) {
+    l_first[l] = dash::myid().id * 1000 + l;
+  }
+  matrix.barrier();
+
+  auto cached_matrix = dash::cached(matrix);
+  for (size_t i = 0; i < matrix.size(); ++i) {
+    int expected = matrix.begin()[i];
+    EXPECT_EQ_U(expected, cached_matrix[i]);
+  }
+  matrix.barrier();
+}
+
+TEST_F(ReadCacheTest, ReadsDuringAsyncBarrier)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  auto   myid = dash::myid().id;
+  auto   next = (myid + 1) % dash::size();
+  auto & team = dash::Team::All();
+
+  dash::Array<int> array(dash::size(), dash::BLOCKED);
+  array.local[0] = 0;
+  array.barrier();
+
+  auto cached_array = dash::cached(array);
+  EXPECT_EQ_U(0, cached_array[next]);
+
+  // Units modify their element with increasing delay, so values of the
+  // succeeding unit are read before it has been modified:
+  std::this_thread::sleep_for(std::chrono::milliseconds(20 * myid));
+  array.local[0] = myid + 1;
+  auto fut = team.barrier_async();
+  size_t epoch = team.epoch();
+  // Value read while the barrier is in flight might be outdated:
+  int in_flight = cached_array[next];
+  EXPECT_TRUE_U(in_flight == 0 || in_flight == static_cast<int>(next + 1));
+  fut.wait();
+  EXPECT_EQ_U(epoch + 1, team.epoch());
+  // Lines read before the barrier completed are invalid:
+  EXPECT_EQ_U(next + 1, cached_array[next]);
+  array.barrier();
+}
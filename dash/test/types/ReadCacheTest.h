@@ -0,0 +1,13 @@
+#ifndef DASH__TEST__READ_CACHE_TEST_H__INCLUDED
+#define DASH__TEST__READ_CACHE_TEST_H__INCLUDED
+
+#include "../TestBase.h"
+
+
+/**
+ * Test fixture for class dash::ReadCache
+ */
+class ReadCacheTest : public dash::test::TestBase {
+};
+
+#endif // DASH__TEST__READ_CACHE_TEST_H__INCLUDED
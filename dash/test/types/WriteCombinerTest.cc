@@ -0,0 +1,78 @@
+
+#include <gtest/gtest.h>
+
+#include <dash/WriteCombiner.h>
+#include <dash/Array.h>
+#include <dash/Atomic.h>
+
+#include "../TestBase.h"
+#include "WriteCombinerTest.h"
+
+
+TEST_F(WriteCombinerTest, CombinePuts)
+{
+  const size_t num_elem_per_unit = 100;
+  size_t       num_elem_total    = num_elem_per_unit * dash::size();
+  auto         myid              = dash::myid().id;
+  auto         next_unit         = (myid + 1) % dash::size();
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  std::fill(array.lbegin(), array.lend(), -1);
+  array.barrier();
+
+  {
+    // Small capacity to publish full buffers before the final flush:
+    dash::WriteCombiner<int> wc(32);
+    EXPECT_EQ_U(32, wc.capacity());
+    size_t g_offset = next_unit * num_elem_per_unit;
+    // Write elements of the next unit in reverse order, every element is
+    // written twice and only the last write must be published:
+    for (size_t i = num_elem_per_unit; i > 0; --i) {
+      wc.put(array[g_offset + i - 1], -2);
+      wc.put(array.async[g_offset + i - 1], myid * 1000 + i - 1);
+    }
+    EXPECT_GT_U(wc.size(), 0);
+    wc.flush();
+    EXPECT_EQ_U(0, wc.size());
+  }
+  array.barrier();
+
+  auto prev_unit = (myid + dash::size() - 1) % dash::size();
+  for (size_t l = 0; l < num_elem_per_unit; ++l) {
+    EXPECT_EQ_U(static_cast<int>(prev_unit * 1000 + l), array.local[l]);
+  }
+}
+
+TEST_F(WriteCombinerTest, CombineAtomicUpdates)
+{
+  typedef dash::Atomic<int> atom_t;
+
+  const size_t num_elem_per_unit = 10;
+  const int    num_updates       = 5;
+  size_t       num_elem_total    = num_elem_per_unit * dash::size();
+
+  dash::Array<atom_t> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < num_elem_per_unit; ++l) {
+    array.local[l] = atom_t(0);
+  }
+  array.barrier();
+
+  {
+    dash::WriteCombiner<int> wc;
+    // Every unit adds 1 to every element several times, updates of the
+    // same element are combined before published:
+    for (int u = 0; u < num_updates; ++u) {
+      for (size_t g = 0; g < num_elem_total; ++g) {
+        wc.accumulate(array[g], 1);
+      }
+    }
+    // Destructor publishes remaining updates
+  }
+  array.barrier();
+
+  size_t g_offset = dash::myid().id * num_elem_per_unit;
+  for (size_t l = 0; l < num_elem_per_unit; ++l) {
+    EXPECT_EQ_U(static_cast<int>(num_updates * dash::size()),
+                array[g_offset + l].load());
+  }
+}